@@ -26,6 +26,7 @@ public class GeneralMovement : ModuleRules
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Framework"));
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Framework/Actors"));
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Framework/Components"));
+    PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Framework/Subsystems"));
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Extras"));
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Extras/Steam"));
     PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public/Extras/UI"));
@@ -1,6 +1,7 @@
 // Copyright 2022 Dominik Scherer. All Rights Reserved.
 
 #include "GenPawn.h"
+#include "GenWorldSubsystem.h"
 #define GMC_PAWN_LOG
 #include "GMC_LOG.h"
 
@@ -24,6 +25,34 @@ AGenPawn::AGenPawn()
 }
 
 bool AGenPawn::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+  if (const auto World = GetWorld())
+  {
+    if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+    {
+      bool bIsNetRelevant{false};
+      if (Subsystem->GetCachedNetRelevancy(this, RealViewer, ViewTarget, SrcLocation, bIsNetRelevant))
+      {
+        return bIsNetRelevant;
+      }
+    }
+  }
+  return EvaluateNetRelevancy(RealViewer, ViewTarget, SrcLocation);
+}
+
+bool AGenPawn::EvaluateNetRelevancy(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+  switch (GetNetRelevancyIgnoringDistance(RealViewer, ViewTarget))
+  {
+    case EGenNetRelevancy::Relevant: return true;
+    case EGenNetRelevancy::NotRelevant: return false;
+    case EGenNetRelevancy::DistanceBased: break;
+    default: checkNoEntry();
+  }
+  return !GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy || IsWithinNetRelevancyDistance(SrcLocation);
+}
+
+EGenNetRelevancy AGenPawn::GetNetRelevancyIgnoringDistance(const AActor* RealViewer, const AActor* ViewTarget) const
 {
   CA_SUPPRESS(6011);
   if (
@@ -37,11 +66,11 @@ bool AGenPawn::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarg
     || (ViewTarget && ViewTarget->IsBasedOnActor(this))
   )
   {
-    return true;
+    return EGenNetRelevancy::Relevant;
   }
   else if ((IsHidden() || bOnlyRelevantToOwner) && (!GetRootComponent() || !GetRootComponent()->IsCollisionEnabled()))
   {
-    return false;
+    return EGenNetRelevancy::NotRelevant;
   }
   else
   {
@@ -49,7 +78,7 @@ bool AGenPawn::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarg
     // implementation does not attach the pawn to the movement base.
   }
 
-  return !GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy || IsWithinNetRelevancyDistance(SrcLocation);
+  return EGenNetRelevancy::DistanceBased;
 }
 
 #if WITH_EDITOR
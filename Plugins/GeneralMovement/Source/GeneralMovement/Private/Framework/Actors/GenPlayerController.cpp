@@ -3,6 +3,7 @@
 #include "GenPlayerController.h"
 #include "GenPawn.h"
 #include "GenMovementReplicationComponent.h"
+#include "GenWorldSubsystem.h"
 #define GMC_CONTROLLER_LOG
 #include "GMC_LOG.h"
 #include "GenPlayerController_DBG.h"
@@ -178,21 +179,10 @@ void AGenPlayerController::Client_SyncWithServerTime()
 
 void AGenPlayerController::SetInterpolationDelay(float Delay) const
 {
-  TArray<AActor*> Actors;
-  UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
-  for (const auto Actor : Actors)
+  ForEachRemotelyControlledReplicationComponent([Delay](UGenMovementReplicationComponent* MovementComponent)
   {
-    if (const auto GenPawn = Cast<AGenPawn>(Actor))
-    {
-      if (!GenPawn->IsLocallyControlled())
-      {
-        if (const auto MovementComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-        {
-          MovementComponent->SimulationDelay = Delay;
-        }
-      }
-    }
-  }
+    MovementComponent->SimulationDelay = Delay;
+  });
 }
 
 void AGenPlayerController::SetInterpolationMethod(int32 Method) const
@@ -202,58 +192,40 @@ void AGenPlayerController::SetInterpolationMethod(int32 Method) const
     return;
   }
 
-  TArray<AActor*> Actors;
-  UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
-  for (const auto Actor : Actors)
+  ForEachRemotelyControlledReplicationComponent([Method](UGenMovementReplicationComponent* MovementComponent)
   {
-    if (const auto GenPawn = Cast<AGenPawn>(Actor))
-    {
-      if (!GenPawn->IsLocallyControlled())
-      {
-        if (const auto MovementComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-        {
-          MovementComponent->SetInterpolationMethod(static_cast<EInterpolationMethod>(Method));
-        }
-      }
-    }
-  }
+    MovementComponent->SetInterpolationMethod(static_cast<EInterpolationMethod>(Method));
+  });
 }
 
 void AGenPlayerController::SetExtrapolationAllowed(bool bAllowed) const
 {
-  TArray<AActor*> Actors;
-  UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
-  for (const auto Actor : Actors)
+  ForEachRemotelyControlledReplicationComponent([bAllowed](UGenMovementReplicationComponent* MovementComponent)
   {
-    if (const auto GenPawn = Cast<AGenPawn>(Actor))
-    {
-      if (!GenPawn->IsLocallyControlled())
-      {
-        if (const auto MovementComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-        {
-          MovementComponent->bAllowExtrapolation = bAllowed;
-        }
-      }
-    }
-  }
+    MovementComponent->bAllowExtrapolation = bAllowed;
+  });
 }
 
 void AGenPlayerController::SetSmoothCollision(bool bSmoothLocation, bool bSmoothRotation) const
 {
-  TArray<AActor*> Actors;
-  UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
-  for (const auto Actor : Actors)
+  ForEachRemotelyControlledReplicationComponent([bSmoothLocation, bSmoothRotation](UGenMovementReplicationComponent* MovementComponent)
   {
-    if (const auto GenPawn = Cast<AGenPawn>(Actor))
-    {
-      if (!GenPawn->IsLocallyControlled())
-      {
-        if (const auto MovementComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-        {
-          MovementComponent->bSmoothCollisionLocation = bSmoothLocation;
-          MovementComponent->bSmoothCollisionRotation = bSmoothRotation;
-        }
-      }
-    }
+    MovementComponent->bSmoothCollisionLocation = bSmoothLocation;
+    MovementComponent->bSmoothCollisionRotation = bSmoothRotation;
+  });
+}
+
+void AGenPlayerController::ForEachRemotelyControlledReplicationComponent(
+  TFunctionRef<void(UGenMovementReplicationComponent*)> Function
+) const
+{
+  const auto World = GetWorld();
+  if (!World) return;
+  if (const auto WorldSubsystem = World->GetSubsystem<UGenWorldSubsystem>())
+  {
+    WorldSubsystem->ForEachReplicationComponent(
+      {EGenReplicationRole::SimulatedProxy, EGenReplicationRole::ServerRemote, EGenReplicationRole::ServerUnpossessed},
+      Function
+    );
   }
 }
@@ -15,11 +15,28 @@ DECLARE_CYCLE_STAT(TEXT("Compute Immersion Depth"), STAT_ComputeImmersionDepth,
 DECLARE_CYCLE_STAT(TEXT("Set Root Collision Shape"), STAT_SetRootCollisionShape, STATGROUP_GMCGenMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Set Root Collision Extent"), STAT_SetRootCollisionExtent, STATGROUP_GMCGenMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Is Valid Position"), STAT_IsValidPosition, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Queries Issued"), STAT_FloorQueriesIssued, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Queries Cached"), STAT_FloorQueriesCached, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Queries From Field"), STAT_FloorQueriesFromField, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Queries From Async Results"), STAT_FloorQueriesFromAsync, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Penetration Tests From Async Results"), STAT_PenetrationTestsFromAsync, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Queries Prefetched"), STAT_FloorQueriesPrefetched, STATGROUP_GMCGenMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Penetration Tests Prefetched"), STAT_PenetrationTestsPrefetched, STATGROUP_GMCGenMovementComp)
 
 namespace GMCCVars
 {
+  int32 UseFloorCache = 1;
+
 #if ALLOW_CONSOLE && !NO_LOGGING
 
+  FAutoConsoleVariableRef CVarUseFloorCache(
+    TEXT("gmc.UseFloorCache"),
+    UseFloorCache,
+    TEXT("Reuse the result of the last floor query within a move if the pawn and its floor have not moved in between. ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
   int32 ShowMovementVectors = 0;
   FAutoConsoleVariableRef CVarShowMovementVectors(
     TEXT("gmc.ShowMovementVectors"),
@@ -35,10 +52,14 @@ void UGenMovementComponent::ReplicatedTick(const FMove& Move, int32 Iteration, b
 {
   SCOPE_CYCLE_COUNTER(STAT_ReplicatedTick)
 
+  // Floor queries are only shared within a single move execution.
+  InvalidateFloorCache();
+
   // Save the values of the current move into the local members.
   Timestamp = Move.Timestamp;
   MoveDeltaTime = Move.DeltaTime;
   InputVector = Move.InputVector;
+  InputFlags = Move.GetInputFlags();
   InVelocity = Move.InVelocity;
   InLocation = Move.InLocation;
   InRotation = Move.InRotation;
@@ -56,7 +77,8 @@ void UGenMovementComponent::ReplicatedTick(const FMove& Move, int32 Iteration, b
   SetPhysDeltaTime(MoveDeltaTime);
 
   // Simplified tick function for subclasses.
-  GenReplicatedTick(MoveDeltaTime);
+  GMC_CALL_HOOK(GenReplicatedTick, MoveDeltaTime);
+  OnGenReplicatedTick.Broadcast(MoveDeltaTime);
   DEBUG_GMC_SHOW_MOVEMENT_VECTORS
 }
 
@@ -64,6 +86,8 @@ void UGenMovementComponent::SimulatedTick(float DeltaTime, const FState& SmoothS
 {
   SCOPE_CYCLE_COUNTER(STAT_SimulatedTick)
 
+  InvalidateFloorCache();
+
   // Set the member pointers for the current interpolation iteration.
   if (IsValidStateQueueIndex(StartStateIndex) && IsValidStateQueueIndex(TargetStateIndex))
   {
@@ -84,7 +108,24 @@ void UGenMovementComponent::SimulatedTick(float DeltaTime, const FState& SmoothS
   }
 
   // Simplified tick function for subclasses.
-  GenSimulatedTick(DeltaTime);
+  GMC_CALL_HOOK(GenSimulatedTick, DeltaTime);
+}
+
+void UGenMovementComponent::CacheBlueprintHooks()
+{
+  Super::CacheBlueprintHooks();
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementComponent, GenReplicatedTick);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementComponent, GenSimulatedTick);
+}
+
+bool UGenMovementComponent::CanExecuteMovesConcurrently() const
+{
+  if (!Super::CanExecuteMovesConcurrently()) return false;
+#if ALLOW_CONSOLE && !NO_LOGGING
+  // Debug shapes can only be drawn on the game thread.
+  if (GMCCVars::ShowMovementVectors != 0 || GMCCVars::ShowFloorSweep != 0) return false;
+#endif
+  return true;
 }
 
 const FState& UGenMovementComponent::GetCurrentInterpolationStartState() const
@@ -604,6 +645,29 @@ bool UGenMovementComponent::UpdateFloor(FFloorParams& Floor, float TraceLength)
 {
   SCOPE_CYCLE_COUNTER(STAT_UpdateFloor)
 
+  if (GMCCVars::UseFloorCache != 0 && FindCachedFloor(Floor, TraceLength))
+  {
+    INC_DWORD_STAT(STAT_FloorQueriesCached)
+    return true;
+  }
+  if (FindFloorFromAsyncBotQueries(Floor, TraceLength))
+  {
+    INC_DWORD_STAT(STAT_FloorQueriesFromAsync)
+    return true;
+  }
+  if (FindFloorFromPrefetchedMoveQueries(Floor, TraceLength))
+  {
+    INC_DWORD_STAT(STAT_FloorQueriesPrefetched)
+    return true;
+  }
+  if (FindFloorInField(Floor, TraceLength))
+  {
+    INC_DWORD_STAT(STAT_FloorQueriesFromField)
+    CacheFloor(Floor, TraceLength);
+    return true;
+  }
+  INC_DWORD_STAT(STAT_FloorQueriesIssued)
+
   FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
   bool bNoAdjustment{true};
 
@@ -659,12 +723,340 @@ bool UGenMovementComponent::UpdateFloor(FFloorParams& Floor, float TraceLength)
 
   // Save the new floor.
   Floor = FFloorParams(ShapeHit, LineHit, CurrentLocation);
+  CacheFloor(Floor, TraceLength);
 
   DEBUG_OMC_SHOW_FLOOR_SWEEP
   // Return true if the shape trace did not start in penetration or the position was not adjusted (if it did start in penetration).
   return bNoAdjustment;
 }
 
+bool UGenMovementComponent::FindFloorInField(FFloorParams& Floor, float TraceLength)
+{
+  const auto Subsystem = GetWorldSubsystem();
+  if (!Subsystem || TraceLength <= 0.f) return false;
+
+  // The field is baked for a sphere which is equivalent to sweeping an upright vertical capsule down.
+  const EGenCollisionShape CollisionShape = GetRootCollisionShape();
+  if (CollisionShape != EGenCollisionShape::VerticalCapsule && CollisionShape != EGenCollisionShape::Sphere) return false;
+  const FVector Extent = GetRootCollisionExtent();
+  const FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+  FVector SphereCenter = CurrentLocation;
+  if (CollisionShape == EGenCollisionShape::VerticalCapsule)
+  {
+    if (UpdatedComponent->GetComponentQuat().GetUpVector().Z < 1.f - KINDA_SMALL_NUMBER) return false;
+    SphereCenter.Z -= Extent.Z - Extent.X;
+  }
+  const FVector LineTraceStart = GetLowerBound();
+  FGenFieldFloor FieldFloor;
+  if (!Subsystem->FindFloorInField(SphereCenter, LineTraceStart, Extent.X, TraceLength, GetOwner(), FieldFloor)) return false;
+
+  // Reconstruct the hit results the traces would have produced.
+  const float ShapeDistance = SphereCenter.Z - FieldFloor.RestLocation.Z;
+  FHitResult ShapeHit(ShapeDistance / TraceLength);
+  ShapeHit.bBlockingHit = true;
+  ShapeHit.TraceStart = CurrentLocation;
+  ShapeHit.TraceEnd = CurrentLocation + FVector::DownVector * TraceLength;
+  ShapeHit.Distance = ShapeDistance;
+  ShapeHit.Location = CurrentLocation + FVector::DownVector * ShapeDistance;
+  ShapeHit.ImpactPoint = FieldFloor.ImpactPoint;
+  ShapeHit.Normal = ShapeHit.ImpactNormal = FieldFloor.ImpactNormal;
+  ShapeHit.Component = FieldFloor.Component;
+  ShapeHit.Actor = FieldFloor.Component->GetOwner();
+
+  const float LineDistance = LineTraceStart.Z - FieldFloor.LineImpactPoint.Z;
+  FHitResult LineHit(LineDistance / TraceLength);
+  LineHit.bBlockingHit = true;
+  LineHit.TraceStart = LineTraceStart;
+  LineHit.TraceEnd = LineTraceStart + FVector::DownVector * TraceLength;
+  LineHit.Distance = LineDistance;
+  LineHit.Location = LineHit.ImpactPoint = FieldFloor.LineImpactPoint;
+  LineHit.Normal = LineHit.ImpactNormal = FieldFloor.ImpactNormal;
+  LineHit.Component = FieldFloor.Component;
+  LineHit.Actor = FieldFloor.Component->GetOwner();
+
+  Floor = FFloorParams(ShapeHit, LineHit, CurrentLocation);
+  return true;
+}
+
+void UGenMovementComponent::InvalidateFloorCache()
+{
+  FloorQueryCache.bValid = false;
+}
+
+void UGenMovementComponent::CacheFloor(const FFloorParams& Floor, float TraceLength)
+{
+  FloorQueryCache.Floor = Floor;
+  FloorQueryCache.TraceLength = TraceLength;
+  FloorQueryCache.Location = UpdatedComponent->GetComponentLocation();
+  FloorQueryCache.Rotation = UpdatedComponent->GetComponentQuat();
+  FloorQueryCache.CollisionShape = GetRootCollisionShape();
+  FloorQueryCache.CollisionExtent = GetRootCollisionExtent();
+  const FHitResult ShapeHit = Floor.ShapeHit();
+  const FHitResult LineHit = Floor.LineHit();
+  FloorQueryCache.ShapeHitComponent = ShapeHit.Component;
+  FloorQueryCache.LineHitComponent = LineHit.Component;
+  if (const auto ShapeHitComponent = ShapeHit.GetComponent()) FloorQueryCache.ShapeHitTransform = ShapeHitComponent->GetComponentTransform();
+  if (const auto LineHitComponent = LineHit.GetComponent()) FloorQueryCache.LineHitTransform = LineHitComponent->GetComponentTransform();
+  FloorQueryCache.bValid = true;
+}
+
+static bool IsCachedFloorHitValid(const FHitResult& Hit, const TWeakObjectPtr<UPrimitiveComponent>& CachedComponent, const FTransform& CachedTransform)
+{
+  if (!Hit.IsValidBlockingHit()) return true;
+  // The floor must not have moved or stopped colliding since it was queried.
+  const auto Component = CachedComponent.Get();
+  return Component
+    && Component->IsCollisionEnabled()
+    && Component->GetComponentTransform().Equals(CachedTransform, 0.f);
+}
+
+static void ShiftCachedFloorHitDown(FHitResult& Hit, float Drop, float TraceLength)
+{
+  if (!Hit.IsValidBlockingHit()) return;
+  Hit.TraceStart.Z -= Drop;
+  Hit.TraceEnd.Z -= Drop;
+  Hit.Distance -= Drop;
+  Hit.Time = TraceLength > 0.f ? Hit.Distance / TraceLength : 0.f;
+}
+
+bool UGenMovementComponent::FindCachedFloor(FFloorParams& Floor, float TraceLength) const
+{
+  const FFloorQueryCache& Cache = FloorQueryCache;
+  if (!Cache.bValid || Cache.TraceLength != TraceLength) return false;
+
+  const FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+  const FVector LocationDelta = CurrentLocation - Cache.Location;
+  if (LocationDelta.X != 0.f || LocationDelta.Y != 0.f || LocationDelta.Z > 0.f) return false;
+  if (!(UpdatedComponent->GetComponentQuat() == Cache.Rotation)) return false;
+  if (GetRootCollisionShape() != Cache.CollisionShape || GetRootCollisionExtent() != Cache.CollisionExtent) return false;
+
+  FHitResult ShapeHit = Cache.Floor.ShapeHit();
+  FHitResult LineHit = Cache.Floor.LineHit();
+  if (!IsCachedFloorHitValid(ShapeHit, Cache.ShapeHitComponent, Cache.ShapeHitTransform)) return false;
+  if (!IsCachedFloorHitValid(LineHit, Cache.LineHitComponent, Cache.LineHitTransform)) return false;
+
+  const float Drop = -LocationDelta.Z;
+  if (Drop == 0.f)
+  {
+    Floor = Cache.Floor;
+    return true;
+  }
+
+  // The pawn moved straight down. Both traces from the new location cover a subset of the volume swept by the cached traces, so the
+  // cached hits are still the first ones as long as the pawn stayed clear of them. Without a hit the new traces would reach further down
+  // than the cached ones did.
+  constexpr float MinClearance = UU_MILLIMETER;
+  if (!ShapeHit.IsValidBlockingHit() || !LineHit.IsValidBlockingHit()) return false;
+  if (ShapeHit.bStartPenetrating || LineHit.bStartPenetrating) return false;
+  if (Drop > FMath::Min(ShapeHit.Distance, LineHit.Distance) - MinClearance) return false;
+
+  ShiftCachedFloorHitDown(ShapeHit, Drop, TraceLength);
+  ShiftCachedFloorHitDown(LineHit, Drop, TraceLength);
+  Floor = FFloorParams(ShapeHit, LineHit, CurrentLocation);
+  return true;
+}
+
+bool UGenMovementComponent::SubmitAsyncBotQueries()
+{
+  AsyncBotQueries.bValid = false;
+  UWorld* World = GetWorld();
+  if (!World || !bUseAsyncBotQueries || !UpdatedPrimitive || !CanMove() || UpdatedComponent->IsSimulatingPhysics()) return false;
+  // The trace length of the last floor query is the best guess for the first one of the next movement update.
+  const float TraceLength = FloorQueryCache.TraceLength;
+  if (TraceLength <= 0.f) return false;
+
+  FAsyncBotQueries& Queries = AsyncBotQueries;
+  Queries.Location = UpdatedComponent->GetComponentLocation();
+  Queries.Rotation = UpdatedComponent->GetComponentQuat();
+  Queries.CollisionShape = GetRootCollisionShape();
+  Queries.CollisionExtent = GetRootCollisionExtent();
+  Queries.TraceLength = TraceLength;
+  Queries.Frame = GFrameCounter;
+
+  // The same queries that UpdateFloor and AutoResolvePenetration would execute synchronously.
+  const FCollisionShape TraceShape = GetFrom(Queries.CollisionShape, Queries.CollisionExtent);
+  const FQuat TraceRotation = AddGenCapsuleRotation(Queries.Rotation).GetNormalized();
+  const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCAsyncBotQueries), false, GetOwner());
+  Queries.ShapeHandle = World->AsyncSweepByChannel(
+    EAsyncTraceType::Single,
+    Queries.Location,
+    Queries.Location + FVector::DownVector * TraceLength,
+    TraceRotation,
+    ECC_Pawn,
+    TraceShape,
+    QueryParams
+  );
+  const FVector LineTraceStart = GetLowerBound();
+  Queries.LineHandle = World->AsyncLineTraceByChannel(
+    EAsyncTraceType::Single,
+    LineTraceStart,
+    LineTraceStart + FVector::DownVector * TraceLength,
+    UpdatedComponent->GetCollisionObjectType(),
+    QueryParams
+  );
+  // Use the collision settings of the updated component like a move of it would.
+  FCollisionQueryParams OverlapQueryParams = QueryParams;
+  FCollisionResponseParams OverlapResponseParams;
+  UpdatedPrimitive->InitSweepCollisionParams(OverlapQueryParams, OverlapResponseParams);
+  Queries.OverlapHandle = World->AsyncOverlapByChannel(
+    Queries.Location,
+    TraceRotation,
+    UpdatedComponent->GetCollisionObjectType(),
+    TraceShape,
+    OverlapQueryParams,
+    OverlapResponseParams
+  );
+  Queries.bValid = true;
+  return true;
+}
+
+bool UGenMovementComponent::MatchesAsyncBotQueries() const
+{
+  const FAsyncBotQueries& Queries = AsyncBotQueries;
+  // The results of async queries can only be retrieved during the frame after they were submitted.
+  return Queries.bValid
+    && Queries.Frame + 1 == GFrameCounter
+    && UpdatedComponent->GetComponentLocation() == Queries.Location
+    && UpdatedComponent->GetComponentQuat() == Queries.Rotation
+    && GetRootCollisionShape() == Queries.CollisionShape
+    && GetRootCollisionExtent() == Queries.CollisionExtent;
+}
+
+// Returns the hit of an async single trace, or a hit without a blocking hit that spans the trace if nothing was hit.
+static FHitResult GetAsyncTraceHit(const FTraceDatum& Data)
+{
+  if (Data.OutHits.Num() > 0) return Data.OutHits[0];
+  FHitResult Hit(1.f);
+  Hit.TraceStart = Data.Start;
+  Hit.TraceEnd = Data.End;
+  return Hit;
+}
+
+// The floor component may have moved since the async query was executed unless it has static or stationary mobility.
+static bool IsAsyncFloorHitValid(const FHitResult& Hit)
+{
+  if (!Hit.bBlockingHit) return true;
+  if (Hit.bStartPenetrating) return false;
+  const auto Component = Hit.GetComponent();
+  return Component
+    && Component->Mobility != EComponentMobility::Movable
+    && Component->IsCollisionEnabled();
+}
+
+bool UGenMovementComponent::FindFloorFromAsyncBotQueries(FFloorParams& Floor, float TraceLength)
+{
+  if (AsyncBotQueries.TraceLength != TraceLength || !MatchesAsyncBotQueries()) return false;
+  const auto World = GetWorld();
+  FTraceDatum ShapeData;
+  FTraceDatum LineData;
+  if (!World->QueryTraceData(AsyncBotQueries.ShapeHandle, ShapeData) || !World->QueryTraceData(AsyncBotQueries.LineHandle, LineData))
+  {
+    return false;
+  }
+
+  // Let the synchronous query handle initial penetration, it may have to adjust the position of the pawn.
+  const FHitResult ShapeHit = GetAsyncTraceHit(ShapeData);
+  const FHitResult LineHit = GetAsyncTraceHit(LineData);
+  if (!IsAsyncFloorHitValid(ShapeHit) || !IsAsyncFloorHitValid(LineHit)) return false;
+
+  Floor = FFloorParams(ShapeHit, LineHit, AsyncBotQueries.Location);
+  CacheFloor(Floor, TraceLength);
+  return true;
+}
+
+bool UGenMovementComponent::IsClearOfPenetrationByAsyncBotQueries() const
+{
+  if (!MatchesAsyncBotQueries()) return false;
+  FOverlapDatum OverlapData;
+  if (!GetWorld()->QueryOverlapData(AsyncBotQueries.OverlapHandle, OverlapData)) return false;
+  for (const auto& Overlap : OverlapData.OutOverlaps)
+  {
+    if (Overlap.bBlockingHit) return false;
+  }
+  return true;
+}
+
+bool UGenMovementComponent::PrefetchMoveQueries()
+{
+  PrefetchedMoveQueries.bValid = false;
+  const UWorld* World = GetWorld();
+  if (!World || !UpdatedPrimitive || !CanMove() || UpdatedComponent->IsSimulatingPhysics()) return false;
+  // The trace length of the last floor query is the best guess for the first one of the next movement update.
+  const float TraceLength = FloorQueryCache.TraceLength;
+  if (TraceLength <= 0.f) return false;
+
+  FPrefetchedMoveQueries& Queries = PrefetchedMoveQueries;
+  Queries.Location = UpdatedComponent->GetComponentLocation();
+  Queries.Rotation = UpdatedComponent->GetComponentQuat();
+  Queries.CollisionShape = GetRootCollisionShape();
+  Queries.CollisionExtent = GetRootCollisionExtent();
+  Queries.TraceLength = TraceLength;
+
+  // The same queries that UpdateFloor and AutoResolvePenetration would execute at the start of the first move.
+  const FCollisionShape TraceShape = GetFrom(Queries.CollisionShape, Queries.CollisionExtent);
+  const FQuat TraceRotation = AddGenCapsuleRotation(Queries.Rotation).GetNormalized();
+  const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCPrefetchMoveQueries), false, GetOwner());
+  World->SweepSingleByChannel(
+    Queries.ShapeHit,
+    Queries.Location,
+    Queries.Location + FVector::DownVector * TraceLength,
+    TraceRotation,
+    ECC_Pawn,
+    TraceShape,
+    QueryParams
+  );
+  const FVector LineTraceStart = GetLowerBound();
+  World->LineTraceSingleByChannel(
+    Queries.LineHit,
+    LineTraceStart,
+    LineTraceStart + FVector::DownVector * TraceLength,
+    UpdatedComponent->GetCollisionObjectType(),
+    QueryParams
+  );
+  // Use the collision settings of the updated component like a move of it would.
+  FCollisionQueryParams OverlapQueryParams = QueryParams;
+  FCollisionResponseParams OverlapResponseParams;
+  UpdatedPrimitive->InitSweepCollisionParams(OverlapQueryParams, OverlapResponseParams);
+  Queries.bClearOfPenetration = !World->OverlapBlockingTestByChannel(
+    Queries.Location,
+    TraceRotation,
+    UpdatedComponent->GetCollisionObjectType(),
+    TraceShape,
+    OverlapQueryParams,
+    OverlapResponseParams
+  );
+  Queries.bValid = true;
+  return true;
+}
+
+bool UGenMovementComponent::MatchesPrefetchedMoveQueries() const
+{
+  const FPrefetchedMoveQueries& Queries = PrefetchedMoveQueries;
+  return Queries.bValid
+    && UpdatedComponent->GetComponentLocation() == Queries.Location
+    && UpdatedComponent->GetComponentQuat() == Queries.Rotation
+    && GetRootCollisionShape() == Queries.CollisionShape
+    && GetRootCollisionExtent() == Queries.CollisionExtent;
+}
+
+bool UGenMovementComponent::FindFloorFromPrefetchedMoveQueries(FFloorParams& Floor, float TraceLength)
+{
+  if (PrefetchedMoveQueries.TraceLength != TraceLength || !MatchesPrefetchedMoveQueries()) return false;
+  // Let the synchronous query handle initial penetration, it may have to adjust the position of the pawn.
+  const FHitResult& ShapeHit = PrefetchedMoveQueries.ShapeHit;
+  const FHitResult& LineHit = PrefetchedMoveQueries.LineHit;
+  if (!IsAsyncFloorHitValid(ShapeHit) || !IsAsyncFloorHitValid(LineHit)) return false;
+
+  Floor = FFloorParams(ShapeHit, LineHit, PrefetchedMoveQueries.Location);
+  CacheFloor(Floor, TraceLength);
+  return true;
+}
+
+bool UGenMovementComponent::IsClearOfPenetrationByPrefetchedMoveQueries() const
+{
+  return MatchesPrefetchedMoveQueries() && PrefetchedMoveQueries.bClearOfPenetration;
+}
+
 bool UGenMovementComponent::CanMove() const
 {
   if (!UpdatedComponent || !PawnOwner) return false;
@@ -1621,6 +2013,18 @@ TArray<FHitResult> UGenMovementComponent::LineTracesAlignedVertical(
 
 FHitResult UGenMovementComponent::AutoResolvePenetration()
 {
+  if (IsClearOfPenetrationByAsyncBotQueries())
+  {
+    // There is nothing to resolve.
+    INC_DWORD_STAT(STAT_PenetrationTestsFromAsync)
+    return FHitResult();
+  }
+  if (IsClearOfPenetrationByPrefetchedMoveQueries())
+  {
+    INC_DWORD_STAT(STAT_PenetrationTestsPrefetched)
+    return FHitResult();
+  }
+
   FHitResult Hit;
   const FQuat CurrentRotation = UpdatedComponent->GetComponentQuat();
   SafeMoveUpdatedComponent(FVector(0.f, 0.f, 0.01f), CurrentRotation, true, Hit);
@@ -3,12 +3,14 @@
 #include "GenMovementReplicationComponent.h"
 #include "GenPawn.h"
 #include "GenPlayerController.h"
+#include "GenWorldSubsystem.h"
 #include "FlatCapsuleComponent.h"
 #define GMC_REPLICATION_COMPONENT_LOG
 #include "GMC_LOG.h"
 #include "GenMovementReplicationComponent_DBG.h"
 
 DEFINE_LOG_CATEGORY(LogGMCReplication)
+DEFINE_STAT(STAT_BlueprintHooks)
 
 DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_Tick, STATGROUP_GMCReplicationComp)
 DECLARE_CYCLE_STAT(TEXT("Tick Local Server Pawn"), STAT_TickLocalServerPawn, STATGROUP_GMCReplicationComp)
@@ -17,11 +19,150 @@ DECLARE_CYCLE_STAT(TEXT("Tick Smoothing"), STAT_TickSmoothing, STATGROUP_GMCRepl
 DECLARE_CYCLE_STAT(TEXT("Process Client Moves"), STAT_ProcessClientMoves, STATGROUP_GMCReplicationComp)
 DECLARE_CYCLE_STAT(TEXT("On Rep Autonomous Proxy"), STAT_OnRepAutonomousProxy, STATGROUP_GMCReplicationComp)
 DECLARE_CYCLE_STAT(TEXT("On Rep Simulated Proxy"), STAT_OnRepSimulatedProxy, STATGROUP_GMCReplicationComp)
+DECLARE_CYCLE_STAT(TEXT("Replay Moves"), STAT_ReplayMoves, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialized States"), STAT_SerializedStates, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialized State Bits"), STAT_SerializedStateBits, STATGROUP_GMCReplicationComp)
+// Estimate, not a measurement: the bits the serialized states would have needed with the layout before the dirty mask was introduced (@see
+// FState::SerializeStateData).
+DECLARE_DWORD_COUNTER_STAT(TEXT("Estimated State Bits Without Dirty Mask"), STAT_EstimatedStateBitsWithoutDirtyMask, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialized Moves"), STAT_SerializedMoves, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialized Move Bits"), STAT_SerializedMoveBits, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Out State Hash Matches"), STAT_OutStateHashMatches, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Out State Hash Mismatches"), STAT_OutStateHashMismatches, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dejitter Buffered Moves"), STAT_DejitterBufferedMoves, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dejitter Buffered Time (ms)"), STAT_DejitterBufferedTime, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dejitter Target Depth (ms)"), STAT_DejitterTargetDepth, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dejitter Underruns"), STAT_DejitterUnderruns, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dejitter Overruns"), STAT_DejitterOverruns, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replayed Moves"), STAT_ReplayedMoves, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped Replay Moves"), STAT_SkippedReplayMoves, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Coalesced Replays"), STAT_CoalescedReplays, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replay Move Executions"), STAT_ReplayMoveExecutions, STATGROUP_GMCReplicationComp)
+DECLARE_CYCLE_STAT(TEXT("Clear Acknowledged Moves"), STAT_ClearAcknowledgedMoves, STATGROUP_GMCReplicationComp)
+DECLARE_MEMORY_STAT(TEXT("Client Move Queue Memory"), STAT_ClientMoveQueueMemory, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Move Size"), STAT_MoveSize, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Move Bytes Copied"), STAT_MoveBytesCopied, STATGROUP_GMCReplicationComp)
+DECLARE_CYCLE_STAT(TEXT("Net Serialize State"), STAT_NetSerializeState, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialization Cache Hits"), STAT_SerializationCacheHits, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialization Cache Misses"), STAT_SerializationCacheMisses, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialization Cache Entries"), STAT_SerializationCacheEntries, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replication LOD Skips"), STAT_ReplicationLODSkips, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Unchanged Server States"), STAT_UnchangedServerStates, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Captured Server States"), STAT_CapturedServerStates, STATGROUP_GMCReplicationComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped Server State Captures"), STAT_SkippedServerStateCaptures, STATGROUP_GMCReplicationComp)
+
+#if ALLOW_CONSOLE && !NO_LOGGING
+
+// Binds the first NumToBind slots of a bound data type to the passed storage and flags them for replication in the state.
+template<typename TraitsType>
+static void BindBenchmarkSlots(
+  TGenBoundSlots<TraitsType>& Slots,
+  TArray<typename TraitsType::ValueType>& Storage,
+  FState& State,
+  int32 NumToBind
+)
+{
+  NumToBind = FMath::Min(NumToBind, static_cast<int32>(TraitsType::NumSlots));
+  Storage.SetNumZeroed(NumToBind);
+  for (int32 Slot = 0; Slot < NumToBind; ++Slot)
+  {
+    Slots.Bind(Storage[Slot]);
+    State.*TraitsType::ReplicateSlots[Slot] = true;
+  }
+  State.*TraitsType::NumBoundSlots = static_cast<uint8>(NumToBind);
+}
+
+// Microbenchmark for the bound data slot tables. The variables are spread over the float, int, vector and rotator slots (16 each). The
+// values equal the baseline so the change check has to visit every slot, and serialization is forced to write every slot.
+static void BenchmarkBoundData(int32 NumVariables, int32 NumIterations)
+{
+  TGenBoundSlots<FBoundSlotTraits_Float> FloatSlots;
+  TGenBoundSlots<FBoundSlotTraits_Int> IntSlots;
+  TGenBoundSlots<FBoundSlotTraits_Vector> VectorSlots;
+  TGenBoundSlots<FBoundSlotTraits_Rotator> RotatorSlots;
+  TArray<float> Floats;
+  TArray<int32> Ints;
+  TArray<FVector> Vectors;
+  TArray<FRotator> Rotators;
+  FState State;
+  FStateReduced Baseline;
+  FMove Move;
+
+  int32 NumRemaining = NumVariables;
+  BindBenchmarkSlots(FloatSlots, Floats, State, NumRemaining);
+  NumRemaining -= FloatSlots.Num();
+  BindBenchmarkSlots(IntSlots, Ints, State, NumRemaining);
+  NumRemaining -= IntSlots.Num();
+  BindBenchmarkSlots(VectorSlots, Vectors, State, NumRemaining);
+  NumRemaining -= VectorSlots.Num();
+  BindBenchmarkSlots(RotatorSlots, Rotators, State, NumRemaining);
+
+  // Prevents the compiler from discarding the results of the compare pass.
+  int32 NumChanged = 0;
+
+  double StartTime = FPlatformTime::Seconds();
+  for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+  {
+    FloatSlots.SaveToMove(Move, true);
+    IntSlots.SaveToMove(Move, true);
+    VectorSlots.SaveToMove(Move, true);
+    RotatorSlots.SaveToMove(Move, true);
+  }
+  const double SaveTime = FPlatformTime::Seconds() - StartTime;
+
+  StartTime = FPlatformTime::Seconds();
+  for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+  {
+    NumChanged += TGenBoundSlots<FBoundSlotTraits_Float>::HasStateChanged(State, Baseline);
+    NumChanged += TGenBoundSlots<FBoundSlotTraits_Int>::HasStateChanged(State, Baseline);
+    NumChanged += TGenBoundSlots<FBoundSlotTraits_Vector>::HasStateChanged(State, Baseline);
+    NumChanged += TGenBoundSlots<FBoundSlotTraits_Rotator>::HasStateChanged(State, Baseline);
+  }
+  const double CompareTime = FPlatformTime::Seconds() - StartTime;
+
+  FBitWriter Writer(0, true);
+  StartTime = FPlatformTime::Seconds();
+  for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+  {
+    Writer.Reset();
+    TGenBoundSlots<FBoundSlotTraits_Float>::SerializeState(State, Writer, &Baseline, true);
+    TGenBoundSlots<FBoundSlotTraits_Int>::SerializeState(State, Writer, &Baseline, true);
+    TGenBoundSlots<FBoundSlotTraits_Vector>::SerializeState(State, Writer, &Baseline, true);
+    TGenBoundSlots<FBoundSlotTraits_Rotator>::SerializeState(State, Writer, &Baseline, true);
+  }
+  const double SerializeTime = FPlatformTime::Seconds() - StartTime;
+
+  const double MicrosecondsPerIteration = 1000000. / FMath::Max(NumIterations, 1);
+  UE_LOG(
+    LogGMCReplication,
+    Display,
+    TEXT("Bound data benchmark (%d variables, %d iterations): save to move %.3f us, compare %.3f us, serialize %.3f us (%lld bits), changed %d."),
+    NumVariables,
+    NumIterations,
+    SaveTime * MicrosecondsPerIteration,
+    CompareTime * MicrosecondsPerIteration,
+    SerializeTime * MicrosecondsPerIteration,
+    Writer.GetNumBits(),
+    NumChanged
+  )
+}
+
+#endif
 
 namespace GMCCVars
 {
+  int32 NativeHookDispatch = 1;
+
 #if ALLOW_CONSOLE && !NO_LOGGING
 
+  FAutoConsoleVariableRef CVarNativeHookDispatch(
+    TEXT("gmc.NativeHookDispatch"),
+    NativeHookDispatch,
+    TEXT("Call the native implementation of move pipeline hooks directly if they are not overridden in Blueprint. Only affects pawns that ")
+    TEXT("begin play after the value was changed. 0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
   int32 StatNetMovementValues = 0;
   FAutoConsoleVariableRef CVarStatNetMovementValues(
     TEXT("gmc.StatNetMovementValues"),
@@ -126,6 +267,31 @@ namespace GMCCVars
     ECVF_Default
   );
 
+  FAutoConsoleCommand CmdBenchmarkBoundData(
+    TEXT("gmc.BenchmarkBoundData"),
+    TEXT("Measure the cost of saving, comparing and serializing bound data with 2, 16 and 64 bound variables and log the results."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+      for (const int32 NumVariables : {2, 16, 64})
+      {
+        BenchmarkBoundData(NumVariables, 10000);
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorld CmdDumpBoundDataBits(
+    TEXT("gmc.DumpBoundDataBits"),
+    TEXT("Log the number of bits each bound variable has used on the wire for all pawns of the current world and reset the counters."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+      if (!World) return;
+      for (TObjectIterator<UGenMovementReplicationComponent> It; It; ++It)
+      {
+        if (It->GetWorld() == World) It->LogBoundDataBits();
+      }
+    })
+  );
+
 #endif
 }
 
@@ -154,6 +320,27 @@ void UGenMovementReplicationComponent::PostInitProperties()
   ServerState_AutonomousProxy().VelocityQuantize = ServerState_SimulatedProxy().VelocityQuantize = VelocityQuantize;
   ServerState_AutonomousProxy().RotationQuantize = ServerState_SimulatedProxy().RotationQuantize = RotationQuantize;
   ServerState_AutonomousProxy().ControlRotationQuantize = ServerState_SimulatedProxy().ControlRotationQuantize = ControlRotationQuantize;
+
+  // Replication LOD only applies to simulated proxies. Index 0 of the levels holds the full detail quantization levels from above.
+  ReplicationLODLevels.Reset();
+  if (ReplicationLODTiers.Num() > 0)
+  {
+    GMC_CLOG(
+      ReplicationLODTiers.Num() > MAX_REPLICATION_LOD_TIERS,
+      Warning,
+      TEXT("Only the first %d replication LOD tiers are used."),
+      MAX_REPLICATION_LOD_TIERS
+    )
+    FReplicationLODTier& FullDetail = ReplicationLODLevels.AddDefaulted_GetRef();
+    FullDetail.MinDistance = 0.f;
+    FullDetail.UpdateInterval = 0.f;
+    FullDetail.LocationQuantize = LocationQuantize;
+    FullDetail.VelocityQuantize = VelocityQuantize;
+    FullDetail.RotationQuantize = RotationQuantize;
+    FullDetail.ControlRotationQuantize = ControlRotationQuantize;
+    ReplicationLODLevels.Append(ReplicationLODTiers.GetData(), FMath::Min(ReplicationLODTiers.Num(), MAX_REPLICATION_LOD_TIERS));
+  }
+  ServerState_SimulatedProxy().ReplicationLODLevels = ReplicationLODLevels.Num() > 0 ? &ReplicationLODLevels : nullptr;
 }
 
 void UGenMovementReplicationComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
@@ -176,6 +363,8 @@ void UGenMovementReplicationComponent::SetUpdatedComponent(USceneComponent* NewU
   GenPawnOwner = Cast<AGenPawn>(UpdatedComponent->GetOwner());
   checkGMC(GenPawnOwner)
   ServerState_SimulatedProxy().Owner = ServerState_AutonomousProxy().Owner = GenPawnOwner;
+  ServerState_AutonomousProxy().BaselineStore = &Server_BaselineStore_AutonomousProxy;
+  ServerState_SimulatedProxy().BaselineStore = &Server_BaselineStore_SimulatedProxy;
 }
 
 #if WITH_EDITOR
@@ -565,8 +754,10 @@ void UGenMovementReplicationComponent::BeginPlay()
   checkGMC(!PawnOwner->GetRootComponent()->GetIsReplicated())
 
   // Allocate all the memory we need to store states and moves to avoid overhead from resizing when adding or removing elements.
-  Client_MoveQueue.Reset(MoveQueueMaxSize);
-  StateQueue.Reset(StateQueueMaxSize);
+  Client_MoveQueue.Reset(FMath::Max(MoveQueueMaxSize, 2));
+  INC_MEMORY_STAT_BY(STAT_ClientMoveQueueMemory, Client_MoveQueue.GetAllocatedSize())
+  SET_DWORD_STAT(STAT_MoveSize, sizeof(FMove))
+  StateQueue.Reset(FMath::Max(StateQueueMaxSize, 1));
 
   // Correct invalid max delta time values if necessary.
   GMC_CLOG(
@@ -582,15 +773,27 @@ void UGenMovementReplicationComponent::BeginPlay()
   )
   MaxClientDeltaTime = FMath::Min(MaxClientDeltaTime, MaxServerDeltaTime);
 
+  GMC_CLOG(
+    LocalMove().bSerializeOutStateHash && (bUseClientLocation || bUseClientRotation || bUseClientControlRotation),
+    Error,
+    TEXT("Client moves only carry a hash of their out state, the client location/rotation/control rotation cannot be used on the server.")
+  )
+
   // Although not every pawn needs a simulated root component in all circumstances it is safer to just ensure it always exists.
   AddSimulatedRootComponent();
   checkGMC(SimulatedRootComponent)
 
+  // Must happen before the interpolation function is assigned.
+  CacheBlueprintHooks();
+
   // Assign the interpolation function.
   SetInterpolationMethod(InterpolationMethod);
 
   if (const auto World = GetWorld())
   {
+    WorldSubsystem = World->GetSubsystem<UGenWorldSubsystem>();
+    UpdateWorldRegistration();
+
     // If we want to verify the client timestamps, set the timer for resetting the client strikes.
     if (bVerifyClientTimestamps && IsRemotelyControlledServerPawn())
     {
@@ -651,9 +854,15 @@ void UGenMovementReplicationComponent::TickComponent(
     return;
   }
 
+  UpdateWorldRegistration();
+
   if (IsServerPawn())
   {
     Server_CheckNetRelevancy();
+    if (bUseServerMoveDejitterBuffer && IsRemotelyControlledServerPawn())
+    {
+      Server_TickDejitterBuffer(DeltaTime);
+    }
   }
   else if (IsClientPawn())
   {
@@ -676,30 +885,40 @@ void UGenMovementReplicationComponent::TickComponent(
 
       if (IsNetworkedServer())
       {
-        // Locally controlled server pawns (listen server) and AI controlled server bots save their state so clients can simulate it.
-        Server_SaveServerState(ROLE_SimulatedProxy, LocalMove());
-        // Quantize the local pawn state to account for replication compression, so we remain accurately synchronised on the client.
-        Server_QuantizePawnStateFrom(ServerState_SimulatedProxy());
-        // Replication of the server state happens in intervals so the client usually doesn't know about all intermediate values of a
-        // variable. If this is required for a certain property however we can force a net update to ensure the client is notified about
-        // every change.
-        if (Server_ShouldForceNetUpdate(ROLE_SimulatedProxy))
-        {
-          PawnOwner->ForceNetUpdate();
-        }
-        // A pawn cannot be rolled back without a populated state queue.
-        if (bRollbackServerPawns)
+        // The pawn is simulated every frame, but its state only needs to be materialized at the capture rate.
+        if (Server_ShouldCaptureServerState())
         {
-          AddToStateQueue(ServerState_SimulatedProxy());
+          // Locally controlled server pawns (listen server) and AI controlled server bots save their state so clients can simulate it.
+          Server_SaveServerState(ROLE_SimulatedProxy, LocalMove());
+          // Quantize the local pawn state to account for replication compression, so we remain accurately synchronised on the client.
+          Server_QuantizePawnStateFrom(ServerState_SimulatedProxy());
+          // Replication of the server state happens in intervals so the client usually doesn't know about all intermediate values of a
+          // variable. If this is required for a certain property however we can force a net update to ensure the client is notified about
+          // every change.
+          if (Server_ShouldForceNetUpdate(ROLE_SimulatedProxy))
+          {
+            PawnOwner->ForceNetUpdate();
+          }
+          // A pawn cannot be rolled back without a populated state queue.
+          if (bRollbackServerPawns)
+          {
+            AddToStateQueue(ServerState_SimulatedProxy());
+          }
+          // Locks hold values in the saved state, so they only need to expire when a state is saved.
+          Server_ResetLockedBoundInputFlags();
+          Server_ResetLockedBoundData();
         }
-        Server_ResetLockedBoundInputFlags();
-        Server_ResetLockedBoundData();
+        // Remember where the pawn ended up (after quantization) to detect teleports before the next move.
+        Server_LastCaptureCheckLocation = PawnOwner->GetActorLocation();
       }
     }
     else if (IsAutonomousProxy())
     {
       SCOPE_CYCLE_COUNTER(STAT_TickAutonomousProxy)
 
+      // Usually resolved by the world subsystem before any actors tick, unless a server state was received after that.
+      Client_ResolvePendingCorrection();
+
       // As a client and need to maintain a move queue for replication and move execution.
       bool bStartedNewMove{false};
       bool bMoveQueueFull{false};
@@ -722,7 +941,7 @@ void UGenMovementReplicationComponent::TickComponent(
         {
           // If we added a new move to the queue this tick we can send the previous one (which is now complete). This is the only chance
           // a move gets to be send to the server, afterwards it will/should soon be cleared from the queue with a server update.
-          Client_PendingMoves.Emplace(PreviousMove);
+          ++Client_NumPendingMoves;
         }
       }
       else if (Client_MoveQueue.Num() == 1 && !bMoveDiscarded)
@@ -749,6 +968,15 @@ void UGenMovementReplicationComponent::TickComponent(
       // Communicate with the server.
       if (Client_ShouldSendMoves())
       {
+        if (bUseUnreliableMoveTransport)
+        {
+          // Each batch needs to be self-contained when it may get lost, so older unacknowledged moves are sent again.
+          Client_AddRedundantMoves();
+        }
+        else
+        {
+          Client_CollectPendingMoves(0);
+        }
         // If a value in the move is different from the last one that was sent, it needs to be serialized again. Otherwise only 1 bit will
         // be sent to indicate to the server that the previously received value can be used again because it hasn't changed.
         Client_DetermineValuesToSend();
@@ -756,7 +984,8 @@ void UGenMovementReplicationComponent::TickComponent(
         // replicated back to the client for verification and potentially corrections.
         Client_SendMovesToServer();
         DEBUG_LOG_CLIENT_SENT_MOVES
-        // After sending we need to clear the array, we don't want to send the same move twice.
+        // After sending we need to clear the pending moves, we don't want to send the same move twice.
+        Client_NumPendingMoves = 0;
         Client_PendingMoves.Reset();
       }
     }
@@ -825,51 +1054,85 @@ void UGenMovementReplicationComponent::Client_OnRepServerState_AutonomousProxy()
   DEBUG_LOG_MOVE_QUEUE_SIZE_BEFORE_CLEARING
   FMove SourceMove = Client_ClearAcknowledgedMoves(ServerState_AutonomousProxy().Timestamp);
   DEBUG_LOG_MOVE_QUEUE_SIZE_AFTER_CLEARING
-  if (Client_ShouldReplay(SourceMove))
+  const bool bRequiresReplay = Client_ShouldReplay(SourceMove);
+  if (bCoalesceClientCorrections && WorldSubsystem)
   {
-    GMC_CLOG(
-      !bAlwaysReplay,
-      VeryVerbose,
-      TEXT("A replay was triggered - current client state   : Velocity = % 15.6f, % 15.6f, % 15.6f | Location = % 15.6f, % 15.6f, % 15.6f | Rotation = % 15.6f, % 15.6f, % 15.6f | ControlRotation = % 15.6f, % 15.6f, % 15.6f"),
-      Velocity.X,
-      Velocity.Y,
-      Velocity.Z,
-      PawnOwner->GetActorLocation().X,
-      PawnOwner->GetActorLocation().Y,
-      PawnOwner->GetActorLocation().Z,
-      PawnOwner->GetActorRotation().Roll,
-      PawnOwner->GetActorRotation().Pitch,
-      PawnOwner->GetActorRotation().Yaw,
-      PawnOwner->GetControlRotation().Roll,
-      PawnOwner->GetControlRotation().Pitch,
-      PawnOwner->GetControlRotation().Yaw
-    )
-    DEBUG_NET_CORRECTION_ORIGINAL_CLIENT_LOCATION
-    DEBUG_LOG_REPLAY_CLIENT_STATE_INITIAL
-    DEBUG_LOG_REPLAY_SERVER_STATE
-    Client_AdoptServerState(ServerState_AutonomousProxy().bContainsFullRepBatch, SourceMove);
-    DEBUG_NET_CORRECTION_UPDATED_CLIENT_LOCATION
-    Client_ReplayMoves();
-    DEBUG_NET_CORRECTION_REPLAYED_CLIENT_LOCATION
-    DEBUG_NET_CORRECTION_DRAW_CLIENT_SHAPES
-    GMC_CLOG(
-      !bAlwaysReplay,
-      VeryVerbose,
-      TEXT("Replay finished        - corrected client state : Velocity = % 15.6f, % 15.6f, % 15.6f | Location = % 15.6f, % 15.6f, % 15.6f | Rotation = % 15.6f, % 15.6f, % 15.6f | ControlRotation = % 15.6f, % 15.6f, % 15.6f"),
-      Velocity.X,
-      Velocity.Y,
-      Velocity.Z,
-      PawnOwner->GetActorLocation().X,
-      PawnOwner->GetActorLocation().Y,
-      PawnOwner->GetActorLocation().Z,
-      PawnOwner->GetActorRotation().Roll,
-      PawnOwner->GetActorRotation().Pitch,
-      PawnOwner->GetActorRotation().Yaw,
-      PawnOwner->GetControlRotation().Roll,
-      PawnOwner->GetControlRotation().Pitch,
-      PawnOwner->GetControlRotation().Yaw
-    )
-    GMC_CLOG(!bAlwaysReplay, Verbose, TEXT("Replayed %d moves."), Client_MoveQueue.Num())
+    // Only the newest server state of this frame is relevant for the correction, so we just remember the result and let the world subsystem
+    // resolve it once all packets of the frame were received. The moves acknowledged by this state were already cleared above.
+    if (Client_bHasPendingCorrection && Client_bPendingCorrectionRequiresReplay)
+    {
+      // The replay for the previous state is superseded by this one.
+      INC_DWORD_STAT(STAT_CoalescedReplays)
+    }
+    Client_bHasPendingCorrection = true;
+    Client_bPendingCorrectionRequiresReplay = bRequiresReplay;
+    Client_PendingCorrectionSourceMove = MoveTemp(SourceMove);
+    WorldSubsystem->QueueClientCorrection(this);
+    return;
+  }
+  if (bRequiresReplay)
+  {
+    Client_CorrectFromServerState(SourceMove);
+  }
+}
+
+void UGenMovementReplicationComponent::Client_CorrectFromServerState(const FMove& SourceMove)
+{
+  checkGMC(IsAutonomousProxy())
+
+  GMC_CLOG(
+    !bAlwaysReplay,
+    VeryVerbose,
+    TEXT("A replay was triggered - current client state   : Velocity = % 15.6f, % 15.6f, % 15.6f | Location = % 15.6f, % 15.6f, % 15.6f | Rotation = % 15.6f, % 15.6f, % 15.6f | ControlRotation = % 15.6f, % 15.6f, % 15.6f"),
+    Velocity.X,
+    Velocity.Y,
+    Velocity.Z,
+    PawnOwner->GetActorLocation().X,
+    PawnOwner->GetActorLocation().Y,
+    PawnOwner->GetActorLocation().Z,
+    PawnOwner->GetActorRotation().Roll,
+    PawnOwner->GetActorRotation().Pitch,
+    PawnOwner->GetActorRotation().Yaw,
+    PawnOwner->GetControlRotation().Roll,
+    PawnOwner->GetControlRotation().Pitch,
+    PawnOwner->GetControlRotation().Yaw
+  )
+  DEBUG_NET_CORRECTION_ORIGINAL_CLIENT_LOCATION
+  DEBUG_LOG_REPLAY_CLIENT_STATE_INITIAL
+  DEBUG_LOG_REPLAY_SERVER_STATE
+  Client_AdoptServerState(ServerState_AutonomousProxy().bContainsFullRepBatch, SourceMove);
+  DEBUG_NET_CORRECTION_UPDATED_CLIENT_LOCATION
+  Client_ReplayMoves();
+  DEBUG_NET_CORRECTION_REPLAYED_CLIENT_LOCATION
+  DEBUG_NET_CORRECTION_DRAW_CLIENT_SHAPES
+  GMC_CLOG(
+    !bAlwaysReplay,
+    VeryVerbose,
+    TEXT("Replay finished        - corrected client state : Velocity = % 15.6f, % 15.6f, % 15.6f | Location = % 15.6f, % 15.6f, % 15.6f | Rotation = % 15.6f, % 15.6f, % 15.6f | ControlRotation = % 15.6f, % 15.6f, % 15.6f"),
+    Velocity.X,
+    Velocity.Y,
+    Velocity.Z,
+    PawnOwner->GetActorLocation().X,
+    PawnOwner->GetActorLocation().Y,
+    PawnOwner->GetActorLocation().Z,
+    PawnOwner->GetActorRotation().Roll,
+    PawnOwner->GetActorRotation().Pitch,
+    PawnOwner->GetActorRotation().Yaw,
+    PawnOwner->GetControlRotation().Roll,
+    PawnOwner->GetControlRotation().Pitch,
+    PawnOwner->GetControlRotation().Yaw
+  )
+  GMC_CLOG(!bAlwaysReplay, Verbose, TEXT("Replayed %d moves."), Client_MoveQueue.Num())
+}
+
+void UGenMovementReplicationComponent::Client_ResolvePendingCorrection()
+{
+  if (!Client_bHasPendingCorrection) return;
+  Client_bHasPendingCorrection = false;
+  if (!IsAutonomousProxy()) return;
+  if (Client_bPendingCorrectionRequiresReplay)
+  {
+    Client_CorrectFromServerState(Client_PendingCorrectionSourceMove);
   }
 }
 
@@ -885,6 +1148,20 @@ void UGenMovementReplicationComponent::Client_OnRepServerState_SimulatedProxy()
 
 void UGenMovementReplicationComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
+  // Queued and buffered client moves that were not executed yet are dropped.
+  Server_QueuedMoveBatches.Empty();
+  Server_DejitterBuffer.Empty();
+  Client_bHasPendingCorrection = false;
+  Client_MoveQueue.Empty();
+  Client_NumPendingMoves = 0;
+  DEC_MEMORY_STAT_BY(STAT_ClientMoveQueueMemory, Client_MoveQueue.GetAllocatedSize())
+
+  if (WorldSubsystem)
+  {
+    WorldSubsystem->UnregisterReplicationComponent(this, RegisteredRole);
+    RegisteredRole = EGenReplicationRole::None;
+  }
+
   // Clear timers when this object gets destroyed.
   if (const auto World = GetWorld())
   {
@@ -901,6 +1178,19 @@ void UGenMovementReplicationComponent::PreReplication(IRepChangedPropertyTracker
   Super::PreReplication(ChangedPropertyTracker);
 
   Server_MaintainSerializationMap();
+  Server_UpdateReplicationLOD();
+
+  // The simulated proxy server state is serialized for all connections at once right before the first state is net serialized this frame.
+  if (
+    WorldSubsystem
+    && !bServer_SerializationCacheQueued
+    && Server_BaselineStore_SimulatedProxy.Connections.Num() > 0
+    && Server_CanCacheSerialization()
+  )
+  {
+    bServer_SerializationCacheQueued = true;
+    WorldSubsystem->QueueSerializationCache(this);
+  }
 }
 
 void UGenMovementReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -970,7 +1260,7 @@ void UGenMovementReplicationComponent::LoadMove(const FMove& MoveToLoad, EImmedi
   LoadBoundInputFlagsFromMove(MoveToLoad);
   LoadInBoundDataFromMove(MoveToLoad);
 
-  OnImmediateStateLoaded(Context);
+  GMC_CALL_HOOK(OnImmediateStateLoaded, Context);
 }
 
 FVector UGenMovementReplicationComponent::ExecuteMove(const FMove& Move, EImmediateContext Context)
@@ -984,6 +1274,7 @@ FVector UGenMovementReplicationComponent::ExecuteMove(const FMove& Move, EImmedi
   // Create a mutable copy of the move so we can update the delta time and velocity per iteration, and possibly overwrite NANs for move
   // execution.
   FMove IterationMove = Move;
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
   if (IsRemotelyControlledServerPawn() && bEnsureValidMoveData)
   {
     // On the server, move properties that have serialization disabled and are not sent by the client are marked with NAN during unpacking.
@@ -1221,7 +1512,7 @@ void UGenMovementReplicationComponent::SetLocalPawnState(const FState& State, EI
   LoadInputModeFromState(State);
   LoadBoundInputFlagsFromState(State);
   LoadBoundDataFromState(State);
-  OnImmediateStateLoaded(Context);
+  GMC_CALL_HOOK(OnImmediateStateLoaded, Context);
 }
 
 void UGenMovementReplicationComponent::SetReplicatedPawnState(
@@ -1260,7 +1551,7 @@ void UGenMovementReplicationComponent::SetReplicatedPawnState(
   LoadReplicatedInputModeFromState(SmoothState);
   LoadReplicatedBoundInputFlagsFromState(SmoothState);
   LoadReplicatedBoundDataFromState(SmoothState);
-  OnSimulatedStateLoaded(SmoothState, StartState, TargetState, Context);
+  GMC_CALL_HOOK(OnSimulatedStateLoaded, SmoothState, StartState, TargetState, Context);
 }
 
 FState& UGenMovementReplicationComponent::GetServerStateFromRole(ENetRole RecipientRole)
@@ -1359,7 +1650,7 @@ FString UGenMovementReplicationComponent::GetInputModeAsString(EInputMode InputM
 
 void UGenMovementReplicationComponent::Server_SendMoves_Implementation(const TArray<FMove>& RemoteMoves)
 {
-  Server_ProcessClientMoves(RemoteMoves);
+  Server_ReceiveClientMoves(RemoteMoves);
 }
 
 bool UGenMovementReplicationComponent::Server_SendMoves_Validate(const TArray<FMove>& RemoteMoves)
@@ -1367,19 +1658,324 @@ bool UGenMovementReplicationComponent::Server_SendMoves_Validate(const TArray<FM
   return Server_ValidateRemoteMoves(RemoteMoves);
 }
 
+void UGenMovementReplicationComponent::Server_SendMovesUnreliable_Implementation(const TArray<FMove>& RemoteMoves)
+{
+  Server_ReceiveClientMoves(RemoteMoves);
+}
+
+bool UGenMovementReplicationComponent::Server_SendMovesUnreliable_Validate(const TArray<FMove>& RemoteMoves)
+{
+  return Server_ValidateRemoteMoves(RemoteMoves);
+}
+
+void UGenMovementReplicationComponent::Server_ReceiveClientMoves(const TArray<FMove>& RemoteMoves)
+{
+  if (!bUseUnreliableMoveTransport)
+  {
+    Server_ProcessOrQueueClientMoves(RemoteMoves);
+    return;
+  }
+
+  // The batch starts with redundant copies of moves that may have been received (and processed) already. The moves are delta serialized
+  // against each other within the batch, so all of them have to be resolved in order even if they are discarded afterwards.
+  // The moves are resolved in place against their already resolved predecessor, so each move is only copied once.
+  TArray<FMove> NewMoves = RemoteMoves;
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, NewMoves.Num() * sizeof(FMove))
+  for (int32 Index = 1; Index < NewMoves.Num(); ++Index)
+  {
+    Server_ResolveRedundantMoveValues(NewMoves[Index], NewMoves[Index - 1]);
+  }
+  // Unreliable RPCs may arrive out of order, so anything that is not newer than the last received move is discarded.
+  const float NewestReceivedTimestamp = Server_GetNewestReceivedMoveTimestamp();
+  NewMoves.RemoveAll([NewestReceivedTimestamp](const FMove& Move) { return Move.Timestamp <= NewestReceivedTimestamp; });
+
+  GMC_CLOG(
+    NewMoves.Num() < RemoteMoves.Num(),
+    VeryVerbose,
+    TEXT("Discarded %d of %d received client moves that were already processed."),
+    RemoteMoves.Num() - NewMoves.Num(),
+    RemoteMoves.Num()
+  )
+
+  if (NewMoves.Num() > 0)
+  {
+    Server_ProcessOrQueueClientMoves(NewMoves);
+  }
+}
+
+void UGenMovementReplicationComponent::Server_ProcessOrQueueClientMoves(const TArray<FMove>& RemoteMoves)
+{
+  if (bUseServerMoveDejitterBuffer)
+  {
+    // The moves are executed from the tick function once their timestamp is due.
+    Server_AddToDejitterBuffer(RemoteMoves);
+    return;
+  }
+  if (bDeferServerMoveProcessing && WorldSubsystem)
+  {
+    // The moves are executed during the next deferred server move phase together with the moves of all other pawns.
+    Server_QueuedMoveBatches.AddDefaulted_GetRef().Moves = RemoteMoves;
+    WorldSubsystem->QueueClientMoveBatches(this);
+    return;
+  }
+  Server_ProcessClientMoves(RemoteMoves);
+}
+
+float UGenMovementReplicationComponent::Server_GetNewestReceivedMoveTimestamp() const
+{
+  for (int32 Index = Server_DejitterBuffer.Num() - 1; Index >= 0; --Index)
+  {
+    if (Server_DejitterBuffer[Index].Moves.Num() > 0)
+    {
+      return Server_DejitterBuffer[Index].Moves.Last().Timestamp;
+    }
+  }
+  for (int32 Index = Server_QueuedMoveBatches.Num() - 1; Index >= 0; --Index)
+  {
+    if (Server_QueuedMoveBatches[Index].Moves.Num() > 0)
+    {
+      return Server_QueuedMoveBatches[Index].Moves.Last().Timestamp;
+    }
+  }
+  return Server_LastUnpackedClientMove.Timestamp;
+}
+
+void UGenMovementReplicationComponent::Server_PrepareQueuedMoveBatches()
+{
+  for (auto& Batch : Server_QueuedMoveBatches)
+  {
+    Batch.bTimestampsValid = !bVerifyClientTimestamps || Server_VerifyTimestamps(Batch.Moves);
+  }
+}
+
+FBox UGenMovementReplicationComponent::Server_GetQueuedMovesSweptBounds(float Margin) const
+{
+  // Accumulate the delta time the same way the moves will be unpacked (@see Server_UnpackClientMove).
+  float AccumulatedDeltaTime{0.f};
+  float PreviousTimestamp = Server_LastUnpackedClientMove.Timestamp;
+  for (const auto& Batch : Server_QueuedMoveBatches)
+  {
+    for (const auto& Move : Batch.Moves)
+    {
+      AccumulatedDeltaTime += FMath::Clamp(Move.Timestamp - PreviousTimestamp, MIN_DELTA_TIME, MaxServerDeltaTime);
+      PreviousTimestamp = Move.Timestamp;
+    }
+  }
+  const float MaxSpeed = FMath::Max(GetMaxSpeed(), Velocity.Size());
+  const FVector Location = PawnOwner->GetActorLocation();
+  const FBox CurrentBounds = UpdatedComponent ? UpdatedComponent->Bounds.GetBox() : FBox(Location, Location);
+  return CurrentBounds.ExpandBy(MaxSpeed * AccumulatedDeltaTime + Margin);
+}
+
+void UGenMovementReplicationComponent::Server_ExecuteQueuedMoveBatches(bool bDeferGameThreadWork)
+{
+  Server_bDeferGameThreadWork = bDeferGameThreadWork;
+  for (const auto& Batch : Server_QueuedMoveBatches)
+  {
+    if (Batch.Moves.Num() > 0)
+    {
+      Server_ExecuteClientMoves(Batch.Moves, Batch.bTimestampsValid);
+    }
+  }
+  Server_QueuedMoveBatches.Reset();
+  Server_bDeferGameThreadWork = false;
+}
+
+void UGenMovementReplicationComponent::Server_ApplyDeferredGameThreadWork()
+{
+  check(IsInGameThread())
+  checkGMC(!Server_bDeferGameThreadWork)
+  if (Server_bDeferredConspicuousClient)
+  {
+    Server_bDeferredConspicuousClient = false;
+    Server_HandleConspicuousClient();
+  }
+  if (Server_bDeferredForceNetUpdate)
+  {
+    Server_bDeferredForceNetUpdate = false;
+    PawnOwner->ForceNetUpdate();
+  }
+}
+
+void UGenMovementReplicationComponent::Server_ForceNetUpdate()
+{
+  if (Server_bDeferGameThreadWork)
+  {
+    // Registers the actor with the net driver, which is only allowed on the game thread.
+    Server_bDeferredForceNetUpdate = true;
+    return;
+  }
+  PawnOwner->ForceNetUpdate();
+}
+
+bool UGenMovementReplicationComponent::CanExecuteMovesConcurrently() const
+{
+  if (!bAllowConcurrentMoveExecution) return false;
+  // Rolling back moves other pawns and smoothed listen server pawns move their simulated root component directly, neither can be deferred.
+  if (bRollbackServerPawns || IsSmoothedListenServerPawn()) return false;
+  // Only the transform updates of the updated component are deferred, so it has to be the root that the actor is moved with.
+  if (!UpdatedComponent || UpdatedComponent != PawnOwner->GetRootComponent()) return false;
+  // The Blueprint VM can only run on the game thread.
+  if (HasBlueprintHooks()) return false;
+#if ALLOW_CONSOLE && !NO_LOGGING
+  // Debug shapes can only be drawn on the game thread.
+  if (GMCCVars::ShowClientLocationErrors != 0) return false;
+#endif
+  return true;
+}
+
+void UGenMovementReplicationComponent::Server_AddToDejitterBuffer(const TArray<FMove>& RemoteMoves)
+{
+  checkGMC(RemoteMoves.Num() > 0)
+
+  // The timestamps are verified on arrival since the verification depends on the current server time.
+  auto& Batch = Server_DejitterBuffer.AddDefaulted_GetRef();
+  Batch.Moves = RemoteMoves;
+  Batch.bTimestampsValid = !bVerifyClientTimestamps || Server_VerifyTimestamps(RemoteMoves);
+
+  // Estimate the jitter from the difference between how far apart the batches arrived and how far apart they were sent.
+  const auto World = GetWorld();
+  const float ArrivalTime = World ? World->GetRealTimeSeconds() : 0.f;
+  const float ArrivalTimestamp = RemoteMoves.Last().Timestamp;
+  if (Server_DejitterLastArrivalTime >= 0.f)
+  {
+    const float Deviation = (ArrivalTime - Server_DejitterLastArrivalTime) - (ArrivalTimestamp - Server_DejitterLastArrivalTimestamp);
+    constexpr float VARIANCE_SMOOTHING = 0.05f;
+    Server_DejitterJitterVariance = FMath::Lerp(Server_DejitterJitterVariance, FMath::Square(Deviation), VARIANCE_SMOOTHING);
+  }
+  Server_DejitterLastArrivalTime = ArrivalTime;
+  Server_DejitterLastArrivalTimestamp = ArrivalTimestamp;
+
+  // Covering two standard deviations of the jitter absorbs the vast majority of late packets.
+  constexpr float JITTER_DEVIATIONS = 2.f;
+  const float AdaptiveDepth = JITTER_DEVIATIONS * FMath::Sqrt(Server_DejitterJitterVariance);
+  Server_DejitterTargetDepth = FMath::Min(
+    bAdaptDejitterBufferDepth ? FMath::Max(DejitterBufferTargetDepth, AdaptiveDepth) : DejitterBufferTargetDepth,
+    DejitterBufferMaxDepth
+  );
+
+  if (Server_DejitterPlayoutTime < 0.f || Server_bDejitterBufferStarved)
+  {
+    // Start playing out the moves after the target depth was buffered.
+    Server_DejitterPlayoutTime = RemoteMoves[0].Timestamp - Server_DejitterTargetDepth;
+    Server_bDejitterBufferStarved = false;
+  }
+}
+
+void UGenMovementReplicationComponent::Server_TickDejitterBuffer(float DeltaTime)
+{
+  checkGMC(IsRemotelyControlledServerPawn())
+  if (Server_DejitterPlayoutTime < 0.f)
+  {
+    // Nothing was received yet.
+    return;
+  }
+
+  const float NewestTimestamp = Server_GetNewestReceivedMoveTimestamp();
+  const float Occupancy = NewestTimestamp - Server_DejitterPlayoutTime;
+  if (Occupancy > DejitterBufferMaxDepth)
+  {
+    // Overrun, skip ahead so the buffer is back at its target depth. The skipped moves are executed right away.
+    INC_DWORD_STAT(STAT_DejitterOverruns)
+    GMC_LOG(VeryVerbose, TEXT("Dejitter buffer overrun (%f s buffered)."), Occupancy)
+    Server_DejitterPlayoutTime = NewestTimestamp - Server_DejitterTargetDepth;
+  }
+  else
+  {
+    // Play out slightly faster or slower to drift towards the target depth without noticeable changes in speed.
+    constexpr float MAX_RATE_ADJUSTMENT = 0.05f;
+    const float DepthError =
+      Server_DejitterTargetDepth > 0.f ? (Occupancy - Server_DejitterTargetDepth) / Server_DejitterTargetDepth : 0.f;
+    const float PlayoutRate = 1.f + FMath::Clamp(DepthError * MAX_RATE_ADJUSTMENT, -MAX_RATE_ADJUSTMENT, MAX_RATE_ADJUSTMENT);
+    Server_DejitterPlayoutTime += DeltaTime * PlayoutRate;
+  }
+
+  // Execute all moves that are due.
+  while (Server_DejitterBuffer.Num() > 0)
+  {
+    auto& Batch = Server_DejitterBuffer[0];
+    int32 NumDueMoves{0};
+    while (NumDueMoves < Batch.Moves.Num() && Batch.Moves[NumDueMoves].Timestamp <= Server_DejitterPlayoutTime) ++NumDueMoves;
+    if (NumDueMoves == 0 && Batch.Moves.Num() > 0) break;
+    if (NumDueMoves == Batch.Moves.Num())
+    {
+      const FQueuedMoveBatch DueBatch = MoveTemp(Batch);
+      Server_DejitterBuffer.RemoveAt(0, 1, false);
+      if (DueBatch.Moves.Num() > 0) Server_ExecuteClientMoves(DueBatch.Moves, DueBatch.bTimestampsValid);
+    }
+    else
+    {
+      const TArray<FMove> DueMoves(Batch.Moves.GetData(), NumDueMoves);
+      INC_DWORD_STAT_BY(STAT_MoveBytesCopied, NumDueMoves * sizeof(FMove))
+      Batch.Moves.RemoveAt(0, NumDueMoves, false);
+      Server_ExecuteClientMoves(DueMoves, Batch.bTimestampsValid);
+      break;
+    }
+  }
+
+  if (Server_DejitterBuffer.Num() == 0 && Server_DejitterPlayoutTime > NewestTimestamp && !Server_bDejitterBufferStarved)
+  {
+    // Underrun, the buffer ran dry before new moves arrived. The next moves that arrive are buffered up to the target depth again.
+    INC_DWORD_STAT(STAT_DejitterUnderruns)
+    GMC_LOG(VeryVerbose, TEXT("Dejitter buffer underrun."))
+    Server_bDejitterBufferStarved = true;
+  }
+
+  INC_DWORD_STAT_BY(STAT_DejitterBufferedTime, FMath::RoundToInt(GetDejitterBufferOccupancy() * 1000.f))
+  INC_DWORD_STAT_BY(STAT_DejitterTargetDepth, FMath::RoundToInt(Server_DejitterTargetDepth * 1000.f))
+#if STATS
+  int32 NumBufferedMoves{0};
+  for (const auto& Batch : Server_DejitterBuffer) NumBufferedMoves += Batch.Moves.Num();
+  INC_DWORD_STAT_BY(STAT_DejitterBufferedMoves, NumBufferedMoves)
+#endif
+}
+
+void UGenMovementReplicationComponent::Server_ResolveRedundantMoveValues(FMove& Move, const FMove& PreviousMove)
+{
+  if (!Move.bHasNewInputVectorX)            Move.InputVector.X            = PreviousMove.InputVector.X;
+  if (!Move.bHasNewInputVectorY)            Move.InputVector.Y            = PreviousMove.InputVector.Y;
+  if (!Move.bHasNewInputVectorZ)            Move.InputVector.Z            = PreviousMove.InputVector.Z;
+  if (!Move.bHasNewOutLocation)             Move.OutLocation              = PreviousMove.OutLocation;
+  if (!Move.bHasNewOutVelocity)             Move.OutVelocity              = PreviousMove.OutVelocity;
+  if (!Move.bHasNewOutRotationRoll)         Move.OutRotation.Roll         = PreviousMove.OutRotation.Roll;
+  if (!Move.bHasNewOutRotationPitch)        Move.OutRotation.Pitch        = PreviousMove.OutRotation.Pitch;
+  if (!Move.bHasNewOutRotationYaw)          Move.OutRotation.Yaw          = PreviousMove.OutRotation.Yaw;
+  if (!Move.bHasNewOutControlRotationRoll)  Move.OutControlRotation.Roll  = PreviousMove.OutControlRotation.Roll;
+  if (!Move.bHasNewOutControlRotationPitch) Move.OutControlRotation.Pitch = PreviousMove.OutControlRotation.Pitch;
+  if (!Move.bHasNewOutControlRotationYaw)   Move.OutControlRotation.Yaw   = PreviousMove.OutControlRotation.Yaw;
+  // The move is complete now and must not be filled with values from the last unpacked move when it gets processed, since that one is not
+  // necessarily its predecessor.
+  Move.bHasNewInputVectorX = true;
+  Move.bHasNewInputVectorY = true;
+  Move.bHasNewInputVectorZ = true;
+  Move.bHasNewOutLocation = true;
+  Move.bHasNewOutVelocity = true;
+  Move.bHasNewOutRotationRoll = true;
+  Move.bHasNewOutRotationPitch = true;
+  Move.bHasNewOutRotationYaw = true;
+  Move.bHasNewOutControlRotationRoll = true;
+  Move.bHasNewOutControlRotationPitch = true;
+  Move.bHasNewOutControlRotationYaw = true;
+}
+
 void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FMove>& RemoteMoves)
+{
+  Server_ExecuteClientMoves(RemoteMoves, !bVerifyClientTimestamps || Server_VerifyTimestamps(RemoteMoves));
+}
+
+void UGenMovementReplicationComponent::Server_ExecuteClientMoves(const TArray<FMove>& RemoteMoves, bool bTimestampsValid)
 {
   SCOPE_CYCLE_COUNTER(STAT_ProcessClientMoves)
 
   checkGMC(RemoteMoves.Num() > 0)
   checkGMC(!Server_bIsExecutingRemoteMoves)
 
-  // Verify the timestamps of the moves that the client sent. If they are determined to be not valid and the client received more strikes
-  // than allowed, the moves won't be executed. The strikes get reset periodically with a timer function (@see Server_ResetClientStrikes).
+  // If the timestamps of the moves that the client sent were determined to be not valid and the client received more strikes than allowed,
+  // the moves won't be executed. The strikes get reset periodically with a timer function (@see Server_ResetClientStrikes).
   bool bClientCredible = true;
   if (bVerifyClientTimestamps)
   {
-    if (!Server_VerifyTimestamps(RemoteMoves))
+    if (!bTimestampsValid)
     {
       ++Server_ClientStrikeCount;
       if (Server_ClientStrikeCount > MaxStrikeCount)
@@ -1387,7 +1983,15 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
         // Client exceeds the max strike count and the move timestamps were determined to be not valid, don't execute this batch.
         bClientCredible = false;
         Server_bLastClientMoveWasValid = false;
-        Server_HandleConspicuousClient();
+        if (Server_bDeferGameThreadWork)
+        {
+          // The event may be implemented in Blueprint.
+          Server_bDeferredConspicuousClient = true;
+        }
+        else
+        {
+          Server_HandleConspicuousClient();
+        }
         GMC_LOG(
           Warning,
           TEXT("Remote moves were not valid and client is exceeding the max strike count within the current verification interval ")
@@ -1417,7 +2021,7 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
       RollbackPawnList = GatherRollbackPawns();
     }
 
-    Server_PreRemoteMovesProcessing();
+    GMC_CALL_HOOK(Server_PreRemoteMovesProcessing);
 
     for (int32 Index = 0; Index < RemoteMoves.Num(); ++Index)
     {
@@ -1433,7 +2037,8 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
         RollbackPawns(ClientMove.Timestamp - SimulationDelay, RollbackPawnList, ESimulatedContext::RollingBackServerPawn);
       }
 
-      Server_PreRemoteMoveExecution(ClientMove);
+      GMC_CALL_HOOK(Server_PreRemoteMoveExecution, ClientMove);
+      OnServerPreRemoteMoveExecution.Broadcast(ClientMove);
 
       // Move the client's pawn on the server.
       ExecuteMove(ClientMove, EImmediateContext::RemoteServerPawnExecutingMove);
@@ -1456,15 +2061,22 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
         }
       }
 
-      Server_ResolveClientDiscrepancy(
-        PawnOwner->GetActorLocation(),
-        PawnOwner->GetActorRotation(),
-        PawnOwner->GetControlRotation(),
-        GetValidActorLocation(ClientMove.OutLocation),
-        GetValidActorRotation(ClientMove.OutRotation),
-        GetValidControlRotation(ClientMove.OutControlRotation),
-        ClientMove.Timestamp
-      );
+      if (ClientMove.bSerializeOutStateHash)
+      {
+        Server_ResolveClientDiscrepancyFromHash(ClientMove);
+      }
+      else
+      {
+        Server_ResolveClientDiscrepancy(
+          PawnOwner->GetActorLocation(),
+          PawnOwner->GetActorRotation(),
+          PawnOwner->GetControlRotation(),
+          GetValidActorLocation(ClientMove.OutLocation),
+          GetValidActorRotation(ClientMove.OutRotation),
+          GetValidControlRotation(ClientMove.OutControlRotation),
+          ClientMove.Timestamp
+        );
+      }
       DEBUG_LOG_SERVER_EXECUTED_MOVE_RESOLVED
       DEBUG_SHOW_CLIENT_LOCATION_ERRORS_ON_SERVER
 
@@ -1494,7 +2106,7 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
 
       if (Server_ShouldForceNetUpdate(ROLE_AutonomousProxy))
       {
-        PawnOwner->ForceNetUpdate();
+        Server_ForceNetUpdate();
       }
 
       // Save the final state for the simulated proxy. Although both states should contain the same pawn data afterwards they probably have
@@ -1505,7 +2117,7 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
 
       if (Server_ShouldForceNetUpdate(ROLE_SimulatedProxy))
       {
-        PawnOwner->ForceNetUpdate();
+        Server_ForceNetUpdate();
       }
 
       // Smoothing and rolling back pawns requires the state queue to be filled. Keep in mind that pawns are also considered smoothed when
@@ -1515,10 +2127,11 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
         AddToStateQueue(Server_GetFilteredServerState());
       }
 
-      Server_PostRemoteMoveExecution(ClientMove);
+      GMC_CALL_HOOK(Server_PostRemoteMoveExecution, ClientMove);
+      OnServerPostRemoteMoveExecution.Broadcast(ClientMove);
     }
 
-    Server_OnRemoteMovesProcessed();
+    GMC_CALL_HOOK(Server_OnRemoteMovesProcessed);
 
     if (bRollbackServerPawns)
     {
@@ -1545,6 +2158,7 @@ void UGenMovementReplicationComponent::Server_ProcessClientMoves(const TArray<FM
 FMove UGenMovementReplicationComponent::Server_UnpackClientMove(const FMove& ClientMove)
 {
   FMove UnpackedMove = ClientMove;
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
   // We calculate the delta time of client moves from the timestamps that we have received.
   const float CalculatedDeltaTime = ClientMove.Timestamp - Server_LastUnpackedClientMove.Timestamp;
   const float ClampedDeltaTime = FMath::Clamp(CalculatedDeltaTime, MIN_DELTA_TIME, MaxServerDeltaTime);
@@ -1632,6 +2246,14 @@ FMove UGenMovementReplicationComponent::Server_UnpackClientMove(const FMove& Cli
   if (!CM.bSerializeOutControlRotationRoll)  Rep_SetInvalid(UM.OutControlRotation.Roll);
   if (!CM.bSerializeOutControlRotationPitch) Rep_SetInvalid(UM.OutControlRotation.Pitch);
   if (!CM.bSerializeOutControlRotationYaw)   Rep_SetInvalid(UM.OutControlRotation.Yaw);
+  if (CM.bSerializeOutStateHash)
+  {
+    // Only the hash of the out state was sent.
+    Rep_SetInvalid(UM.OutVelocity);
+    Rep_SetInvalid(UM.OutLocation);
+    Rep_SetInvalid(UM.OutRotation);
+    Rep_SetInvalid(UM.OutControlRotation);
+  }
   // Save this unpacked move for the next processing iteration.
   Server_LastUnpackedClientMove = UnpackedMove;
   return UnpackedMove;
@@ -1678,7 +2300,17 @@ void UGenMovementReplicationComponent::Server_SaveServerState(ENetRole Recipient
   // batch would get the same timestamp (the current server time) because they are all executed in succession within one loop.
   OutState.Timestamp = SourceMove.Timestamp;
   OutState.bOptimizeTraffic = bOptimizeTraffic;
-  Server_FillServerStateWithData(OutState, RecipientRole);
+  if (IsPawnStateUnchanged() && !Server_bSkippedStateCapture)
+  {
+    // The state still holds the pawn values saved after the previous move, only the bound data needs to be refreshed.
+    INC_DWORD_STAT(STAT_UnchangedServerStates)
+    Server_SaveBoundDataToServerState(OutState, RecipientRole);
+  }
+  else
+  {
+    Server_FillServerStateWithData(OutState, RecipientRole);
+  }
+  Server_bSkippedStateCapture = false;
   if (RecipientRole == ROLE_AutonomousProxy)
   {
     // Autonomous proxies do not need to have their input flags replicated.
@@ -1704,6 +2336,51 @@ void UGenMovementReplicationComponent::Server_SaveServerState(ENetRole Recipient
   }
 }
 
+bool UGenMovementReplicationComponent::Server_ShouldCaptureServerState()
+{
+  checkGMC(IsServerPawn() && PawnOwner->IsLocallyControlled())
+
+  const FMove& Move = LocalMove();
+  const uint16 InputFlags = Move.GetInputFlags();
+
+  // The custom check is always evaluated so it can keep track of the values it compares against.
+  bool bCapture = Server_ShouldCaptureServerState_Custom();
+  // The pawn was moved outside of move execution (i.e. teleported) since the last frame.
+  bCapture |= Move.InLocation != Server_LastCaptureCheckLocation;
+  // Input flags may be replicated and usually trigger discrete actions.
+  bCapture |= InputFlags != Server_LastCaptureCheckInputFlags;
+  Server_LastCaptureCheckInputFlags = InputFlags;
+  // Bound data that forces net updates on change must not miss a state, otherwise simulated proxies would never see the change.
+  bCapture = bCapture || Server_CaptureCheckBoundData();
+
+  if (!bCapture)
+  {
+    if (ServerStateCaptureRate <= 0.f || Server_LastStateCaptureTimestamp < 0.f || Move.Timestamp < Server_LastStateCaptureTimestamp)
+    {
+      bCapture = true;
+    }
+    else
+    {
+      // Capture in the frame that is closest to the end of the interval, otherwise the effective rate would drop to the next lower divisor
+      // of the frame rate (e.g. to 40 Hz instead of 60 Hz at a frame rate of 120 Hz).
+      const float TimeSinceCapture = Move.Timestamp - Server_LastStateCaptureTimestamp;
+      bCapture = TimeSinceCapture >= 1.f / ServerStateCaptureRate - 0.5f * Move.DeltaTime;
+    }
+  }
+
+  if (bCapture)
+  {
+    Server_LastStateCaptureTimestamp = Move.Timestamp;
+    INC_DWORD_STAT(STAT_CapturedServerStates)
+  }
+  else
+  {
+    Server_bSkippedStateCapture = true;
+    INC_DWORD_STAT(STAT_SkippedServerStateCaptures)
+  }
+  return bCapture;
+}
+
 void UGenMovementReplicationComponent::Server_FillServerStateWithData(FState& State, ENetRole RecipientRole) const
 {
   State.Velocity = GetVelocity();
@@ -1856,7 +2533,7 @@ bool UGenMovementReplicationComponent::Server_ResolveClientDiscrepancy(
   checkGMC(IsServerPawn())
   checkGMC(!PawnOwner->IsLocallyControlled())
 
-  Server_OnResolveClientDiscrepancy(ClientLocation, ClientRotation, ClientControlRotation);
+  GMC_CALL_HOOK(Server_OnResolveClientDiscrepancy, ClientLocation, ClientRotation, ClientControlRotation);
 
   // For validation, a theoretical min tolerance would have to fit the quantization level with which the original value was compressed on
   // the client (e.g. 0.01 for "RoundTwoDecimals"). In reality however, inaccuracies sneak in from all sides and implementing everything
@@ -1958,6 +2635,38 @@ bool UGenMovementReplicationComponent::Server_ResolveClientDiscrepancy(
   return Server_bLastClientMoveWasValid;
 }
 
+bool UGenMovementReplicationComponent::Server_ResolveClientDiscrepancyFromHash(const FMove& ClientMove)
+{
+  checkGMC(IsServerPawn())
+  checkGMC(!PawnOwner->IsLocallyControlled())
+  checkGMC(ClientMove.bSerializeOutStateHash)
+
+  // The hash is computed with the settings of the client move, so the server result is quantized exactly like the client values were.
+  const uint32 ServerHash = ClientMove.ComputeOutStateHash(
+    PawnOwner->GetActorLocation(),
+    PawnOwner->GetActorRotation(),
+    PawnOwner->GetControlRotation()
+  );
+  Server_bLastClientMoveWasValid = ServerHash == ClientMove.OutStateHash;
+  if (Server_bLastClientMoveWasValid)
+  {
+    INC_DWORD_STAT(STAT_OutStateHashMatches)
+  }
+  else
+  {
+    INC_DWORD_STAT(STAT_OutStateHashMismatches)
+  }
+
+  GMC_CLOG(
+    !Server_bLastClientMoveWasValid,
+    Verbose,
+    TEXT("Client move with timestamp %f rejected by server (out state hash deviates)."),
+    ClientMove.Timestamp
+  )
+
+  return Server_bLastClientMoveWasValid;
+}
+
 void UGenMovementReplicationComponent::Server_QuantizePawnStateFrom(FState& ServerState)
 {
   ServerState.QuantizeVelocity();
@@ -2018,7 +2727,7 @@ void UGenMovementReplicationComponent::Server_SwapStateBuffer(EImmediateContext
   Server_OnSwapStateBuffer(StateBuffer(), Context);
   // Although the state will get loaded again soon for move execution, we want to trigger the event here because there are user-overridable
   // functions in between which might depend on a correct pawn state.
-  OnImmediateStateLoaded(Context);
+  GMC_CALL_HOOK(OnImmediateStateLoaded, Context);
 }
 
 FState UGenMovementReplicationComponent::Server_GetFilteredServerState() const
@@ -2038,6 +2747,62 @@ FState UGenMovementReplicationComponent::Server_GetFilteredServerState() const
   return FilteredState;
 }
 
+void UGenMovementReplicationComponent::Server_UpdateReplicationLOD()
+{
+  if (ReplicationLODLevels.Num() == 0) return;
+
+  const float Timestamp = ServerState_SimulatedProxy().Timestamp;
+  for (auto& Entry : Server_BaselineStore_SimulatedProxy.Connections)
+  {
+    const APlayerController* Viewer = Entry.Key;
+    FConnectionBaseline& Baseline = Entry.Value;
+    if (!IsValid(Viewer)) continue;
+
+    FVector ViewLocation{0};
+    FRotator ViewRotation{0};
+    if (!WorldSubsystem || !WorldSubsystem->GetCachedViewPoint(Viewer, ViewLocation, ViewRotation))
+    {
+      Viewer->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    }
+    const uint8 Tier = Server_GetReplicationLODTier(ViewLocation, ViewRotation);
+    checkGMC(ReplicationLODLevels.IsValidIndex(Tier))
+    if (Tier != Baseline.ReplicationLODTier)
+    {
+      // The values the client received with the quantization levels of the previous tier may deviate from the baseline by more than the
+      // compare tolerance of the new tier.
+      Baseline.ReplicationLODTier = Tier;
+      Baseline.LastSerialized.bForceFullSerializationOnNextUpdate = true;
+    }
+    const float UpdateInterval = ReplicationLODLevels[Tier].UpdateInterval;
+    const float TimeSinceLastUpdate = Timestamp - Baseline.LastReplicationLODTimestamp;
+    Baseline.bSkipReplicationLODUpdate =
+      Baseline.LastReplicationLODTimestamp >= 0.f
+      && TimeSinceLastUpdate >= 0.f
+      && TimeSinceLastUpdate < UpdateInterval - KINDA_SMALL_NUMBER;
+  }
+}
+
+uint8 UGenMovementReplicationComponent::Server_GetReplicationLODTier(const FVector& ViewLocation, const FRotator& ViewRotation) const
+{
+  const FVector ViewToPawn = PawnOwner->GetActorLocation() - ViewLocation;
+  float Distance = ViewToPawn.Size();
+  if (
+    Distance > KINDA_SMALL_NUMBER
+    && FVector::DotProduct(ViewRotation.Vector(), ViewToPawn / Distance) < FMath::Cos(FMath::DegreesToRadians(ReplicationLODViewHalfAngle))
+  )
+  {
+    // The pawn is off-screen for this connection.
+    Distance *= ReplicationLODOffScreenDistanceScale;
+  }
+
+  uint8 Tier = 0;
+  for (int32 Index = 1; Index < ReplicationLODLevels.Num(); ++Index)
+  {
+    if (Distance >= ReplicationLODLevels[Index].MinDistance) Tier = Index;
+  }
+  return Tier;
+}
+
 void UGenMovementReplicationComponent::Server_MaintainSerializationMap()
 {
   checkGMC(IsServerPawn())
@@ -2057,9 +2822,10 @@ void UGenMovementReplicationComponent::Server_MaintainSerializationMap()
       // This is the owning client controller or a local server controller.
       continue;
     }
-    if (!ServerState_SimulatedProxy().LastSerialized.Contains(Controller))
+    if (!Server_BaselineStore_SimulatedProxy.Connections.Contains(Controller))
     {
-      ServerState_SimulatedProxy().LastSerialized.Emplace(Controller);
+      FConnectionBaseline& NewBaseline = Server_BaselineStore_SimulatedProxy.Connections.Emplace(Controller);
+      NewBaseline.ReplicatedStates.Reset(StateQueue.Max());
     }
     PlayerControllerList.Emplace(Controller);
   }
@@ -2069,16 +2835,16 @@ void UGenMovementReplicationComponent::Server_MaintainSerializationMap()
   const auto NetOwner = Cast<APlayerController>(PawnOwner->GetController());
   if (NetOwner && !NetOwner->IsLocalPlayerController())
   {
-    if (!ServerState_AutonomousProxy().LastSerialized.Contains(NetOwner))
+    if (!Server_BaselineStore_AutonomousProxy.Connections.Contains(NetOwner))
     {
       // Autonomous proxies have only one connection to replicate to.
-      ServerState_AutonomousProxy().LastSerialized.Emplace(NetOwner);
+      Server_BaselineStore_AutonomousProxy.Connections.Emplace(NetOwner);
     }
   }
 
   // Check if a client has disconnected and if so, remove its entry from the simulated proxy map.
   TArray<APlayerController*> ControllersToRemove;
-  for (const auto& Entry : ServerState_SimulatedProxy().LastSerialized)
+  for (const auto& Entry : Server_BaselineStore_SimulatedProxy.Connections)
   {
     const auto Controller = Entry.Key;
     if (!PlayerControllerList.Contains(Controller))
@@ -2089,28 +2855,26 @@ void UGenMovementReplicationComponent::Server_MaintainSerializationMap()
   }
   for (const auto Controller : ControllersToRemove)
   {
-    ServerState_SimulatedProxy().LastSerialized.Remove(Controller);
+    Server_BaselineStore_SimulatedProxy.Connections.Remove(Controller);
   }
 
   // There should never be more than one client connection (if any) in the autonomous proxy server state.
-  checkGMC(ServerState_AutonomousProxy().LastSerialized.Num() <= 1)
+  checkGMC(Server_BaselineStore_AutonomousProxy.Connections.Num() <= 1)
 }
 
 void UGenMovementReplicationComponent::Server_CheckNetRelevancy()
 {
   checkGMC(IsServerPawn())
 
+  if (!WorldSubsystem) return;
+
   // @attention "bForceFullSerializationOnNextUpdate" is reset directly at the end of @see FState::NetSerialize for the appropriate target
   // connection after the data has been fully serialized once.
-  for (auto& Entry : ServerState_SimulatedProxy().LastSerialized)
+  for (auto& Entry : Server_BaselineStore_SimulatedProxy.Connections)
   {
     const auto& Connection = Entry.Key;
-    const auto& Pawn = Connection->GetPawn();
-    auto& State = Entry.Value;
-    FRotator ViewRotation{0};
-    FVector ViewLocation{0};
-    Connection->GetPlayerViewPoint(ViewLocation, ViewRotation);
-    const bool bIsNetRelevant = GenPawnOwner->IsNetRelevantFor(Connection, Pawn, ViewLocation);
+    auto& State = Entry.Value.LastSerialized;
+    const bool bIsNetRelevant = WorldSubsystem->IsNetRelevantFor(GenPawnOwner, Connection);
     if (!State.bWasNetRelevantLastFrame && bIsNetRelevant)
     {
       State.bForceFullSerializationOnNextUpdate = true;
@@ -2132,25 +2896,111 @@ void UGenMovementReplicationComponent::Server_SetForceFullSerializationFlagPerio
 
   // @attention "bForceFullSerializationOnNextUpdate" is reset directly at the end of @see FState::NetSerialize for the appropriate target
   // connection after the data has been fully serialized once.
-  for (auto& Entry : ServerState_SimulatedProxy().LastSerialized)
+  for (auto& Entry : Server_BaselineStore_SimulatedProxy.Connections)
   {
-    auto& State = Entry.Value;
+    auto& State = Entry.Value.LastSerialized;
     State.bForceFullSerializationOnNextUpdate = true;
   }
-  for (auto& Entry : ServerState_AutonomousProxy().LastSerialized)
+  for (auto& Entry : Server_BaselineStore_AutonomousProxy.Connections)
   {
-    auto& State = Entry.Value;
+    auto& State = Entry.Value.LastSerialized;
     State.bForceFullSerializationOnNextUpdate = true;
   }
 }
 
+bool UGenMovementReplicationComponent::Server_CanCacheSerialization() const
+{
+  const auto& ServerState = ServerState_SimulatedProxy();
+  return ServerState.NumBoundActorReference == 0
+    && ServerState.NumBoundActorComponentReference == 0
+    && ServerState.NumBoundAnimMontageReference == 0;
+}
+
+void UGenMovementReplicationComponent::Server_BuildSerializationCache()
+{
+  bServer_SerializationCacheQueued = false;
+  Server_SerializationCache.Reset();
+
+  auto& ServerState = ServerState_SimulatedProxy();
+  Server_SerializationCacheFrame = GFrameCounter;
+  Server_SerializationCacheTimestamp = ServerState.Timestamp;
+  FStateReduced* const CurrentBaseline = ServerState.CurrentBaseline;
+  for (const auto& Entry : Server_BaselineStore_SimulatedProxy.Connections)
+  {
+    const auto& Baseline = Entry.Value;
+    if (Baseline.bSkipReplicationLODUpdate) continue;
+    const bool bForceFullSerialization = Baseline.LastSerialized.bForceFullSerializationOnNextUpdate;
+    const bool bIsCached = Server_SerializationCache.ContainsByPredicate([&](const FSerializationCacheEntry& CacheEntry)
+    {
+      return CacheEntry.SourceGroup == Baseline.SerializationGroup
+        && CacheEntry.bForceFullSerialization == bForceFullSerialization
+        && CacheEntry.ReplicationLODTier == Baseline.ReplicationLODTier;
+    });
+    if (bIsCached) continue;
+
+    // Serialize against a copy of the baseline, the baselines of the connections are only updated when the bits are actually sent.
+    auto& CacheEntry = Server_SerializationCache.AddDefaulted_GetRef();
+    CacheEntry.SourceGroup = Baseline.SerializationGroup;
+    CacheEntry.bForceFullSerialization = bForceFullSerialization;
+    CacheEntry.ReplicationLODTier = Baseline.ReplicationLODTier;
+    CacheEntry.ResultGroup = Server_NewSerializationGroup();
+    CacheEntry.Result = Baseline.LastSerialized;
+    ServerState.CurrentBaseline = &CacheEntry.Result;
+    ServerState.CurrentReplicationLODTier = Baseline.ReplicationLODTier;
+    FBitWriter Writer(0, true);
+    bool bSuccess = true;
+    CacheEntry.EstimatedBitsWithoutDirtyMask = ServerState.SerializeStateData(Writer, bSuccess);
+    if (!bSuccess || Writer.IsError())
+    {
+      // Leave it to the regular net serialization to report the error.
+      Server_SerializationCache.Pop(false);
+      continue;
+    }
+    CacheEntry.NumBits = Writer.GetNumBits();
+    CacheEntry.Bits = MoveTemp(*Writer.GetBuffer());
+  }
+  ServerState.CurrentBaseline = CurrentBaseline;
+  INC_DWORD_STAT_BY(STAT_SerializationCacheEntries, Server_SerializationCache.Num())
+}
+
+const FSerializationCacheEntry* UGenMovementReplicationComponent::Server_FindCachedSerialization(const FConnectionBaseline& Baseline)
+{
+  if (bServer_SerializationCacheQueued && WorldSubsystem)
+  {
+    WorldSubsystem->BuildQueuedSerializationCaches();
+  }
+  if (
+    Server_SerializationCacheFrame != GFrameCounter
+    || Server_SerializationCacheTimestamp != ServerState_SimulatedProxy().Timestamp
+  )
+  {
+    return nullptr;
+  }
+  const bool bForceFullSerialization = Baseline.LastSerialized.bForceFullSerializationOnNextUpdate;
+  return Server_SerializationCache.FindByPredicate([&](const FSerializationCacheEntry& CacheEntry)
+  {
+    return CacheEntry.SourceGroup == Baseline.SerializationGroup
+      && CacheEntry.bForceFullSerialization == bForceFullSerialization
+      && CacheEntry.ReplicationLODTier == Baseline.ReplicationLODTier;
+  });
+}
+
 void UGenMovementReplicationComponent::Server_SetReplicationFlag(APlayerController* TargetConnection)
 {
-  if (StateQueue.Num() > 0 && StateQueue.Last().LastSerialized.Contains(TargetConnection))
+  FConnectionBaseline* Baseline = Server_BaselineStore_SimulatedProxy.Connections.Find(TargetConnection);
+  if (StateQueue.Num() > 0 && Baseline)
   {
     checkGMC(StateQueue.Last().Timestamp == ServerState_SimulatedProxy().Timestamp)
-    // @attention It is possible that this is already set to true (in case of a replication retry).
-    StateQueue.Last().LastSerialized[TargetConnection].bReplicatedToSimulatedProxy = true;
+    auto& ReplicatedStates = Baseline->ReplicatedStates;
+    if (ReplicatedStates.Max() != StateQueue.Max())
+    {
+      ReplicatedStates.SetCapacity(StateQueue.Max());
+    }
+    // @attention It is possible that this state was already recorded (in case of a replication retry).
+    if (ReplicatedStates.Num() == 0 || ReplicatedStates.Last().Timestamp < StateQueue.Last().Timestamp)
+    {
+      ReplicatedStates.AddUninitialized().Timestamp = StateQueue.Last().Timestamp;
+    }
   }
 }
 
@@ -2211,7 +3061,7 @@ void UGenMovementReplicationComponent::Client_UnpackReplicationUpdate(FState& Se
 bool UGenMovementReplicationComponent::Client_MaintainMoveQueue(const FMove& NewMove, bool& bOutStartedNewMove, bool& bOutMoveQueueFull)
 {
   // A full move queue doesn't necessarily mean that the new move will be discarded, as it can still be combined with the last move.
-  bOutMoveQueueFull = Client_MoveQueue.Num() == MoveQueueMaxSize;
+  bOutMoveQueueFull = Client_MoveQueue.IsFull();
   if ((bOutStartedNewMove = Client_ShouldEnqueueMove(NewMove)) == true)
   {
     // Something important changed with this move so we enqueue the move. This finalizes the last move.
@@ -2266,7 +3116,7 @@ bool UGenMovementReplicationComponent::Client_ShouldEnqueueMove(const FMove& Cur
   }
 
   // Implementation specific checks. We continue with the default checks if this returns 0.
-  const int32 ResultCustom = Client_ShouldEnqueueMove_Custom(CurrentMove, Client_LastSignificantMove);
+  const int32 ResultCustom = GMC_CALL_HOOK(Client_ShouldEnqueueMove_Custom, CurrentMove, Client_LastSignificantMove);
   if (ResultCustom > 0)
   {
     // Custom checking forced this move to be enqueued.
@@ -2331,7 +3181,7 @@ bool UGenMovementReplicationComponent::Client_ShouldSendMoves()
 {
   checkGMC(ClientSendRate > 0)
   if (const auto World = GetWorld()) Client_TimeSinceLastMoveWasSent += World->GetDeltaSeconds();
-  if (Client_PendingMoves.Num() > 0 && Client_TimeSinceLastMoveWasSent > 1.f / FMath::Max(ClientSendRate, 0))
+  if (Client_NumPendingMoves > 0 && Client_TimeSinceLastMoveWasSent > 1.f / FMath::Max(ClientSendRate, 0))
   {
     Client_TimeSinceLastMoveWasSent = 0.f;
     return true;
@@ -2349,6 +3199,8 @@ void UGenMovementReplicationComponent::Client_DetermineValuesToSend()
   const float OutRotationTolerance = GetCompareToleranceRotator(LocalMove().OutRotationQuantize);
   const float OutControlRotationTolerance = GetCompareToleranceRotator(LocalMove().OutControlRotationQuantize);
   for (auto& Move : Client_PendingMoves) {
+    Move.bIsBatchBase = &Move == &Client_PendingMoves[0];
+    if (LocalMove().bSerializeOutStateHash)            Move.OutStateHash = Move.ComputeOutStateHash(Move.OutLocation, Move.OutRotation, Move.OutControlRotation);
     if (LocalMove().bSerializeInputVectorX)            Move.bHasNewInputVectorX            = HasValueChanged(Move.InputVector.X,            Client_LastSentInputVectorX,         InputVectorTolerance);
     if (LocalMove().bSerializeInputVectorY)            Move.bHasNewInputVectorY            = HasValueChanged(Move.InputVector.Y,            Client_LastSentInputVectorY,         InputVectorTolerance);
     if (LocalMove().bSerializeInputVectorZ)            Move.bHasNewInputVectorZ            = HasValueChanged(Move.InputVector.Z,            Client_LastSentInputVectorZ,         InputVectorTolerance);
@@ -2363,6 +3215,46 @@ void UGenMovementReplicationComponent::Client_DetermineValuesToSend()
   }
 }
 
+void UGenMovementReplicationComponent::Client_CollectPendingMoves(int32 NumRedundantMovesToAdd)
+{
+  checkGMC(Client_NumPendingMoves > 0)
+  checkGMC(Client_NumPendingMoves < Client_MoveQueue.Num())
+
+  // The pending moves are the completed moves at the end of the queue, the newest move is still in progress.
+  const int32 EndIndex = Client_MoveQueue.Num() - 1;
+  const int32 FirstPendingIndex = EndIndex - Client_NumPendingMoves;
+  // Moves stay in the move queue until they are acknowledged by the server, so every queued move that is older than the first pending move
+  // was sent before but may not have been received.
+  const int32 FirstIndex = FirstPendingIndex - FMath::Clamp(NumRedundantMovesToAdd, 0, FirstPendingIndex);
+  Client_PendingMoves.Reset(EndIndex - FirstIndex);
+  for (int32 Index = FirstIndex; Index < EndIndex; ++Index)
+  {
+    Client_PendingMoves.Emplace(Client_MoveQueue[Index]);
+  }
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, Client_PendingMoves.Num() * sizeof(FMove))
+}
+
+void UGenMovementReplicationComponent::Client_AddRedundantMoves()
+{
+  checkGMC(bUseUnreliableMoveTransport)
+
+  Client_CollectPendingMoves(FMath::Max(NumRedundantMoves, 0));
+
+  // Invalidate the last sent values so the first move of the batch gets fully serialized (an invalid value is never equal to anything). All
+  // following moves of the batch are then delta serialized against their predecessor within the same batch.
+  Rep_SetInvalid(Client_LastSentInputVectorX);
+  Rep_SetInvalid(Client_LastSentInputVectorY);
+  Rep_SetInvalid(Client_LastSentInputVectorZ);
+  Rep_SetInvalid(Client_LastSentOutLocation);
+  Rep_SetInvalid(Client_LastSentOutVelocity);
+  Rep_SetInvalid(Client_LastSentOutRotationRoll);
+  Rep_SetInvalid(Client_LastSentOutRotationPitch);
+  Rep_SetInvalid(Client_LastSentOutRotationYaw);
+  Rep_SetInvalid(Client_LastSentControlRotationRoll);
+  Rep_SetInvalid(Client_LastSentControlRotationPitch);
+  Rep_SetInvalid(Client_LastSentControlRotationYaw);
+}
+
 void UGenMovementReplicationComponent::Client_BufferLocalState()
 {
   if (!ServerState_AutonomousProxy().bSerializeVelocity)
@@ -2475,41 +3367,26 @@ void UGenMovementReplicationComponent::Client_ManagePrerequisiteTicks()
     }
   }
 
-  // Gather all actors of type AGenPawn.
-  TArray<AActor*> Actors;
-  UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
+  if (!WorldSubsystem) return;
 
   if (IsSimulatedProxy())
   {
     // A simulated proxy could have been previously possessed by the client in which case we need to remove the prerequisite ticks from the
     // unpossessed pawn as they would otherwise form a cycle.
     // @note AController::OnUnPossess is not called on clients so we need to do it like this.
-    for (const auto Actor : Actors)
+    WorldSubsystem->ForEachReplicationComponent([this](UGenMovementReplicationComponent* ReplicationComponent)
     {
-      const auto GenPawn = Cast<AGenPawn>(Actor);
-      check(GenPawn)
-      if (const auto ReplicationComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-      {
-        RemoveTickPrerequisiteComponent(ReplicationComponent);
-      }
-    }
+      RemoveTickPrerequisiteComponent(ReplicationComponent);
+    });
   }
   else if (IsAutonomousProxy())
   {
     // All simulated proxy replication components must tick before the replication component of the autonomous proxy. This guarantees that
     // the interpolation data of smoothed pawns is up-to-date when accessed from the locally controlled pawn, which is particularly
     // important for pawn rollback.
-    for (const auto Actor : Actors)
+    for (const auto ReplicationComponent : WorldSubsystem->GetReplicationComponents(EGenReplicationRole::SimulatedProxy))
     {
-      const auto GenPawn = Cast<AGenPawn>(Actor);
-      check(GenPawn)
-      if (GenPawn->GetLocalRole() == ROLE_SimulatedProxy)
-      {
-        if (const auto ReplicationComponent = Cast<UGenMovementReplicationComponent>(GenPawn->GetMovementComponent()))
-        {
-          AddTickPrerequisiteComponent(ReplicationComponent);
-        }
-      }
+      AddTickPrerequisiteComponent(ReplicationComponent);
     }
   }
 }
@@ -2571,6 +3448,8 @@ void UGenMovementReplicationComponent::Client_ReplayMoves()
 {
   checkGMC(IsAutonomousProxy())
 
+  SCOPE_CYCLE_COUNTER(STAT_ReplayMoves)
+
   DEBUG_LOG_REPLAY_CLIENT_STATE_BEFORE_REPLAY
   if (Client_MoveQueue.Num() > 0)
   {
@@ -2586,22 +3465,71 @@ void UGenMovementReplicationComponent::Client_ReplayMoves()
 
     Client_PreReplay();
 
-    for (auto& Move : Client_MoveQueue)
+    // Merged moves would be executed against a single rollback state of the other pawns.
+    const bool bMergeMoves = bMergeIdenticalReplayMoves && !bRollbackClientPawns;
+    const int32 LastMergeableIndex = bMergeMoves ? Client_GetLastMergeableReplayIndex() : INDEX_NONE;
+    const int32 NumMoves = Client_MoveQueue.Num();
+    int32 NumReplayedMoves{0};
+    int32 NumConvergedMoves{0};
+    FMove PredictedMove;
+    for (int32 MoveIndex = 0; MoveIndex < NumMoves; ++MoveIndex)
     {
+      const int32 LastRunIndex = MoveIndex < LastMergeableIndex ? Client_FindMergeableReplayRun(MoveIndex, LastMergeableIndex) : MoveIndex;
+      auto& Move = Client_MoveQueue[LastRunIndex];
+
       if (bRollbackClientPawns)
       {
         // Roll back all other pawns for move execution.
         RollbackPawns(Move.Timestamp - SimulationDelay, RollbackPawnList, ESimulatedContext::RollingBackClientPawn);
       }
 
-      FillMoveWithData(Move, FMove::EStateVars::Input);
-      Client_PreReplayMoveExecution(Move);
-      ExecuteMove(Move, EImmediateContext::LocalClientPawnReplayingMove);
-      FillMoveWithData(Move, FMove::EStateVars::Output);
-      Client_QuantizePawnStateFrom(Move);
-      Client_PostReplayMoveExecution(Move);
+      if (bAllowPartialReplay)
+      {
+        // Keep the original prediction so we can check whether the replayed trajectory has reconverged with it.
+        PredictedMove = Move;
+        INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
+      }
+
+      if (LastRunIndex == MoveIndex)
+      {
+        FillMoveWithData(Move, FMove::EStateVars::Input);
+        GMC_CALL_HOOK(Client_PreReplayMoveExecution, Move);
+        OnClientPreReplayMoveExecution.Broadcast(Move);
+        ExecuteMove(Move, EImmediateContext::LocalClientPawnReplayingMove);
+        FillMoveWithData(Move, FMove::EStateVars::Output);
+        Client_QuantizePawnStateFrom(Move);
+        GMC_CALL_HOOK(Client_PostReplayMoveExecution, Move);
+        OnClientPostReplayMoveExecution.Broadcast(Move);
+      }
+      else
+      {
+        Client_ReplayMergedMoves(MoveIndex, LastRunIndex);
+      }
+      INC_DWORD_STAT(STAT_ReplayMoveExecutions)
+      NumReplayedMoves += LastRunIndex - MoveIndex + 1;
+      MoveIndex = LastRunIndex;
       DEBUG_LOG_REPLAY_CLIENT_REPLAY_LOOP
+
+      if (bAllowPartialReplay && NumReplayedMoves < NumMoves)
+      {
+        NumConvergedMoves = Client_HasReplayConverged(Move, PredictedMove) ? NumConvergedMoves + 1 : 0;
+        if (NumConvergedMoves >= PartialReplayConvergedMoves)
+        {
+          // The replayed state matches the original prediction again, so the remaining moves would produce the same outputs they already
+          // hold. Skip them and continue from the predicted output of the newest move.
+          Client_LoadPredictedStateFromMove(Client_MoveQueue.Last());
+          GMC_LOG(
+            VeryVerbose,
+            TEXT("Replay converged after %d of %d moves, skipping the remaining moves."),
+            NumReplayedMoves,
+            NumMoves
+          )
+          break;
+        }
+      }
     }
+    INC_DWORD_STAT_BY(STAT_ReplayedMoves, NumReplayedMoves)
+    INC_DWORD_STAT_BY(STAT_SkippedReplayMoves, NumMoves - NumReplayedMoves)
 
     Client_OnMovesReplayed();
 
@@ -2617,6 +3545,126 @@ void UGenMovementReplicationComponent::Client_ReplayMoves()
   DEBUG_LOG_REPLAY_CLIENT_STATE_AFTER_REPLAY
 }
 
+int32 UGenMovementReplicationComponent::Client_FindMergeableReplayRun(int32 FirstIndex, int32 MaxIndex) const
+{
+  checkGMC(Client_MoveQueue.IsValidIndex(FirstIndex))
+  checkGMC(MaxIndex < Client_MoveQueue.Num())
+  const auto& FirstMove = Client_MoveQueue[FirstIndex];
+  float RunDeltaTime = FirstMove.DeltaTime;
+  int32 LastIndex = FirstIndex;
+  while (LastIndex + 1 <= MaxIndex)
+  {
+    const auto& NextMove = Client_MoveQueue[LastIndex + 1];
+    // Larger runs would be split into multiple iterations during move execution which would give different results than the individual
+    // moves.
+    if (RunDeltaTime + NextMove.DeltaTime > MaxTimeStep) break;
+    if (!Client_HaveIdenticalReplayInput(FirstMove, NextMove)) break;
+    RunDeltaTime += NextMove.DeltaTime;
+    ++LastIndex;
+  }
+  return LastIndex;
+}
+
+int32 UGenMovementReplicationComponent::Client_GetLastMergeableReplayIndex() const
+{
+  // The newest move is still in progress and the pending moves before it have not been sent yet (@see Client_CollectPendingMoves).
+  int32 LastSentIndex = Client_MoveQueue.Num() - 2 - Client_NumPendingMoves;
+  if (bUseUnreliableMoveTransport)
+  {
+    // The newest sent moves are sent again as redundant moves with the next batch.
+    LastSentIndex -= FMath::Max(NumRedundantMoves, 0);
+  }
+  return FMath::Max(LastSentIndex, INDEX_NONE);
+}
+
+bool UGenMovementReplicationComponent::Client_HaveIdenticalReplayInput(const FMove& FirstMove, const FMove& NextMove) const
+{
+  if (FirstMove.InputVector != NextMove.InputVector) return false;
+  if (FirstMove.InInputMode != NextMove.InInputMode) return false;
+  if (FirstMove.InControlRotation != NextMove.InControlRotation) return false;
+  if (Client_ReplayMergeCheckBoundInputFlags(FirstMove, NextMove)) return false;
+  // Moves that the implementation would never combine during enqueueing are not merged either.
+  return GMC_CALL_HOOK(Client_ShouldEnqueueMove_Custom, NextMove, FirstMove) <= 0;
+}
+
+void UGenMovementReplicationComponent::Client_ReplayMergedMoves(int32 FirstIndex, int32 LastIndex)
+{
+  checkGMC(FirstIndex < LastIndex)
+  auto& FirstMove = Client_MoveQueue[FirstIndex];
+
+  // Execute the run as one move that starts with the input state of the first move and ends at the timestamp of the last one.
+  FillMoveWithData(FirstMove, FMove::EStateVars::Input);
+  FMove MergedMove = FirstMove;
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
+  MergedMove.Timestamp = Client_MoveQueue[LastIndex].Timestamp;
+  for (int32 Index = FirstIndex + 1; Index <= LastIndex; ++Index)
+  {
+    MergedMove.DeltaTime += Client_MoveQueue[Index].DeltaTime;
+  }
+  GMC_CALL_HOOK(Client_PreReplayMoveExecution, MergedMove);
+  OnClientPreReplayMoveExecution.Broadcast(MergedMove);
+  ExecuteMove(MergedMove, EImmediateContext::LocalClientPawnReplayingMove);
+  FillMoveWithData(MergedMove, FMove::EStateVars::Output);
+  Client_QuantizePawnStateFrom(MergedMove);
+  GMC_CALL_HOOK(Client_PostReplayMoveExecution, MergedMove);
+  OnClientPostReplayMoveExecution.Broadcast(MergedMove);
+
+  // Reconstruct the output of each move of the run. The pawn is in the end state of the run now.
+  float ElapsedTime{0.f};
+  for (int32 Index = FirstIndex; Index <= LastIndex; ++Index)
+  {
+    auto& Move = Client_MoveQueue[Index];
+    ElapsedTime += Move.DeltaTime;
+    if (Index > FirstIndex)
+    {
+      const auto& PreviousMove = Client_MoveQueue[Index - 1];
+      Move.InVelocity = PreviousMove.OutVelocity;
+      Move.InLocation = PreviousMove.OutLocation;
+      Move.InRotation = PreviousMove.OutRotation;
+      Move.InControlRotation = PreviousMove.OutControlRotation;
+      Move.InInputMode = PreviousMove.OutInputMode;
+      SaveBoundDataToMove(Move, FMove::EStateVars::Input);
+    }
+    FillMoveWithData(Move, FMove::EStateVars::Output);
+    if (Index < LastIndex)
+    {
+      const float Alpha = ElapsedTime / MergedMove.DeltaTime;
+      Move.OutVelocity = FMath::Lerp(MergedMove.InVelocity, MergedMove.OutVelocity, Alpha);
+      Move.OutLocation = FMath::Lerp(MergedMove.InLocation, MergedMove.OutLocation, Alpha);
+      Move.OutRotation = FQuat::Slerp(MergedMove.InRotation.Quaternion(), MergedMove.OutRotation.Quaternion(), Alpha).Rotator();
+      Move.OutControlRotation = FQuat::Slerp(
+        MergedMove.InControlRotation.Quaternion(),
+        MergedMove.OutControlRotation.Quaternion(),
+        Alpha
+      ).Rotator();
+    }
+    Client_QuantizeMoveOutput(Move);
+  }
+}
+
+bool UGenMovementReplicationComponent::Client_HasReplayConverged(const FMove& ReplayedMove, const FMove& PredictedMove) const
+{
+  checkGMC(IsAutonomousProxy())
+  return ReplayedMove.OutVelocity.Equals(PredictedMove.OutVelocity, MaxVelocityError)
+    && ReplayedMove.OutLocation.Equals(PredictedMove.OutLocation, MaxLocationError)
+    && ReplayedMove.OutRotation.Equals(PredictedMove.OutRotation, MaxRotationError)
+    && ReplayedMove.OutControlRotation.Equals(PredictedMove.OutControlRotation, MaxControlRotationError)
+    && ReplayedMove.OutInputMode == PredictedMove.OutInputMode
+    && Client_IsReplayedBoundDataConverged(ReplayedMove, PredictedMove);
+}
+
+void UGenMovementReplicationComponent::Client_LoadPredictedStateFromMove(const FMove& Move)
+{
+  checkGMC(IsAutonomousProxy())
+  SetVelocity(Move.OutVelocity);
+  PawnOwner->SetActorLocation(Move.OutLocation);
+  PawnOwner->SetActorRotation(Move.OutRotation);
+  if (const auto Controller = PawnOwner->GetController()) Controller->SetControlRotation(Move.OutControlRotation);
+  GenPawnOwner->SetInputMode(Move.OutInputMode);
+  LoadOutBoundDataFromMove(Move);
+  GMC_CALL_HOOK(OnImmediateStateLoaded, EImmediateContext::LocalClientPawnSkippingReplay);
+}
+
 bool UGenMovementReplicationComponent::Client_ShouldReplay(const FMove& SourceMove) const
 {
   if (!SourceMove.IsValid())
@@ -2857,31 +3905,29 @@ void UGenMovementReplicationComponent::Client_AdoptServerState(bool bContainsFul
 
 FMove UGenMovementReplicationComponent::Client_ClearAcknowledgedMoves(float ReceivedTimestamp)
 {
-  TArray<FMove> TempMoveQueue;
-  TempMoveQueue.Reserve(MoveQueueMaxSize);
+  SCOPE_CYCLE_COUNTER(STAT_ClearAcknowledgedMoves)
+
+  // The timestamps in the queue are strictly increasing, so all acknowledged moves are at the front of the queue.
+  const int32 NumAcknowledgedMoves = Client_MoveQueue.UpperBound(ReceivedTimestamp);
   FMove SourceMove;
-  for (const auto& Move : Client_MoveQueue)
-  {
-    if (Move.Timestamp > ReceivedTimestamp)
-    {
-      TempMoveQueue.Emplace(Move);
-    }
-    else if (Move.Timestamp == ReceivedTimestamp)
-    {
-      SourceMove = Move;
-      // Mark values that are not replicated from the server in the source move as well.
-      const auto& SSAP = ServerState_AutonomousProxy();
-      if (!SSAP.bSerializeVelocity)             Rep_SetInvalid(SourceMove.OutVelocity);
-      if (!SSAP.bSerializeLocation)             Rep_SetInvalid(SourceMove.OutLocation);
-      if (!SSAP.bSerializeRotationRoll)         Rep_SetInvalid(SourceMove.OutRotation.Roll);
-      if (!SSAP.bSerializeRotationPitch)        Rep_SetInvalid(SourceMove.OutRotation.Pitch);
-      if (!SSAP.bSerializeRotationYaw)          Rep_SetInvalid(SourceMove.OutRotation.Yaw);
-      if (!SSAP.bSerializeControlRotationRoll)  Rep_SetInvalid(SourceMove.OutControlRotation.Roll);
-      if (!SSAP.bSerializeControlRotationPitch) Rep_SetInvalid(SourceMove.OutControlRotation.Pitch);
-      if (!SSAP.bSerializeControlRotationYaw)   Rep_SetInvalid(SourceMove.OutControlRotation.Yaw);
-    }
-  }
-  Client_MoveQueue = MoveTemp(TempMoveQueue);
+  if (NumAcknowledgedMoves > 0 && Client_MoveQueue[NumAcknowledgedMoves - 1].Timestamp == ReceivedTimestamp)
+  {
+    SourceMove = Client_MoveQueue[NumAcknowledgedMoves - 1];
+    INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
+    // Mark values that are not replicated from the server in the source move as well.
+    const auto& SSAP = ServerState_AutonomousProxy();
+    if (!SSAP.bSerializeVelocity)             Rep_SetInvalid(SourceMove.OutVelocity);
+    if (!SSAP.bSerializeLocation)             Rep_SetInvalid(SourceMove.OutLocation);
+    if (!SSAP.bSerializeRotationRoll)         Rep_SetInvalid(SourceMove.OutRotation.Roll);
+    if (!SSAP.bSerializeRotationPitch)        Rep_SetInvalid(SourceMove.OutRotation.Pitch);
+    if (!SSAP.bSerializeRotationYaw)          Rep_SetInvalid(SourceMove.OutRotation.Yaw);
+    if (!SSAP.bSerializeControlRotationRoll)  Rep_SetInvalid(SourceMove.OutControlRotation.Roll);
+    if (!SSAP.bSerializeControlRotationPitch) Rep_SetInvalid(SourceMove.OutControlRotation.Pitch);
+    if (!SSAP.bSerializeControlRotationYaw)   Rep_SetInvalid(SourceMove.OutControlRotation.Yaw);
+  }
+  Client_MoveQueue.RemoveFront(NumAcknowledgedMoves);
+  // Pending moves have not been sent yet so they should never be acknowledged, but the newest move must never count as pending.
+  Client_NumPendingMoves = FMath::Clamp(Client_NumPendingMoves, 0, FMath::Max(Client_MoveQueue.Num() - 1, 0));
   // An empty move queue after clearing should theoretically not be possible, but it can still happen in practice due to inconsistent
   // timestamps.
   GMC_CLOG(Client_MoveQueue.Num() == 0, Verbose, TEXT("Client move queue is empty after clearing acknowledged moves."))
@@ -2901,7 +3947,7 @@ FMove UGenMovementReplicationComponent::Client_ClearAcknowledgedMoves(float Rece
 bool UGenMovementReplicationComponent::Client_AddToMoveQueue(const FMove& NewMove, bool& bOutMoveQueueFull)
 {
   bOutMoveQueueFull = false;
-  if (Client_MoveQueue.Num() == MoveQueueMaxSize)
+  if (Client_MoveQueue.IsFull())
   {
     // Should only ever happen if there is a severe lag spike. If this happens during good network conditions, you should either increase
     // the move queue max size or increase the net update frequency for the autonomous proxy (will have the effect that the move queue gets
@@ -2916,8 +3962,9 @@ bool UGenMovementReplicationComponent::Client_AddToMoveQueue(const FMove& NewMov
   }
   // We don't need to check for things like a valid timestamp here anymore because those things have been checked already when it was
   // determined that the move should be enqueued.
-  Client_MoveQueue.Emplace(NewMove);
-  if (Client_MoveQueue.Num() == MoveQueueMaxSize)
+  Client_MoveQueue.Add(NewMove);
+  INC_DWORD_STAT_BY(STAT_MoveBytesCopied, sizeof(FMove))
+  if (Client_MoveQueue.IsFull())
   {
     // The move queue might be full after enqueueing the new move, which is not a problem (yet) if the queue gets cleared before the next
     // local move is created that cannot be combined.
@@ -2927,6 +3974,18 @@ bool UGenMovementReplicationComponent::Client_AddToMoveQueue(const FMove& NewMov
 }
 
 void UGenMovementReplicationComponent::Client_QuantizePawnStateFrom(FMove& Move)
+{
+  Client_QuantizeMoveOutput(Move);
+  SetVelocity(Move.OutVelocity);
+  PawnOwner->SetActorLocation(Move.OutLocation);
+  PawnOwner->SetActorRotation(Move.OutRotation);
+  if (bQuantizeControlRotation)
+  {
+    if (const auto Controller = PawnOwner->GetController()) Controller->SetControlRotation(Move.OutControlRotation);
+  }
+}
+
+void UGenMovementReplicationComponent::Client_QuantizeMoveOutput(FMove& Move) const
 {
   // We need to enforce the same quantization level for the velocity across server and client to remain synced and to avoid triggering
   // replays (which cost performance and can cause teleports for the client). Keep in mind that the the client's velocity won't actually be
@@ -2936,12 +3995,9 @@ void UGenMovementReplicationComponent::Client_QuantizePawnStateFrom(FMove& Move)
   // different level, which is why we ensure they are the same here.
   Move.OutVelocityQuantize = ServerState_AutonomousProxy().VelocityQuantize;
   Move.QuantizeOutVelocity();
-  SetVelocity(Move.OutVelocity);
   Move.QuantizeOutLocation();
-  PawnOwner->SetActorLocation(Move.OutLocation);
   Move.OutRotation.Normalize();
   Move.QuantizeOutRotation();
-  PawnOwner->SetActorRotation(Move.OutRotation);
   Move.OutControlRotation.Normalize();
   // The control rotation is usually not quantized because we don't want to alter the mapping of the physical movement (e.g. of the mouse)
   // to the view direction on the screen. For many games, it is important that this mapping remains accurate (e.g. competitive shooters).
@@ -2950,7 +4006,6 @@ void UGenMovementReplicationComponent::Client_QuantizePawnStateFrom(FMove& Move)
   if (bQuantizeControlRotation)
   {
     Move.QuantizeOutControlRotation();
-    if (const auto Controller = PawnOwner->GetController()) Controller->SetControlRotation(Move.OutControlRotation);
   }
 }
 
@@ -2974,7 +4029,8 @@ void UGenMovementReplicationComponent::SmoothMovement(ESimulatedContext Context)
 
   // Calculate the interpolation time based on the set simulation delay. The interpolation time is the world time (in seconds) in the past
   // at which the simulated pawn is going to be displayed.
-  const float InterpolationTime = GetTime() - SimulationDelay;
+  UpdateReplicationLODDelay();
+  const float InterpolationTime = GetTime() - SimulationDelay - ReplicationLODDelay;
   if (LastValidInterpolationTime >= InterpolationTime)
   {
     GMC_LOG(
@@ -3014,6 +4070,21 @@ void UGenMovementReplicationComponent::SmoothMovement(ESimulatedContext Context)
   DEBUG_LOG_SMOOTHING_INTERPOLATION_DATA
 }
 
+void UGenMovementReplicationComponent::UpdateReplicationLODDelay()
+{
+  // Server states that are sent with a replication LOD tier are spaced further apart than regular updates. The additional spacing is added
+  // to the simulation delay so the interpolation time stays behind the newest state instead of running into extrapolation between updates.
+  float TargetDelay{0.f};
+  if (ReplicationLODLevels.Num() > 0 && IsSimulatedProxy() && StateQueue.Num() >= 2)
+  {
+    const float StateSpacing = StateQueue.Last().Timestamp - StateQueue[StateQueue.Num() - 2].Timestamp;
+    const float RegularSpacing = 1.f / FMath::Max(PawnOwner->NetUpdateFrequency, 1.f);
+    TargetDelay = FMath::Max(StateSpacing - RegularSpacing, 0.f);
+  }
+  // The delay is changed gradually. Increasing it at half the rate of the world time slows the simulated pawn down instead of stopping it.
+  ReplicationLODDelay = FMath::FInterpConstantTo(ReplicationLODDelay, TargetDelay, GetWorld()->GetDeltaSeconds(), 0.5f);
+}
+
 void UGenMovementReplicationComponent::AddSimulatedRootComponent()
 {
   checkGMC(!SimulatedRootComponent)
@@ -3051,27 +4122,26 @@ void UGenMovementReplicationComponent::ComputeSmoothingInput(
     // Find the correct starting state which is the latest state that was received before (or exactly at) the targeted interpolation time.
     // If none is found our state queue does not contain any state old enough, most likely because the buffer size was set too small and
     // should be increased.
-    for (int32 Index = StateQueue.Num() - 2; Index >= 0; --Index)
+    int32 StartIndex{INDEX_NONE};
+    int32 TargetIndex{INDEX_NONE};
+    if (StateQueue.FindBracketingStates(Time, StartIndex, TargetIndex))
     {
-      if (StateQueue[Index].Timestamp <= Time)
+      // To avoid teleports, we only stop using extrapolation data once we have a more up-to-date starting state available again.
+      if (bUsingExtrapolatedData && ExtrapolatedState.Timestamp < StateQueue[StartIndex].Timestamp)
       {
-        // To avoid teleports, we only stop using extrapolation data once we have a more up-to-date starting state available again.
-        if (bUsingExtrapolatedData && ExtrapolatedState.Timestamp < StateQueue[Index].Timestamp)
-        {
-          bUsingExtrapolatedData = false;
-        }
-
-        // Set the starting state to the determined index and the target state to the state that is one timestamp later than the start
-        // state. These are the two states we want to interpolate between because those states are the closest to the targeted delay. The
-        // interpolation ratio tells us how far in between the two states we should be based on the interpolation time.
-        CurrentStartStateIndex = Index;
-        OutStartState = bUsingExtrapolatedData ? ExtrapolatedState : StateQueue[CurrentStartStateIndex];
-        CurrentTargetStateIndex = Index + 1;
-        OutTargetState = StateQueue[CurrentTargetStateIndex];
-        OutInterpolationRatio =
-          (Time - OutStartState.Timestamp) / FMath::Max(OutTargetState.Timestamp - OutStartState.Timestamp, MIN_DELTA_TIME);
-        return;
+        bUsingExtrapolatedData = false;
       }
+
+      // Set the starting state to the determined index and the target state to the state that is one timestamp later than the start
+      // state. These are the two states we want to interpolate between because those states are the closest to the targeted delay. The
+      // interpolation ratio tells us how far in between the two states we should be based on the interpolation time.
+      CurrentStartStateIndex = StartIndex;
+      OutStartState = bUsingExtrapolatedData ? ExtrapolatedState : StateQueue[CurrentStartStateIndex];
+      CurrentTargetStateIndex = TargetIndex;
+      OutTargetState = StateQueue[CurrentTargetStateIndex];
+      OutInterpolationRatio =
+        (Time - OutStartState.Timestamp) / FMath::Max(OutTargetState.Timestamp - OutStartState.Timestamp, MIN_DELTA_TIME);
+      return;
     }
     GMC_LOG(
       VeryVerbose,
@@ -3189,6 +4259,40 @@ FState UGenMovementReplicationComponent::InterpolateCubic(
   return Result;
 }
 
+void UGenMovementReplicationComponent::CacheBlueprintHooks()
+{
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Server_PreRemoteMoveExecution);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Server_PostRemoteMoveExecution);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Client_PreReplayMoveExecution);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Client_PostReplayMoveExecution);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Client_ShouldEnqueueMove_Custom);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, OnImmediateStateLoaded);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, OnSimulatedStateLoaded);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, InterpolateCustom1);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, InterpolateCustom2);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, InterpolateCustom3);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, InterpolateCustom4);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Server_PreRemoteMovesProcessing);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Server_OnRemoteMovesProcessed);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenMovementReplicationComponent, Server_OnResolveClientDiscrepancy);
+}
+
+void UGenMovementReplicationComponent::CacheBlueprintHook(int32 Hook, FName FunctionName)
+{
+  check(Hook >= 0 && Hook < 64)
+  // Native classes never implement functions in script, only Blueprint generated classes do.
+  const bool bIsBlueprintHook = !GMCCVars::NativeHookDispatch || GetClass()->IsFunctionImplementedInScript(FunctionName);
+  CachedBlueprintHooks |= 1ull << Hook;
+  if (bIsBlueprintHook)
+  {
+    BlueprintHooks |= 1ull << Hook;
+  }
+  else
+  {
+    BlueprintHooks &= ~(1ull << Hook);
+  }
+}
+
 FState UGenMovementReplicationComponent::InterpolateCustom1_Implementation(
   const FState& StartState,
   const FState& TargetState,
@@ -3332,25 +4436,25 @@ void UGenMovementReplicationComponent::DetermineSkippedStates(TArray<int32>& Out
       // We have not interpolated between the current start state and the previous target state but we didn't skip any state.
       return;
     }
-    // We skipped one or more states.
-    int32 CheckIndex = CurrentStartStateIndex - 2;
-    while (IsValidStateQueueIndex(CheckIndex))
+    // We skipped one or more states. Search for the previous target state among the states older than the one before the current start
+    // state.
+    const int32 PreviousTargetIndex = StateQueue.UpperBound(PreviousInterpolationTargetStateTimestamp, CurrentStartStateIndex - 1) - 1;
+    const bool bFoundPreviousTarget =
+      IsValidStateQueueIndex(PreviousTargetIndex) && StateQueue[PreviousTargetIndex].Timestamp == PreviousInterpolationTargetStateTimestamp;
+    // The skipped states are all states with a timestamp larger than the previous target state but smaller than the current start state.
+    // If the previous target state was not found all older states are considered skipped.
+    const int32 OldestSkippedIndex = bFoundPreviousTarget ? PreviousTargetIndex + 1 : 0;
+    for (int32 SkippedIndex = CurrentStartStateIndex - 1; SkippedIndex >= OldestSkippedIndex; --SkippedIndex)
     {
-      // We skipped the state at index "CheckIndex + 1".
-      OutSkippedStateIndices.Emplace(CheckIndex + 1);
-      if (StateQueue[CheckIndex].Timestamp == PreviousInterpolationTargetStateTimestamp)
-      {
-        // We found the last target state and return the indices of the skipped states, which are all states with a timestamp larger than
-        // the previous target state but smaller than the current start state.
-        GMC_LOG(Verbose, TEXT("%d states were skipped during interpolation."), OutSkippedStateIndices.Num())
-        return;
-      }
-      --CheckIndex;
+      OutSkippedStateIndices.Emplace(SkippedIndex);
+    }
+    if (bFoundPreviousTarget)
+    {
+      GMC_LOG(Verbose, TEXT("%d states were skipped during interpolation."), OutSkippedStateIndices.Num())
+      return;
     }
     // The oldest state in the queue is newer than the previous target state. This can happen during bad latency spikes or if the configured
     // state queue max size is too small.
-    checkGMC(CheckIndex + 1 == 0)
-    OutSkippedStateIndices.Emplace(0);
     GMC_LOG(Verbose, TEXT("Previous target state was already deleted from the state queue."))
   }
 }
@@ -3436,16 +4540,24 @@ void UGenMovementReplicationComponent::SetInterpolationMethod(EInterpolationMeth
       InterpolationFunction = &UGenMovementReplicationComponent::InterpolateCubic;
       return;
     case EInterpolationMethod::Custom1:
-      InterpolationFunction = &UGenMovementReplicationComponent::InterpolateCustom1;
+      InterpolationFunction = IsBlueprintHook(Hook_InterpolateCustom1)
+        ? &UGenMovementReplicationComponent::InterpolateCustom1
+        : &UGenMovementReplicationComponent::InterpolateCustom1_Implementation;
       return;
     case EInterpolationMethod::Custom2:
-      InterpolationFunction = &UGenMovementReplicationComponent::InterpolateCustom2;
+      InterpolationFunction = IsBlueprintHook(Hook_InterpolateCustom2)
+        ? &UGenMovementReplicationComponent::InterpolateCustom2
+        : &UGenMovementReplicationComponent::InterpolateCustom2_Implementation;
       return;
     case EInterpolationMethod::Custom3:
-      InterpolationFunction = &UGenMovementReplicationComponent::InterpolateCustom3;
+      InterpolationFunction = IsBlueprintHook(Hook_InterpolateCustom3)
+        ? &UGenMovementReplicationComponent::InterpolateCustom3
+        : &UGenMovementReplicationComponent::InterpolateCustom3_Implementation;
       return;
     case EInterpolationMethod::Custom4:
-      InterpolationFunction = &UGenMovementReplicationComponent::InterpolateCustom4;
+      InterpolationFunction = IsBlueprintHook(Hook_InterpolateCustom4)
+        ? &UGenMovementReplicationComponent::InterpolateCustom4
+        : &UGenMovementReplicationComponent::InterpolateCustom4_Implementation;
       return;
     default: checkNoEntryGMC();
   }
@@ -3473,12 +4585,13 @@ bool UGenMovementReplicationComponent::AddToStateQueue(const FState& State)
     // However, in some circumstances this can still occur e.g. when a client gets assigned a different pawn by the server.
     return false;
   }
-  StateQueue.Emplace(State);
-  // If the queue reached the desired size, we delete the oldest state in the buffer.
-  if (StateQueue.Num() >= StateQueueMaxSize)
+  if (StateQueue.Max() != FMath::Max(StateQueueMaxSize, 1))
   {
-    StateQueue.RemoveAt(0, 1, false/*don't shrink*/);
+    // The max size was changed at runtime.
+    StateQueue.SetCapacity(FMath::Max(StateQueueMaxSize, 1));
   }
+  // If the queue reached the desired size, the oldest state in the buffer gets overwritten.
+  StateQueue.Add(State);
   return true;
 }
 
@@ -3515,13 +4628,11 @@ TArray<AGenPawn*> UGenMovementReplicationComponent::GatherRollbackPawns() const
   {
     checkGMC(IsAutonomousProxy())
     checkGMC(bRollbackClientPawns)
-    // Gather pawns for client rollback.
-    TArray<AActor*> Actors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGenPawn::StaticClass(), Actors);
-    for (const auto Actor : Actors)
+    // Gather pawns for client rollback. Only simulated proxies are rolled back on the client (@see ShouldBeRolledBack).
+    if (!WorldSubsystem) return RollbackPawns;
+    for (const auto ReplicationComponent : WorldSubsystem->GetReplicationComponents(EGenReplicationRole::SimulatedProxy))
     {
-      const auto GenPawn = Cast<AGenPawn>(Actor);
-      check(GenPawn)
+      const auto GenPawn = ReplicationComponent->GetGenPawnOwner();
       if (!ShouldBeRolledBack(GenPawn))
       {
         continue;
@@ -3572,12 +4683,10 @@ bool UGenMovementReplicationComponent::ShouldBeRolledBack(const APawn* PawnToTes
     // Rollback does not work without a consistent simulation delay.
     return false;
   }
-  if (const auto Controller = PawnOwner->GetController())
+  const auto Controller = PawnOwner->GetController();
+  if (Controller && WorldSubsystem)
   {
-    FRotator ViewRotation{0};
-    FVector ViewLocation{0};
-    Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
-    if (!GenPawnToTest->IsNetRelevantFor(Controller, PawnOwner, ViewLocation))
+    if (!WorldSubsystem->IsNetRelevantFor(GenPawnToTest, Controller))
     {
       // The considered pawn is not net relevant to this pawn meaning there either won't be any current states in its state queue (on the
       // client) or none of the states in the queue will be marked as replicated (on the server).
@@ -3633,7 +4742,14 @@ void UGenMovementReplicationComponent::RollbackPawns(float Time, const TArray<AG
     FState StartState;
     FState TargetState;
     float InterpolationRatio{-1.f};
-    if (!ComputeRollbackInput(Time, StateQueueOther, StartState, TargetState, InterpolationRatio))
+    if (!ComputeRollbackInput(
+      Time,
+      StateQueueOther,
+      ReplicationComponent->Server_BaselineStore_SimulatedProxy,
+      StartState,
+      TargetState,
+      InterpolationRatio
+    ))
     {
       GMC_LOG(
         Verbose,
@@ -3656,7 +4772,8 @@ void UGenMovementReplicationComponent::RollbackPawns(float Time, const TArray<AG
 
 bool UGenMovementReplicationComponent::ComputeRollbackInput(
   float Time,
-  const TArray<FState>& StateQueueToSearch,
+  const TGenRingBuffer<FState>& StateQueueToSearch,
+  const FSerializationBaselineStore& BaselineStoreToSearch,
   FState& OutStartState,
   FState& OutTargetState,
   float& OutInterpolationRatio
@@ -3669,98 +4786,59 @@ bool UGenMovementReplicationComponent::ComputeRollbackInput(
   OutStartState = FState();
   OutTargetState = FState();
   OutInterpolationRatio = -1.f;
-  const int32 QueueSize{StateQueueToSearch.Num()};
-  int32 Index{0};
+  int32 StartIndex{INDEX_NONE};
+  int32 TargetIndex{INDEX_NONE};
 
-  // It is very likely that we need quite recent states so we go through the queue from newest to oldest.
   if (IsServerPawn())
   {
     checkGMC(bRollbackServerPawns)
-    for (Index = QueueSize - 1; Index >= 0; --Index)
+    // Not every state was replicated to the owning connection, so the start and target states are searched among the states that were
+    // actually sent to the client. The start state is the newest replicated state not newer than the passed time, the target state the next
+    // replicated state after that.
+    const FConnectionBaseline* Baseline = BaselineStoreToSearch.Connections.Find(OwningConnection);
+    if (!Baseline)
     {
-      const FState& State = StateQueueToSearch[Index];
-      if (!State.LastSerialized.Contains(OwningConnection))
-      {
-        // This usually happens when a new client just (dis)connected.
-        continue;
-      }
-      const float Timestamp = State.Timestamp;
-      if (Timestamp > Time)
-      {
-        continue;
-      }
-      // Check if the currently considered state was actually replicated to the client.
-      if (State.LastSerialized[OwningConnection].bReplicatedToSimulatedProxy)
-      {
-        OutStartState = State;
-        break;
-      }
+      // This usually happens when a new client just (dis)connected.
+      return false;
     }
+    int32 StartRecordIndex{INDEX_NONE};
+    int32 TargetRecordIndex{INDEX_NONE};
+    Baseline->ReplicatedStates.FindBracketingStates(Time, StartRecordIndex, TargetRecordIndex);
+    const auto FindStateIndex = [&StateQueueToSearch](const FReplicatedStateRecord& Record)
+    {
+      const int32 Index = StateQueueToSearch.UpperBound(Record.Timestamp) - 1;
+      return StateQueueToSearch.IsValidIndex(Index) && StateQueueToSearch[Index].Timestamp == Record.Timestamp ? Index : INDEX_NONE;
+    };
+    if (StartRecordIndex != INDEX_NONE) StartIndex = FindStateIndex(Baseline->ReplicatedStates[StartRecordIndex]);
+    if (TargetRecordIndex != INDEX_NONE) TargetIndex = FindStateIndex(Baseline->ReplicatedStates[TargetRecordIndex]);
   }
   else
   {
     checkGMC(IsAutonomousProxy())
     checkGMC(bRollbackClientPawns)
-    for (Index = QueueSize - 1; Index >= 0; --Index)
-    {
-      const FState& State = StateQueueToSearch[Index];
-      const float Timestamp = State.Timestamp;
-      if (Timestamp > Time)
-      {
-        continue;
-      }
-      OutStartState = State;
-      break;
-    }
+    // The target state is simply the next state in the queue after the start state.
+    StateQueueToSearch.FindBracketingStates(Time, StartIndex, TargetIndex);
   }
-  if (Index < 0)
+
+  if (StartIndex == INDEX_NONE)
   {
     // Start state was not found in the queue.
-    checkGMC(!OutStartState.IsValid())
-    checkGMC(!OutTargetState.IsValid())
-    checkGMC(OutInterpolationRatio == -1.f)
     return false;
   }
+  OutStartState = StateQueueToSearch[StartIndex];
   checkGMC(OutStartState.Timestamp >= 0)
 
-  if (IsServerPawn())
+  if (TargetIndex == INDEX_NONE)
   {
-    checkGMC(bRollbackServerPawns)
-    // We have found the start state, go back up through the queue and find the target state which is the next state with a greater
-    // timestamp that was also replicated.
-    while (++Index < QueueSize)
-    {
-      const FState& NextState = StateQueueToSearch[Index];
-      if (NextState.LastSerialized[OwningConnection].bReplicatedToSimulatedProxy)
-      {
-        OutTargetState = NextState;
-        OutInterpolationRatio =
-          (Time - OutStartState.Timestamp) / FMath::Max(OutTargetState.Timestamp - OutStartState.Timestamp, MIN_DELTA_TIME);
-        checkGMC(OutInterpolationRatio >= 0.f)
-        checkGMC(OutInterpolationRatio <= 1.f + KINDA_SMALL_NUMBER)
-        return true;
-      }
-    }
-  }
-  else
-  {
-    checkGMC(IsAutonomousProxy())
-    checkGMC(bRollbackClientPawns)
-    // We have found the start state, the target state is the next state in the queue.
-    if (++Index < QueueSize)
-    {
-      OutTargetState = StateQueueToSearch[Index];
-      OutInterpolationRatio =
-        (Time - OutStartState.Timestamp) / FMath::Max(OutTargetState.Timestamp - OutStartState.Timestamp, MIN_DELTA_TIME);
-      checkGMC(OutInterpolationRatio >= 0.f)
-      checkGMC(OutInterpolationRatio <= 1.f + KINDA_SMALL_NUMBER)
-      return true;
-    }
+    // Target state was not found in the queue.
+    return false;
   }
-
-  checkGMC(!OutTargetState.IsValid())
-  checkGMC(OutInterpolationRatio == -1.f)
-  return false;
+  OutTargetState = StateQueueToSearch[TargetIndex];
+  OutInterpolationRatio =
+    (Time - OutStartState.Timestamp) / FMath::Max(OutTargetState.Timestamp - OutStartState.Timestamp, MIN_DELTA_TIME);
+  checkGMC(OutInterpolationRatio >= 0.f)
+  checkGMC(OutInterpolationRatio <= 1.f + KINDA_SMALL_NUMBER)
+  return true;
 }
 
 void UGenMovementReplicationComponent::RestoreRolledBackPawns(const TArray<AGenPawn*>& PawnsToRestore) const
@@ -3872,6 +4950,41 @@ bool UGenMovementReplicationComponent::IsServerBot() const
   return false;
 }
 
+EGenReplicationRole UGenMovementReplicationComponent::GetReplicationRole() const
+{
+  switch (PawnOwner->GetLocalRole())
+  {
+    case ROLE_AutonomousProxy: return EGenReplicationRole::AutonomousProxy;
+    case ROLE_SimulatedProxy: return EGenReplicationRole::SimulatedProxy;
+    case ROLE_Authority:
+    {
+      if (!PawnOwner->GetController()) return EGenReplicationRole::ServerUnpossessed;
+      if (!PawnOwner->IsLocallyControlled()) return EGenReplicationRole::ServerRemote;
+      if (Cast<AAIController>(PawnOwner->GetController())) return EGenReplicationRole::ServerBot;
+      return EGenReplicationRole::ServerLocal;
+    }
+    default: return EGenReplicationRole::None;
+  }
+}
+
+void UGenMovementReplicationComponent::UpdateWorldRegistration()
+{
+  if (!WorldSubsystem) return;
+  const EGenReplicationRole CurrentRole = GetReplicationRole();
+  if (CurrentRole != RegisteredRole)
+  {
+    WorldSubsystem->UnregisterReplicationComponent(this, RegisteredRole);
+    WorldSubsystem->RegisterReplicationComponent(this, CurrentRole);
+    RegisteredRole = CurrentRole;
+  }
+}
+
+float UGenMovementReplicationComponent::GetDejitterBufferOccupancy() const
+{
+  if (Server_DejitterBuffer.Num() == 0 || Server_DejitterPlayoutTime < 0.f) return 0.f;
+  return FMath::Max(Server_GetNewestReceivedMoveTimestamp() - Server_DejitterPlayoutTime, 0.f);
+}
+
 bool UGenMovementReplicationComponent::IsNetworkedServer() const
 {
   return IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer);
@@ -4024,6 +5137,78 @@ void UGenMovementReplicationComponent::BindInputFlag(
   if (Owner->ID_Action16 == ActionName) { if (!InputFlag16) { InputFlag16 = &VariableToBind; checkGMC(!ServerState_AutonomousProxy().bReplicateInputFlag16) if (bNoMoveCombine) { bNoMoveCombineInputFlag16 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicateInputFlag16 = true; } return; } UE_LOG(LogGMCReplication, Error, TEXT("Action \"%s\" is already bound to a variable."), *ActionName.ToString()) return; }
 }
 
+// Declares the value range of the variable that was bound last. Does nothing if the binding itself failed (which was already reported).
+template<typename TraitsType>
+static void SetLastBoundSlotQuantization(
+  TGenBoundSlots<TraitsType>& Slots,
+  const typename TraitsType::ValueType& Variable,
+  double Min,
+  double Max,
+  double Precision
+)
+{
+  const int32 Slot = Slots.Num() - 1;
+  if (Slot == INDEX_NONE || Slots.GetVariable(Slot) != &Variable) return;
+  if (!Slots.SetQuantization(Slot, Min, Max, Precision))
+  {
+    UE_LOG(
+      LogGMCReplication,
+      Error,
+      TEXT("Invalid value range for bound data slot %d (min: %f, max: %f, precision: %f), the variable is replicated at full precision."),
+      Slot + 1,
+      Min,
+      Max,
+      Precision
+    )
+  }
+}
+
+void UGenMovementReplicationComponent::BindQuantizedInt(
+  int32& VariableToBind,
+  int32 Min,
+  int32 Max,
+  bool bReplicateToAutonomousProxy,
+  bool bReplicateToSimulatedProxy,
+  bool bForceNetUpdateOnChange
+)
+{
+  BindInt(VariableToBind, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  SetLastBoundSlotQuantization(IntSlots, VariableToBind, Min, Max, 1.);
+}
+
+void UGenMovementReplicationComponent::BindQuantizedFloat(
+  float& VariableToBind,
+  float Min,
+  float Max,
+  float Precision,
+  bool bReplicateToAutonomousProxy,
+  bool bReplicateToSimulatedProxy,
+  bool bForceNetUpdateOnChange
+)
+{
+  BindFloat(VariableToBind, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  SetLastBoundSlotQuantization(FloatSlots, VariableToBind, Min, Max, Precision);
+}
+
+void UGenMovementReplicationComponent::BindQuantizedVector(
+  FVector& VariableToBind,
+  float Min,
+  float Max,
+  float Precision,
+  bool bReplicateToAutonomousProxy,
+  bool bReplicateToSimulatedProxy,
+  bool bForceNetUpdateOnChange
+)
+{
+  BindVector(VariableToBind, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  SetLastBoundSlotQuantization(VectorSlots, VariableToBind, Min, Max, Precision);
+}
+
+void UGenMovementReplicationComponent::LogBoundDataBits()
+{
+  LogBoundDataBits_IMPLEMENTATION()
+}
+
 void UGenMovementReplicationComponent::Server_SwapStateBufferBoundInputFlags()
 {
   checkGMC(IsServerPawn())
@@ -4115,6 +5300,30 @@ void UGenMovementReplicationComponent::Server_ResetLockedBoundInputFlags()
   if (bLockedInputFlag16) { ResetLockTimerInputFlag16 = CurrentTime - LockSetTimeInputFlag16; if (ResetLockTimerInputFlag16 > MinRepHoldTime) { bLockedInputFlag16 = false; ResetLockTimerInputFlag16 = 0.f; } }
 }
 
+bool UGenMovementReplicationComponent::Client_ReplayMergeCheckBoundInputFlags(const FMove& FirstMove, const FMove& NextMove) const
+{
+  checkGMC(IsAutonomousProxy())
+  // Same rules as for enqueueing: a changed input flag or an active flag that was bound with the no-move-combine-flag prevents merging.
+  // @attention Input flags can be skipped during binding so we don't return false when we encounter the first variable that is nullptr.
+  if (InputFlag1)  { if (FirstMove.bInputFlag1  != NextMove.bInputFlag1  || NextMove.bInputFlag1  && bNoMoveCombineInputFlag1)  return true; }
+  if (InputFlag2)  { if (FirstMove.bInputFlag2  != NextMove.bInputFlag2  || NextMove.bInputFlag2  && bNoMoveCombineInputFlag2)  return true; }
+  if (InputFlag3)  { if (FirstMove.bInputFlag3  != NextMove.bInputFlag3  || NextMove.bInputFlag3  && bNoMoveCombineInputFlag3)  return true; }
+  if (InputFlag4)  { if (FirstMove.bInputFlag4  != NextMove.bInputFlag4  || NextMove.bInputFlag4  && bNoMoveCombineInputFlag4)  return true; }
+  if (InputFlag5)  { if (FirstMove.bInputFlag5  != NextMove.bInputFlag5  || NextMove.bInputFlag5  && bNoMoveCombineInputFlag5)  return true; }
+  if (InputFlag6)  { if (FirstMove.bInputFlag6  != NextMove.bInputFlag6  || NextMove.bInputFlag6  && bNoMoveCombineInputFlag6)  return true; }
+  if (InputFlag7)  { if (FirstMove.bInputFlag7  != NextMove.bInputFlag7  || NextMove.bInputFlag7  && bNoMoveCombineInputFlag7)  return true; }
+  if (InputFlag8)  { if (FirstMove.bInputFlag8  != NextMove.bInputFlag8  || NextMove.bInputFlag8  && bNoMoveCombineInputFlag8)  return true; }
+  if (InputFlag9)  { if (FirstMove.bInputFlag9  != NextMove.bInputFlag9  || NextMove.bInputFlag9  && bNoMoveCombineInputFlag9)  return true; }
+  if (InputFlag10) { if (FirstMove.bInputFlag10 != NextMove.bInputFlag10 || NextMove.bInputFlag10 && bNoMoveCombineInputFlag10) return true; }
+  if (InputFlag11) { if (FirstMove.bInputFlag11 != NextMove.bInputFlag11 || NextMove.bInputFlag11 && bNoMoveCombineInputFlag11) return true; }
+  if (InputFlag12) { if (FirstMove.bInputFlag12 != NextMove.bInputFlag12 || NextMove.bInputFlag12 && bNoMoveCombineInputFlag12) return true; }
+  if (InputFlag13) { if (FirstMove.bInputFlag13 != NextMove.bInputFlag13 || NextMove.bInputFlag13 && bNoMoveCombineInputFlag13) return true; }
+  if (InputFlag14) { if (FirstMove.bInputFlag14 != NextMove.bInputFlag14 || NextMove.bInputFlag14 && bNoMoveCombineInputFlag14) return true; }
+  if (InputFlag15) { if (FirstMove.bInputFlag15 != NextMove.bInputFlag15 || NextMove.bInputFlag15 && bNoMoveCombineInputFlag15) return true; }
+  if (InputFlag16) { if (FirstMove.bInputFlag16 != NextMove.bInputFlag16 || NextMove.bInputFlag16 && bNoMoveCombineInputFlag16) return true; }
+  return false;
+}
+
 bool UGenMovementReplicationComponent::Client_EnqueueMoveCheckBoundInputFlags(const FMove& CurrentMove) const
 {
   checkGMC(IsAutonomousProxy())
@@ -4324,6 +5533,13 @@ bool UGenMovementReplicationComponent::Server_ForceNetUpdateCheckBoundData()
   return bShouldForceNetUpdate;
 }
 
+bool UGenMovementReplicationComponent::Server_CaptureCheckBoundData() const
+{
+  checkGMC(IsServerPawn())
+  CaptureCheckBoundData_IMPLEMENTATION()
+  return false;
+}
+
 void UGenMovementReplicationComponent::Server_SaveBoundDataToServerState(FState& ServerState, ENetRole RecipientRole) const
 {
   checkGMC(IsServerPawn())
@@ -4345,6 +5561,14 @@ bool UGenMovementReplicationComponent::Client_IsBoundDataValid(const FMove& Sour
   return true;
 }
 
+bool UGenMovementReplicationComponent::Client_IsReplayedBoundDataConverged(const FMove& ReplayedMove, const FMove& PredictedMove) const
+{
+  checkGMC(IsAutonomousProxy())
+  IsReplayedBoundDataConverged_IMPLEMENTATION()
+  // @attention We can return from inside the macro so this section of the function is not always reached.
+  return true;
+}
+
 void UGenMovementReplicationComponent::Client_UnpackBoundData(FState& ServerState) const
 {
   checkGMC(IsAutonomousProxy() || IsSimulatedProxy())
@@ -4379,6 +5603,11 @@ void UGenMovementReplicationComponent::LoadInBoundDataFromMove(const FMove& Move
   LoadInBoundDataFromMove_IMPLEMENTATION()
 }
 
+void UGenMovementReplicationComponent::LoadOutBoundDataFromMove(const FMove& Move) const
+{
+  LoadOutBoundDataFromMove_IMPLEMENTATION()
+}
+
 void UGenMovementReplicationComponent::LoadBoundDataFromState(const FState& State) const
 {
   LoadBoundDataFromState_IMPLEMENTATION()
@@ -4404,22 +5633,22 @@ bool UGenMovementReplicationComponent::Client_IsValidFloat(const FMove& SourceMo
   checkGMC(IsAutonomousProxy())
   const auto& ServerState = ServerState_AutonomousProxy();
   constexpr float COMPARE_TOLERANCE = 0.000001f;
-  if (Float1)  { if (ServerState.bReplicateFloat1  && !FMath::IsNearlyEqual(ServerState.Float1,  SourceMove.OutFloat1,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float1  (%f) != SourceMove.OutFloat1  (%f)"), ServerState.Float1,  SourceMove.OutFloat1)  return false; } } else return true;
-  if (Float2)  { if (ServerState.bReplicateFloat2  && !FMath::IsNearlyEqual(ServerState.Float2,  SourceMove.OutFloat2,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float2  (%f) != SourceMove.OutFloat2  (%f)"), ServerState.Float2,  SourceMove.OutFloat2)  return false; } } else return true;
-  if (Float3)  { if (ServerState.bReplicateFloat3  && !FMath::IsNearlyEqual(ServerState.Float3,  SourceMove.OutFloat3,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float3  (%f) != SourceMove.OutFloat3  (%f)"), ServerState.Float3,  SourceMove.OutFloat3)  return false; } } else return true;
-  if (Float4)  { if (ServerState.bReplicateFloat4  && !FMath::IsNearlyEqual(ServerState.Float4,  SourceMove.OutFloat4,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float4  (%f) != SourceMove.OutFloat4  (%f)"), ServerState.Float4,  SourceMove.OutFloat4)  return false; } } else return true;
-  if (Float5)  { if (ServerState.bReplicateFloat5  && !FMath::IsNearlyEqual(ServerState.Float5,  SourceMove.OutFloat5,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float5  (%f) != SourceMove.OutFloat5  (%f)"), ServerState.Float5,  SourceMove.OutFloat5)  return false; } } else return true;
-  if (Float6)  { if (ServerState.bReplicateFloat6  && !FMath::IsNearlyEqual(ServerState.Float6,  SourceMove.OutFloat6,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float6  (%f) != SourceMove.OutFloat6  (%f)"), ServerState.Float6,  SourceMove.OutFloat6)  return false; } } else return true;
-  if (Float7)  { if (ServerState.bReplicateFloat7  && !FMath::IsNearlyEqual(ServerState.Float7,  SourceMove.OutFloat7,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float7  (%f) != SourceMove.OutFloat7  (%f)"), ServerState.Float7,  SourceMove.OutFloat7)  return false; } } else return true;
-  if (Float8)  { if (ServerState.bReplicateFloat8  && !FMath::IsNearlyEqual(ServerState.Float8,  SourceMove.OutFloat8,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float8  (%f) != SourceMove.OutFloat8  (%f)"), ServerState.Float8,  SourceMove.OutFloat8)  return false; } } else return true;
-  if (Float9)  { if (ServerState.bReplicateFloat9  && !FMath::IsNearlyEqual(ServerState.Float9,  SourceMove.OutFloat9,  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float9  (%f) != SourceMove.OutFloat9  (%f)"), ServerState.Float9,  SourceMove.OutFloat9)  return false; } } else return true;
-  if (Float10) { if (ServerState.bReplicateFloat10 && !FMath::IsNearlyEqual(ServerState.Float10, SourceMove.OutFloat10, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float10 (%f) != SourceMove.OutFloat10 (%f)"), ServerState.Float10, SourceMove.OutFloat10) return false; } } else return true;
-  if (Float11) { if (ServerState.bReplicateFloat11 && !FMath::IsNearlyEqual(ServerState.Float11, SourceMove.OutFloat11, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float11 (%f) != SourceMove.OutFloat11 (%f)"), ServerState.Float11, SourceMove.OutFloat11) return false; } } else return true;
-  if (Float12) { if (ServerState.bReplicateFloat12 && !FMath::IsNearlyEqual(ServerState.Float12, SourceMove.OutFloat12, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float12 (%f) != SourceMove.OutFloat12 (%f)"), ServerState.Float12, SourceMove.OutFloat12) return false; } } else return true;
-  if (Float13) { if (ServerState.bReplicateFloat13 && !FMath::IsNearlyEqual(ServerState.Float13, SourceMove.OutFloat13, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float13 (%f) != SourceMove.OutFloat13 (%f)"), ServerState.Float13, SourceMove.OutFloat13) return false; } } else return true;
-  if (Float14) { if (ServerState.bReplicateFloat14 && !FMath::IsNearlyEqual(ServerState.Float14, SourceMove.OutFloat14, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float14 (%f) != SourceMove.OutFloat14 (%f)"), ServerState.Float14, SourceMove.OutFloat14) return false; } } else return true;
-  if (Float15) { if (ServerState.bReplicateFloat15 && !FMath::IsNearlyEqual(ServerState.Float15, SourceMove.OutFloat15, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float15 (%f) != SourceMove.OutFloat15 (%f)"), ServerState.Float15, SourceMove.OutFloat15) return false; } } else return true;
-  if (Float16) { if (ServerState.bReplicateFloat16 && !FMath::IsNearlyEqual(ServerState.Float16, SourceMove.OutFloat16, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float16 (%f) != SourceMove.OutFloat16 (%f)"), ServerState.Float16, SourceMove.OutFloat16) return false; } } else return true;
+  if (Float1)  { if (ServerState.bReplicateFloat1  && !FMath::IsNearlyEqual(ServerState.Float1,  FloatSlots.QuantizeValue(0, SourceMove.OutFloat1),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float1  (%f) != SourceMove.OutFloat1  (%f)"), ServerState.Float1,  SourceMove.OutFloat1)  return false; } } else return true;
+  if (Float2)  { if (ServerState.bReplicateFloat2  && !FMath::IsNearlyEqual(ServerState.Float2,  FloatSlots.QuantizeValue(1, SourceMove.OutFloat2),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float2  (%f) != SourceMove.OutFloat2  (%f)"), ServerState.Float2,  SourceMove.OutFloat2)  return false; } } else return true;
+  if (Float3)  { if (ServerState.bReplicateFloat3  && !FMath::IsNearlyEqual(ServerState.Float3,  FloatSlots.QuantizeValue(2, SourceMove.OutFloat3),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float3  (%f) != SourceMove.OutFloat3  (%f)"), ServerState.Float3,  SourceMove.OutFloat3)  return false; } } else return true;
+  if (Float4)  { if (ServerState.bReplicateFloat4  && !FMath::IsNearlyEqual(ServerState.Float4,  FloatSlots.QuantizeValue(3, SourceMove.OutFloat4),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float4  (%f) != SourceMove.OutFloat4  (%f)"), ServerState.Float4,  SourceMove.OutFloat4)  return false; } } else return true;
+  if (Float5)  { if (ServerState.bReplicateFloat5  && !FMath::IsNearlyEqual(ServerState.Float5,  FloatSlots.QuantizeValue(4, SourceMove.OutFloat5),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float5  (%f) != SourceMove.OutFloat5  (%f)"), ServerState.Float5,  SourceMove.OutFloat5)  return false; } } else return true;
+  if (Float6)  { if (ServerState.bReplicateFloat6  && !FMath::IsNearlyEqual(ServerState.Float6,  FloatSlots.QuantizeValue(5, SourceMove.OutFloat6),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float6  (%f) != SourceMove.OutFloat6  (%f)"), ServerState.Float6,  SourceMove.OutFloat6)  return false; } } else return true;
+  if (Float7)  { if (ServerState.bReplicateFloat7  && !FMath::IsNearlyEqual(ServerState.Float7,  FloatSlots.QuantizeValue(6, SourceMove.OutFloat7),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float7  (%f) != SourceMove.OutFloat7  (%f)"), ServerState.Float7,  SourceMove.OutFloat7)  return false; } } else return true;
+  if (Float8)  { if (ServerState.bReplicateFloat8  && !FMath::IsNearlyEqual(ServerState.Float8,  FloatSlots.QuantizeValue(7, SourceMove.OutFloat8),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float8  (%f) != SourceMove.OutFloat8  (%f)"), ServerState.Float8,  SourceMove.OutFloat8)  return false; } } else return true;
+  if (Float9)  { if (ServerState.bReplicateFloat9  && !FMath::IsNearlyEqual(ServerState.Float9,  FloatSlots.QuantizeValue(8, SourceMove.OutFloat9),  COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float9  (%f) != SourceMove.OutFloat9  (%f)"), ServerState.Float9,  SourceMove.OutFloat9)  return false; } } else return true;
+  if (Float10) { if (ServerState.bReplicateFloat10 && !FMath::IsNearlyEqual(ServerState.Float10, FloatSlots.QuantizeValue(9, SourceMove.OutFloat10), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float10 (%f) != SourceMove.OutFloat10 (%f)"), ServerState.Float10, SourceMove.OutFloat10) return false; } } else return true;
+  if (Float11) { if (ServerState.bReplicateFloat11 && !FMath::IsNearlyEqual(ServerState.Float11, FloatSlots.QuantizeValue(10, SourceMove.OutFloat11), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float11 (%f) != SourceMove.OutFloat11 (%f)"), ServerState.Float11, SourceMove.OutFloat11) return false; } } else return true;
+  if (Float12) { if (ServerState.bReplicateFloat12 && !FMath::IsNearlyEqual(ServerState.Float12, FloatSlots.QuantizeValue(11, SourceMove.OutFloat12), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float12 (%f) != SourceMove.OutFloat12 (%f)"), ServerState.Float12, SourceMove.OutFloat12) return false; } } else return true;
+  if (Float13) { if (ServerState.bReplicateFloat13 && !FMath::IsNearlyEqual(ServerState.Float13, FloatSlots.QuantizeValue(12, SourceMove.OutFloat13), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float13 (%f) != SourceMove.OutFloat13 (%f)"), ServerState.Float13, SourceMove.OutFloat13) return false; } } else return true;
+  if (Float14) { if (ServerState.bReplicateFloat14 && !FMath::IsNearlyEqual(ServerState.Float14, FloatSlots.QuantizeValue(13, SourceMove.OutFloat14), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float14 (%f) != SourceMove.OutFloat14 (%f)"), ServerState.Float14, SourceMove.OutFloat14) return false; } } else return true;
+  if (Float15) { if (ServerState.bReplicateFloat15 && !FMath::IsNearlyEqual(ServerState.Float15, FloatSlots.QuantizeValue(14, SourceMove.OutFloat15), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float15 (%f) != SourceMove.OutFloat15 (%f)"), ServerState.Float15, SourceMove.OutFloat15) return false; } } else return true;
+  if (Float16) { if (ServerState.bReplicateFloat16 && !FMath::IsNearlyEqual(ServerState.Float16, FloatSlots.QuantizeValue(15, SourceMove.OutFloat16), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Float16 (%f) != SourceMove.OutFloat16 (%f)"), ServerState.Float16, SourceMove.OutFloat16) return false; } } else return true;
   return true;
 }
 
@@ -4427,23 +5656,23 @@ bool UGenMovementReplicationComponent::Client_IsValidVector(const FMove& SourceM
 {
   checkGMC(IsAutonomousProxy())
   const auto& ServerState = ServerState_AutonomousProxy();
-  constexpr float COMPARE_TOLERANCE = 0.01f; // @see SerializeVectorTypes
-  if (Vector1)  { if (ServerState.bReplicateVector1  && !ServerState.Vector1.Equals(SourceMove.OutVector1,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector1  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector1  (X: %f, Y: %f, Z: %f)"), ServerState.Vector1.X,  ServerState.Vector1.Y,  ServerState.Vector1.Z,  SourceMove.OutVector1.X,  SourceMove.OutVector1.Y,  SourceMove.OutVector1.Z)  return false; } } else return true;
-  if (Vector2)  { if (ServerState.bReplicateVector2  && !ServerState.Vector2.Equals(SourceMove.OutVector2,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector2  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector2  (X: %f, Y: %f, Z: %f)"), ServerState.Vector2.X,  ServerState.Vector2.Y,  ServerState.Vector2.Z,  SourceMove.OutVector2.X,  SourceMove.OutVector2.Y,  SourceMove.OutVector2.Z)  return false; } } else return true;
-  if (Vector3)  { if (ServerState.bReplicateVector3  && !ServerState.Vector3.Equals(SourceMove.OutVector3,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector3  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector3  (X: %f, Y: %f, Z: %f)"), ServerState.Vector3.X,  ServerState.Vector3.Y,  ServerState.Vector3.Z,  SourceMove.OutVector3.X,  SourceMove.OutVector3.Y,  SourceMove.OutVector3.Z)  return false; } } else return true;
-  if (Vector4)  { if (ServerState.bReplicateVector4  && !ServerState.Vector4.Equals(SourceMove.OutVector4,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector4  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector4  (X: %f, Y: %f, Z: %f)"), ServerState.Vector4.X,  ServerState.Vector4.Y,  ServerState.Vector4.Z,  SourceMove.OutVector4.X,  SourceMove.OutVector4.Y,  SourceMove.OutVector4.Z)  return false; } } else return true;
-  if (Vector5)  { if (ServerState.bReplicateVector5  && !ServerState.Vector5.Equals(SourceMove.OutVector5,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector5  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector5  (X: %f, Y: %f, Z: %f)"), ServerState.Vector5.X,  ServerState.Vector5.Y,  ServerState.Vector5.Z,  SourceMove.OutVector5.X,  SourceMove.OutVector5.Y,  SourceMove.OutVector5.Z)  return false; } } else return true;
-  if (Vector6)  { if (ServerState.bReplicateVector6  && !ServerState.Vector6.Equals(SourceMove.OutVector6,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector6  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector6  (X: %f, Y: %f, Z: %f)"), ServerState.Vector6.X,  ServerState.Vector6.Y,  ServerState.Vector6.Z,  SourceMove.OutVector6.X,  SourceMove.OutVector6.Y,  SourceMove.OutVector6.Z)  return false; } } else return true;
-  if (Vector7)  { if (ServerState.bReplicateVector7  && !ServerState.Vector7.Equals(SourceMove.OutVector7,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector7  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector7  (X: %f, Y: %f, Z: %f)"), ServerState.Vector7.X,  ServerState.Vector7.Y,  ServerState.Vector7.Z,  SourceMove.OutVector7.X,  SourceMove.OutVector7.Y,  SourceMove.OutVector7.Z)  return false; } } else return true;
-  if (Vector8)  { if (ServerState.bReplicateVector8  && !ServerState.Vector8.Equals(SourceMove.OutVector8,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector8  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector8  (X: %f, Y: %f, Z: %f)"), ServerState.Vector8.X,  ServerState.Vector8.Y,  ServerState.Vector8.Z,  SourceMove.OutVector8.X,  SourceMove.OutVector8.Y,  SourceMove.OutVector8.Z)  return false; } } else return true;
-  if (Vector9)  { if (ServerState.bReplicateVector9  && !ServerState.Vector9.Equals(SourceMove.OutVector9,   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector9  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector9  (X: %f, Y: %f, Z: %f)"), ServerState.Vector9.X,  ServerState.Vector9.Y,  ServerState.Vector9.Z,  SourceMove.OutVector9.X,  SourceMove.OutVector9.Y,  SourceMove.OutVector9.Z)  return false; } } else return true;
-  if (Vector10) { if (ServerState.bReplicateVector10 && !ServerState.Vector10.Equals(SourceMove.OutVector10, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector10 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector10 (X: %f, Y: %f, Z: %f)"), ServerState.Vector10.X, ServerState.Vector10.Y, ServerState.Vector10.Z, SourceMove.OutVector10.X, SourceMove.OutVector10.Y, SourceMove.OutVector10.Z) return false; } } else return true;
-  if (Vector11) { if (ServerState.bReplicateVector11 && !ServerState.Vector11.Equals(SourceMove.OutVector11, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector11 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector11 (X: %f, Y: %f, Z: %f)"), ServerState.Vector11.X, ServerState.Vector11.Y, ServerState.Vector11.Z, SourceMove.OutVector11.X, SourceMove.OutVector11.Y, SourceMove.OutVector11.Z) return false; } } else return true;
-  if (Vector12) { if (ServerState.bReplicateVector12 && !ServerState.Vector12.Equals(SourceMove.OutVector12, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector12 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector12 (X: %f, Y: %f, Z: %f)"), ServerState.Vector12.X, ServerState.Vector12.Y, ServerState.Vector12.Z, SourceMove.OutVector12.X, SourceMove.OutVector12.Y, SourceMove.OutVector12.Z) return false; } } else return true;
-  if (Vector13) { if (ServerState.bReplicateVector13 && !ServerState.Vector13.Equals(SourceMove.OutVector13, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector13 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector13 (X: %f, Y: %f, Z: %f)"), ServerState.Vector13.X, ServerState.Vector13.Y, ServerState.Vector13.Z, SourceMove.OutVector13.X, SourceMove.OutVector13.Y, SourceMove.OutVector13.Z) return false; } } else return true;
-  if (Vector14) { if (ServerState.bReplicateVector14 && !ServerState.Vector14.Equals(SourceMove.OutVector14, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector14 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector14 (X: %f, Y: %f, Z: %f)"), ServerState.Vector14.X, ServerState.Vector14.Y, ServerState.Vector14.Z, SourceMove.OutVector14.X, SourceMove.OutVector14.Y, SourceMove.OutVector14.Z) return false; } } else return true;
-  if (Vector15) { if (ServerState.bReplicateVector15 && !ServerState.Vector15.Equals(SourceMove.OutVector15, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector15 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector15 (X: %f, Y: %f, Z: %f)"), ServerState.Vector15.X, ServerState.Vector15.Y, ServerState.Vector15.Z, SourceMove.OutVector15.X, SourceMove.OutVector15.Y, SourceMove.OutVector15.Z) return false; } } else return true;
-  if (Vector16) { if (ServerState.bReplicateVector16 && !ServerState.Vector16.Equals(SourceMove.OutVector16, COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector16 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector16 (X: %f, Y: %f, Z: %f)"), ServerState.Vector16.X, ServerState.Vector16.Y, ServerState.Vector16.Z, SourceMove.OutVector16.X, SourceMove.OutVector16.Y, SourceMove.OutVector16.Z) return false; } } else return true;
+  constexpr float COMPARE_TOLERANCE = 0.01f; // @see TGenBoundSlotCodec<FVector>
+  if (Vector1)  { if (ServerState.bReplicateVector1  && !ServerState.Vector1.Equals(VectorSlots.QuantizeValue(0, SourceMove.OutVector1),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector1  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector1  (X: %f, Y: %f, Z: %f)"), ServerState.Vector1.X,  ServerState.Vector1.Y,  ServerState.Vector1.Z,  SourceMove.OutVector1.X,  SourceMove.OutVector1.Y,  SourceMove.OutVector1.Z)  return false; } } else return true;
+  if (Vector2)  { if (ServerState.bReplicateVector2  && !ServerState.Vector2.Equals(VectorSlots.QuantizeValue(1, SourceMove.OutVector2),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector2  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector2  (X: %f, Y: %f, Z: %f)"), ServerState.Vector2.X,  ServerState.Vector2.Y,  ServerState.Vector2.Z,  SourceMove.OutVector2.X,  SourceMove.OutVector2.Y,  SourceMove.OutVector2.Z)  return false; } } else return true;
+  if (Vector3)  { if (ServerState.bReplicateVector3  && !ServerState.Vector3.Equals(VectorSlots.QuantizeValue(2, SourceMove.OutVector3),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector3  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector3  (X: %f, Y: %f, Z: %f)"), ServerState.Vector3.X,  ServerState.Vector3.Y,  ServerState.Vector3.Z,  SourceMove.OutVector3.X,  SourceMove.OutVector3.Y,  SourceMove.OutVector3.Z)  return false; } } else return true;
+  if (Vector4)  { if (ServerState.bReplicateVector4  && !ServerState.Vector4.Equals(VectorSlots.QuantizeValue(3, SourceMove.OutVector4),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector4  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector4  (X: %f, Y: %f, Z: %f)"), ServerState.Vector4.X,  ServerState.Vector4.Y,  ServerState.Vector4.Z,  SourceMove.OutVector4.X,  SourceMove.OutVector4.Y,  SourceMove.OutVector4.Z)  return false; } } else return true;
+  if (Vector5)  { if (ServerState.bReplicateVector5  && !ServerState.Vector5.Equals(VectorSlots.QuantizeValue(4, SourceMove.OutVector5),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector5  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector5  (X: %f, Y: %f, Z: %f)"), ServerState.Vector5.X,  ServerState.Vector5.Y,  ServerState.Vector5.Z,  SourceMove.OutVector5.X,  SourceMove.OutVector5.Y,  SourceMove.OutVector5.Z)  return false; } } else return true;
+  if (Vector6)  { if (ServerState.bReplicateVector6  && !ServerState.Vector6.Equals(VectorSlots.QuantizeValue(5, SourceMove.OutVector6),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector6  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector6  (X: %f, Y: %f, Z: %f)"), ServerState.Vector6.X,  ServerState.Vector6.Y,  ServerState.Vector6.Z,  SourceMove.OutVector6.X,  SourceMove.OutVector6.Y,  SourceMove.OutVector6.Z)  return false; } } else return true;
+  if (Vector7)  { if (ServerState.bReplicateVector7  && !ServerState.Vector7.Equals(VectorSlots.QuantizeValue(6, SourceMove.OutVector7),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector7  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector7  (X: %f, Y: %f, Z: %f)"), ServerState.Vector7.X,  ServerState.Vector7.Y,  ServerState.Vector7.Z,  SourceMove.OutVector7.X,  SourceMove.OutVector7.Y,  SourceMove.OutVector7.Z)  return false; } } else return true;
+  if (Vector8)  { if (ServerState.bReplicateVector8  && !ServerState.Vector8.Equals(VectorSlots.QuantizeValue(7, SourceMove.OutVector8),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector8  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector8  (X: %f, Y: %f, Z: %f)"), ServerState.Vector8.X,  ServerState.Vector8.Y,  ServerState.Vector8.Z,  SourceMove.OutVector8.X,  SourceMove.OutVector8.Y,  SourceMove.OutVector8.Z)  return false; } } else return true;
+  if (Vector9)  { if (ServerState.bReplicateVector9  && !ServerState.Vector9.Equals(VectorSlots.QuantizeValue(8, SourceMove.OutVector9),   COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector9  (X: %f, Y: %f, Z: %f) != SourceMove.OutVector9  (X: %f, Y: %f, Z: %f)"), ServerState.Vector9.X,  ServerState.Vector9.Y,  ServerState.Vector9.Z,  SourceMove.OutVector9.X,  SourceMove.OutVector9.Y,  SourceMove.OutVector9.Z)  return false; } } else return true;
+  if (Vector10) { if (ServerState.bReplicateVector10 && !ServerState.Vector10.Equals(VectorSlots.QuantizeValue(9, SourceMove.OutVector10), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector10 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector10 (X: %f, Y: %f, Z: %f)"), ServerState.Vector10.X, ServerState.Vector10.Y, ServerState.Vector10.Z, SourceMove.OutVector10.X, SourceMove.OutVector10.Y, SourceMove.OutVector10.Z) return false; } } else return true;
+  if (Vector11) { if (ServerState.bReplicateVector11 && !ServerState.Vector11.Equals(VectorSlots.QuantizeValue(10, SourceMove.OutVector11), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector11 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector11 (X: %f, Y: %f, Z: %f)"), ServerState.Vector11.X, ServerState.Vector11.Y, ServerState.Vector11.Z, SourceMove.OutVector11.X, SourceMove.OutVector11.Y, SourceMove.OutVector11.Z) return false; } } else return true;
+  if (Vector12) { if (ServerState.bReplicateVector12 && !ServerState.Vector12.Equals(VectorSlots.QuantizeValue(11, SourceMove.OutVector12), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector12 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector12 (X: %f, Y: %f, Z: %f)"), ServerState.Vector12.X, ServerState.Vector12.Y, ServerState.Vector12.Z, SourceMove.OutVector12.X, SourceMove.OutVector12.Y, SourceMove.OutVector12.Z) return false; } } else return true;
+  if (Vector13) { if (ServerState.bReplicateVector13 && !ServerState.Vector13.Equals(VectorSlots.QuantizeValue(12, SourceMove.OutVector13), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector13 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector13 (X: %f, Y: %f, Z: %f)"), ServerState.Vector13.X, ServerState.Vector13.Y, ServerState.Vector13.Z, SourceMove.OutVector13.X, SourceMove.OutVector13.Y, SourceMove.OutVector13.Z) return false; } } else return true;
+  if (Vector14) { if (ServerState.bReplicateVector14 && !ServerState.Vector14.Equals(VectorSlots.QuantizeValue(13, SourceMove.OutVector14), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector14 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector14 (X: %f, Y: %f, Z: %f)"), ServerState.Vector14.X, ServerState.Vector14.Y, ServerState.Vector14.Z, SourceMove.OutVector14.X, SourceMove.OutVector14.Y, SourceMove.OutVector14.Z) return false; } } else return true;
+  if (Vector15) { if (ServerState.bReplicateVector15 && !ServerState.Vector15.Equals(VectorSlots.QuantizeValue(14, SourceMove.OutVector15), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector15 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector15 (X: %f, Y: %f, Z: %f)"), ServerState.Vector15.X, ServerState.Vector15.Y, ServerState.Vector15.Z, SourceMove.OutVector15.X, SourceMove.OutVector15.Y, SourceMove.OutVector15.Z) return false; } } else return true;
+  if (Vector16) { if (ServerState.bReplicateVector16 && !ServerState.Vector16.Equals(VectorSlots.QuantizeValue(15, SourceMove.OutVector16), COMPARE_TOLERANCE)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy.Vector16 (X: %f, Y: %f, Z: %f) != SourceMove.OutVector16 (X: %f, Y: %f, Z: %f)"), ServerState.Vector16.X, ServerState.Vector16.Y, ServerState.Vector16.Z, SourceMove.OutVector16.X, SourceMove.OutVector16.Y, SourceMove.OutVector16.Z) return false; } } else return true;
   return true;
 }
 
@@ -4524,43 +5753,403 @@ FMove::FMove(
   : Timestamp(Timestamp),
     DeltaTime(DeltaTime),
     InputVector(InputVector),
-    bInputFlag1(bInputFlag1),
-    bInputFlag2(bInputFlag2),
-    bInputFlag3(bInputFlag3),
-    bInputFlag4(bInputFlag4),
-    bInputFlag5(bInputFlag5),
-    bInputFlag6(bInputFlag6),
-    bInputFlag7(bInputFlag7),
-    bInputFlag8(bInputFlag8),
-    bInputFlag9(bInputFlag9),
-    bInputFlag10(bInputFlag10),
-    bInputFlag11(bInputFlag11),
-    bInputFlag12(bInputFlag12),
-    bInputFlag13(bInputFlag13),
-    bInputFlag14(bInputFlag14),
-    bInputFlag15(bInputFlag15),
-    bInputFlag16(bInputFlag16),
     InVelocity(InVelocity),
     InLocation(InLocation),
     InRotation(InRotation),
     InControlRotation(InControlRotation),
     InInputMode(InInputMode)
-{}
+{
+  InitializeFlags();
+  this->bInputFlag1  = bInputFlag1;
+  this->bInputFlag2  = bInputFlag2;
+  this->bInputFlag3  = bInputFlag3;
+  this->bInputFlag4  = bInputFlag4;
+  this->bInputFlag5  = bInputFlag5;
+  this->bInputFlag6  = bInputFlag6;
+  this->bInputFlag7  = bInputFlag7;
+  this->bInputFlag8  = bInputFlag8;
+  this->bInputFlag9  = bInputFlag9;
+  this->bInputFlag10 = bInputFlag10;
+  this->bInputFlag11 = bInputFlag11;
+  this->bInputFlag12 = bInputFlag12;
+  this->bInputFlag13 = bInputFlag13;
+  this->bInputFlag14 = bInputFlag14;
+  this->bInputFlag15 = bInputFlag15;
+  this->bInputFlag16 = bInputFlag16;
+}
+
+void FMove::InitializeFlags()
+{
+  bInputFlag1  = false;
+  bInputFlag2  = false;
+  bInputFlag3  = false;
+  bInputFlag4  = false;
+  bInputFlag5  = false;
+  bInputFlag6  = false;
+  bInputFlag7  = false;
+  bInputFlag8  = false;
+  bInputFlag9  = false;
+  bInputFlag10 = false;
+  bInputFlag11 = false;
+  bInputFlag12 = false;
+  bInputFlag13 = false;
+  bInputFlag14 = false;
+  bInputFlag15 = false;
+  bInputFlag16 = false;
+  bHasNewInputVectorX            = false;
+  bHasNewInputVectorY            = false;
+  bHasNewInputVectorZ            = false;
+  bHasNewOutVelocity             = false;
+  bHasNewOutLocation             = false;
+  bHasNewOutRotationRoll         = false;
+  bHasNewOutRotationPitch        = false;
+  bHasNewOutRotationYaw          = false;
+  bHasNewOutControlRotationRoll  = false;
+  bHasNewOutControlRotationPitch = false;
+  bHasNewOutControlRotationYaw   = false;
+  bIsBatchBase                   = true;
+  // Default serialization settings, derived move types may reconfigure them in their constructor.
+  bSerializeInputVectorX            = true;
+  bSerializeInputVectorY            = true;
+  bSerializeInputVectorZ            = true;
+  bSerializeOutVelocity             = false;
+  bSerializeOutLocation             = true;
+  bSerializeOutRotationRoll         = true;
+  bSerializeOutRotationPitch        = true;
+  bSerializeOutRotationYaw          = true;
+  bSerializeOutControlRotationRoll  = true;
+  bSerializeOutControlRotationPitch = true;
+  bSerializeOutControlRotationYaw   = true;
+  bSerializeOutStateHash            = false;
+}
+
+// The moves of a batch are (de)serialized one after another on the game thread as elements of the RPC parameter array. The context holds
+// the values of the previous move of the batch that is currently being serialized, so that all moves following the base move can be
+// encoded relative to their predecessor. Every batch starts with a base move which resets the context.
+struct FMoveBatchContext
+{
+  // Out-vectors are predicted on their quantization grid, so the prediction is exact and identical on client and server. The history only
+  // holds grid values that were actually transmitted, the loading side never derives them from the decoded float values (which cannot
+  // represent large grid values exactly).
+  struct FQuantizedVectorHistory
+  {
+    bool bHasValue{false};
+    bool bHasDelta{false};
+    FIntVector Value{0};
+    FIntVector Delta{0};
+  };
+
+  bool bIsValid{false};
+  float Timestamp{0.f};
+  uint16 InputFlags{0};
+  uint32 OutStateHash{0};
+  FQuantizedVectorHistory OutVelocity;
+  FQuantizedVectorHistory OutLocation;
+};
+
+static FMoveBatchContext& GetMoveBatchContext()
+{
+  // The context is not synchronized, move batches must only be (de)serialized on the game thread.
+  check(IsInGameThread())
+  static FMoveBatchContext MoveBatchContext;
+  return MoveBatchContext;
+}
+
+static int32 GetQuantizationScale(EDecimalQuantization QuantizationLevel)
+{
+  switch (QuantizationLevel)
+  {
+    case EDecimalQuantization::RoundWholeNumber: return 1;
+    case EDecimalQuantization::RoundOneDecimal: return 10;
+    case EDecimalQuantization::RoundTwoDecimals: return 100;
+    case EDecimalQuantization::None: return 0;
+    default: checkNoEntryGMC();
+  }
+  return 0;
+}
+
+static bool QuantizeToGrid(const FVector& Value, int32 Scale, FIntVector& OutGridValue)
+{
+  // Values that don't fit comfortably into an int32 are not predicted (they are sent as absolute values instead).
+  constexpr float MAX_GRID_VALUE = 1 << 30;
+  const FVector Scaled = Value * Scale;
+  if (Scaled.GetAbsMax() >= MAX_GRID_VALUE || Scaled.ContainsNaN()) return false;
+  OutGridValue = FIntVector(FMath::RoundToInt(Scaled.X), FMath::RoundToInt(Scaled.Y), FMath::RoundToInt(Scaled.Z));
+  return true;
+}
+
+static constexpr uint32 MAX_RESIDUAL_BITS = 24;
+// Grid values are smaller than 2^30 in magnitude (@see QuantizeToGrid).
+static constexpr uint32 MAX_GRID_BITS = 30;
+
+static uint32 GetGridVectorBits(const FIntVector& GridVector)
+{
+  const uint32 MaxMagnitude = FMath::Max3(FMath::Abs(GridVector.X), FMath::Abs(GridVector.Y), FMath::Abs(GridVector.Z));
+  return MaxMagnitude > 0 ? FMath::FloorLog2(MaxMagnitude) + 1 : 0;
+}
+
+static bool SerializeGridVector(FArchive& Ar, FIntVector& GridVector, uint32 MaxBits)
+{
+  // 5 bits for the number of magnitude bits per component (0 means all components are 0), then a sign bit and the magnitude for each
+  // component.
+  uint32 NumBits = Ar.IsSaving() ? GetGridVectorBits(GridVector) : 0;
+  checkGMC(!Ar.IsSaving() || NumBits <= MaxBits)
+  Ar.SerializeBits(&NumBits, 5);
+  if (NumBits > MaxBits)
+  {
+    Ar.SetError();
+    return false;
+  }
+  for (int32* Component : {&GridVector.X, &GridVector.Y, &GridVector.Z})
+  {
+    if (NumBits == 0)
+    {
+      *Component = 0;
+      continue;
+    }
+    uint32 Sign = *Component < 0 ? 1 : 0;
+    uint32 Magnitude = FMath::Abs(*Component);
+    Ar.SerializeBits(&Sign, 1);
+    Ar.SerializeBits(&Magnitude, NumBits);
+    if (Ar.IsLoading()) *Component = Sign ? -static_cast<int32>(Magnitude) : static_cast<int32>(Magnitude);
+  }
+  return true;
+}
+
+static void UpdateOutVectorHistory(
+  FMoveBatchContext::FQuantizedVectorHistory& History,
+  bool bHasNewValue,
+  const FIntVector* GridValue
+)
+{
+  if (!bHasNewValue)
+  {
+    // The value did not change compared to the previous move, so neither did the prediction base. A value that was not sent at all within
+    // this batch yet is still unknown.
+    History.Delta = FIntVector(0);
+    History.bHasDelta = History.bHasValue;
+    return;
+  }
+  if (!GridValue)
+  {
+    // The value was not sent as a grid value so it cannot be used for predictions.
+    History = FMoveBatchContext::FQuantizedVectorHistory();
+    return;
+  }
+  History.bHasDelta = History.bHasValue;
+  History.Delta = History.bHasValue ? *GridValue - History.Value : FIntVector(0);
+  History.Value = *GridValue;
+  History.bHasValue = true;
+}
+
+template<uint32 ScaleFactor, int32 MaxBitsPerComponent>
+static bool SerializeOutVector(
+  FArchive& Ar,
+  FVector& Value,
+  bool bIsBatchBase,
+  FMoveBatchContext::FQuantizedVectorHistory& History
+)
+{
+  // Only the saving side quantizes the float value, the loading side takes the grid value straight from the archive. Both sides then
+  // update their history with the same integer.
+  FIntVector GridValue(0);
+  uint8 bIsOnGrid = 0;
+  if (Ar.IsSaving()) bIsOnGrid = QuantizeToGrid(Value, ScaleFactor, GridValue);
+  Ar.SerializeBits(&bIsOnGrid, 1);
+  if (!bIsOnGrid)
+  {
+    const bool bOutSuccess = SerializePackedVector<ScaleFactor, MaxBitsPerComponent>(Value, Ar);
+    UpdateOutVectorHistory(History, true, nullptr);
+    return bOutSuccess;
+  }
+
+  bool bOutSuccess = true;
+  uint8 bUseResidual = 0;
+  FIntVector Residual(0);
+  // Send the difference to the value that was predicted from the previous moves of the batch if it is small enough.
+  const bool bCanPredict = !bIsBatchBase && History.bHasValue;
+  const FIntVector Prediction = bCanPredict ? History.Value + (History.bHasDelta ? History.Delta : FIntVector(0)) : FIntVector(0);
+  if (Ar.IsSaving() && bCanPredict)
+  {
+    Residual = GridValue - Prediction;
+    bUseResidual = GetGridVectorBits(Residual) <= MAX_RESIDUAL_BITS;
+  }
+  if (bCanPredict) Ar.SerializeBits(&bUseResidual, 1);
+  if (bUseResidual)
+  {
+    bOutSuccess &= SerializeGridVector(Ar, Residual, MAX_RESIDUAL_BITS);
+    if (Ar.IsLoading()) GridValue = Prediction + Residual;
+  }
+  else
+  {
+    bOutSuccess &= SerializeGridVector(Ar, GridValue, MAX_GRID_BITS);
+  }
+  if (!bOutSuccess) return false;
+
+  if (Ar.IsLoading()) Value = FVector(GridValue.X, GridValue.Y, GridValue.Z) / static_cast<float>(ScaleFactor);
+  UpdateOutVectorHistory(History, true, &GridValue);
+  return true;
+}
 
 bool FMove::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
+#if STATS
+  const int64 StartBits = Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : 0;
+#endif
+
   bOutSuccess = true;
-  Ar << Timestamp;
+  bOutSuccess &= SerializeTimestamp(Ar);
   bOutSuccess &= SerializeInputVector(Ar);
   SerializeInputFlags(Ar);
-  bOutSuccess &= SerializeOutVelocity(Ar);
-  bOutSuccess &= SerializeOutLocation(Ar);
-  SerializeOutRotation(Ar);
-  SerializeOutControlRotation(Ar);
+  if (bSerializeOutStateHash)
+  {
+    SerializeOutStateHash(Ar);
+  }
+  else
+  {
+    bOutSuccess &= SerializeOutVelocity(Ar);
+    bOutSuccess &= SerializeOutLocation(Ar);
+    SerializeOutRotation(Ar);
+    SerializeOutControlRotation(Ar);
+  }
   UE_CLOG(!bOutSuccess, LogGMCReplication, Error, TEXT("FMove net serialization returned with bOutSuccess = false."))
+
+#if STATS
+  if (Ar.IsSaving())
+  {
+    INC_DWORD_STAT(STAT_SerializedMoves)
+    INC_DWORD_STAT_BY(STAT_SerializedMoveBits, static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits)
+  }
+#endif
+  return true;
+}
+
+bool FMove::SerializeTimestamp(FArchive& Ar)
+{
+  uint8 B = bIsBatchBase;
+  Ar.SerializeBits(&B, 1);
+  if (Ar.IsLoading()) bIsBatchBase = B;
+
+  auto& Context = GetMoveBatchContext();
+  if (bIsBatchBase)
+  {
+    Ar << Timestamp;
+    Context = FMoveBatchContext();
+    Context.bIsValid = true;
+    Context.Timestamp = Timestamp;
+    return true;
+  }
+
+  if (!Context.bIsValid)
+  {
+    UE_LOG(LogGMCReplication, Error, TEXT("Move is encoded relative to a previous move but no batch base move was serialized."))
+    Ar.SetError();
+    return false;
+  }
+
+  // Timestamps are positive and increasing within a batch, so the difference between the bit patterns of two consecutive timestamps is a
+  // small integer (the number of representable float values in between). This is lossless, which matters because the client identifies
+  // acknowledged moves by their exact timestamp.
+  uint32 PreviousBits = 0;
+  uint32 CurrentBits = 0;
+  FMemory::Memcpy(&PreviousBits, &Context.Timestamp, sizeof(float));
+  FMemory::Memcpy(&CurrentBits, &Timestamp, sizeof(float));
+  uint8 bIsDelta = 0;
+  if (Ar.IsSaving()) bIsDelta = Context.Timestamp > 0.f && Timestamp > Context.Timestamp;
+  Ar.SerializeBits(&bIsDelta, 1);
+  if (bIsDelta)
+  {
+    uint32 TickDelta = CurrentBits - PreviousBits;
+    Ar.SerializeIntPacked(TickDelta);
+    if (Ar.IsLoading())
+    {
+      CurrentBits = PreviousBits + TickDelta;
+      FMemory::Memcpy(&Timestamp, &CurrentBits, sizeof(float));
+    }
+  }
+  else
+  {
+    Ar << Timestamp;
+  }
+  Context.Timestamp = Timestamp;
   return true;
 }
 
+void FMove::SerializeOutStateHash(FArchive& Ar)
+{
+  // The hash does not change while the pawn is idle, one bit is enough in that case.
+  uint8 B = 0;
+  if (!bIsBatchBase)
+  {
+    if (Ar.IsSaving()) B = OutStateHash == GetMoveBatchContext().OutStateHash;
+    Ar.SerializeBits(&B, 1);
+  }
+  if (B)
+  {
+    if (Ar.IsLoading()) OutStateHash = GetMoveBatchContext().OutStateHash;
+  }
+  else
+  {
+    Ar << OutStateHash;
+  }
+  GetMoveBatchContext().OutStateHash = OutStateHash;
+}
+
+// Max absolute value of a scaled location component in the out state hash (2^62, exactly representable and within the range of int64).
+static constexpr double MAX_HASHED_LOCATION = 4611686018427387904.0;
+
+uint32 FMove::ComputeOutStateHash(const FVector& Location, const FRotator& Rotation, const FRotator& ControlRotation) const
+{
+  // Every component that would otherwise be serialized is mapped onto the grid of its quantization level, so the client and the server hash
+  // identical integers as long as their results round to the same values.
+  const auto FloatToBits = [](float Value)
+  {
+    uint32 Bits = 0;
+    FMemory::Memcpy(&Bits, &Value, sizeof(float));
+    return Bits;
+  };
+  const auto QuantizeAxis = [&FloatToBits](float Angle, ESizeQuantization QuantizationLevel) -> uint32
+  {
+    switch (QuantizationLevel)
+    {
+      case ESizeQuantization::Byte: return FRotator::CompressAxisToByte(Angle);
+      case ESizeQuantization::Short: return FRotator::CompressAxisToShort(Angle);
+      case ESizeQuantization::None: return FloatToBits(FRotator::NormalizeAxis(Angle));
+      default: checkNoEntryGMC();
+    }
+    return 0;
+  };
+
+  TArray<uint32, TInlineAllocator<12>> QuantizedValues;
+  if (bSerializeOutLocation)
+  {
+    const int32 Scale = GetQuantizationScale(OutLocationQuantize);
+    for (const float Component : {Location.X, Location.Y, Location.Z})
+    {
+      if (Scale > 0)
+      {
+        // Scaled locations can exceed the range of int32, the clamp only keeps the conversion defined for values far outside of any world.
+        const double Scaled = FMath::RoundToDouble(static_cast<double>(Component) * Scale);
+        const double Clamped = FMath::Clamp(Scaled, -MAX_HASHED_LOCATION, MAX_HASHED_LOCATION);
+        const uint64 Quantized = static_cast<uint64>(static_cast<int64>(Clamped));
+        QuantizedValues.Add(static_cast<uint32>(Quantized));
+        QuantizedValues.Add(static_cast<uint32>(Quantized >> 32));
+      }
+      else
+      {
+        QuantizedValues.Add(FloatToBits(Component));
+      }
+    }
+  }
+  if (bSerializeOutRotationRoll)         QuantizedValues.Add(QuantizeAxis(Rotation.Roll,         OutRotationQuantize));
+  if (bSerializeOutRotationPitch)        QuantizedValues.Add(QuantizeAxis(Rotation.Pitch,        OutRotationQuantize));
+  if (bSerializeOutRotationYaw)          QuantizedValues.Add(QuantizeAxis(Rotation.Yaw,          OutRotationQuantize));
+  if (bSerializeOutControlRotationRoll)  QuantizedValues.Add(QuantizeAxis(ControlRotation.Roll,  OutControlRotationQuantize));
+  if (bSerializeOutControlRotationPitch) QuantizedValues.Add(QuantizeAxis(ControlRotation.Pitch, OutControlRotationQuantize));
+  if (bSerializeOutControlRotationYaw)   QuantizedValues.Add(QuantizeAxis(ControlRotation.Yaw,   OutControlRotationQuantize));
+  return FCrc::MemCrc32(QuantizedValues.GetData(), QuantizedValues.Num() * sizeof(uint32));
+}
+
 bool FMove::SerializeInputVector(FArchive& Ar)
 {
   const bool bArIsSaving = Ar.IsSaving();
@@ -4736,9 +6325,30 @@ bool FMove::SerializeInputVector(FArchive& Ar)
   return bOutSuccess;
 }
 
+uint16 FMove::GetInputFlags() const
+{
+  return
+      (bInputFlag1  <<  0)
+    | (bInputFlag2  <<  1)
+    | (bInputFlag3  <<  2)
+    | (bInputFlag4  <<  3)
+    | (bInputFlag5  <<  4)
+    | (bInputFlag6  <<  5)
+    | (bInputFlag7  <<  6)
+    | (bInputFlag8  <<  7)
+    | (bInputFlag9  <<  8)
+    | (bInputFlag10 <<  9)
+    | (bInputFlag11 << 10)
+    | (bInputFlag12 << 11)
+    | (bInputFlag13 << 12)
+    | (bInputFlag14 << 13)
+    | (bInputFlag15 << 14)
+    | (bInputFlag16 << 15);
+}
+
 void FMove::SerializeInputFlags(FArchive& Ar)
 {
-  checkGMC(!(NumSerializedInputFlags < 0 || NumSerializedInputFlags > 16))
+  checkGMC(NumSerializedInputFlags <= 16)
   if (NumSerializedInputFlags == 0)
   {
     // Input flag serialization is disabled.
@@ -4750,25 +6360,22 @@ void FMove::SerializeInputFlags(FArchive& Ar)
 
   if (bArIsSaving)
   {
-    Flags =
-        (bInputFlag1  <<  0)
-      | (bInputFlag2  <<  1)
-      | (bInputFlag3  <<  2)
-      | (bInputFlag4  <<  3)
-      | (bInputFlag5  <<  4)
-      | (bInputFlag6  <<  5)
-      | (bInputFlag7  <<  6)
-      | (bInputFlag8  <<  7)
-      | (bInputFlag9  <<  8)
-      | (bInputFlag10 <<  9)
-      | (bInputFlag11 << 10)
-      | (bInputFlag12 << 11)
-      | (bInputFlag13 << 12)
-      | (bInputFlag14 << 13)
-      | (bInputFlag15 << 14)
-      | (bInputFlag16 << 15);
-  }
-  Ar.SerializeBits(&Flags, NumSerializedInputFlags);
+    Flags = GetInputFlags();
+  }
+  if (!bIsBatchBase)
+  {
+    // Input flags usually don't change from one move to the next, one bit is enough in that case.
+    const uint16 Mask = (1 << NumSerializedInputFlags) - 1;
+    uint8 B = bArIsSaving ? (Flags & Mask) == (GetMoveBatchContext().InputFlags & Mask) : 0;
+    Ar.SerializeBits(&B, 1);
+    if (B) Flags = GetMoveBatchContext().InputFlags;
+    else Ar.SerializeBits(&Flags, NumSerializedInputFlags);
+  }
+  else
+  {
+    Ar.SerializeBits(&Flags, NumSerializedInputFlags);
+  }
+  GetMoveBatchContext().InputFlags = Flags;
   if (bArIsLoading)
   {
     bInputFlag1  = (Flags & (1 << 0))  ? 1 : 0;
@@ -4798,21 +6405,22 @@ bool FMove::SerializeOutVelocity(FArchive& Ar)
 
   if (bSerializeOutVelocity)
   {
+    auto& History = GetMoveBatchContext().OutVelocity;
     uint8 B = 0;
     if (bArIsSaving) B = bHasNewOutVelocity;
-    Ar.Serialize(&B, 1);
+    Ar.SerializeBits(&B, 1);
     if (B)
     {
       switch (OutVelocityQuantize)
       {
         case EDecimalQuantization::RoundWholeNumber:
-          bOutSuccess &= SerializePackedVector<1, 24>(OutVelocity, Ar);
+          bOutSuccess &= SerializeOutVector<1, 24>(Ar, OutVelocity, bIsBatchBase, History);
           break;
         case EDecimalQuantization::RoundOneDecimal:
-          bOutSuccess &= SerializePackedVector<10, 27>(OutVelocity, Ar);
+          bOutSuccess &= SerializeOutVector<10, 27>(Ar, OutVelocity, bIsBatchBase, History);
           break;
         case EDecimalQuantization::RoundTwoDecimals:
-          bOutSuccess &= SerializePackedVector<100, 30>(OutVelocity, Ar);
+          bOutSuccess &= SerializeOutVector<100, 30>(Ar, OutVelocity, bIsBatchBase, History);
           break;
         case EDecimalQuantization::None:
           Ar << OutVelocity;
@@ -4825,6 +6433,8 @@ bool FMove::SerializeOutVelocity(FArchive& Ar)
     {
       if (bArIsLoading) bHasNewOutVelocity = false;
     }
+    // New grid values were already added to the history during serialization.
+    if (!B) UpdateOutVectorHistory(History, false, nullptr);
   }
   return bOutSuccess;
 }
@@ -4837,21 +6447,22 @@ bool FMove::SerializeOutLocation(FArchive& Ar)
 
   if (bSerializeOutLocation)
   {
+    auto& History = GetMoveBatchContext().OutLocation;
     uint8 B = 0;
     if (bArIsSaving) B = bHasNewOutLocation;
-    Ar.Serialize(&B, 1);
+    Ar.SerializeBits(&B, 1);
     if (B)
     {
       switch (OutLocationQuantize)
       {
         case EDecimalQuantization::RoundWholeNumber:
-          bOutSuccess &= SerializePackedVector<1, 24>(OutLocation, Ar);
+          bOutSuccess &= SerializeOutVector<1, 24>(Ar, OutLocation, bIsBatchBase, History);
           break;
         case EDecimalQuantization::RoundOneDecimal:
-          bOutSuccess &= SerializePackedVector<10, 27>(OutLocation, Ar);
+          bOutSuccess &= SerializeOutVector<10, 27>(Ar, OutLocation, bIsBatchBase, History);
           break;
         case EDecimalQuantization::RoundTwoDecimals:
-          bOutSuccess &= SerializePackedVector<100, 30>(OutLocation, Ar);
+          bOutSuccess &= SerializeOutVector<100, 30>(Ar, OutLocation, bIsBatchBase, History);
           break;
         case EDecimalQuantization::None:
           Ar << OutLocation;
@@ -4864,6 +6475,8 @@ bool FMove::SerializeOutLocation(FArchive& Ar)
     {
       if (bArIsLoading) bHasNewOutLocation = false;
     }
+    // New grid values were already added to the history during serialization.
+    if (!B) UpdateOutVectorHistory(History, false, nullptr);
   }
   return bOutSuccess;
 }
@@ -5530,38 +7143,133 @@ void FMove::QuantizeOutVelocity()
 
 bool FState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
+  SCOPE_CYCLE_COUNTER(STAT_NetSerializeState)
+
+  // The state is only ever net serialized through a bit writer when saving.
+  const int64 StartBits = Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : 0;
+  FConnectionBaseline* Baseline{nullptr};
   if (Ar.IsSaving())
   {
     // Server only logic for managing the serialization map.
     const auto TargetConnection = Cast<UPackageMapClient>(Map)->GetConnection()->OwningActor;
     CurrentTargetConnection = Cast<APlayerController>(TargetConnection);
     checkGMC(CurrentTargetConnection)
-    checkGMC(LastSerialized.Contains(CurrentTargetConnection))
-    if (Owner && RecipientRole == ROLE_SimulatedProxy)
+    check(BaselineStore)
+    Baseline = BaselineStore->Connections.Find(CurrentTargetConnection);
+    checkGMC(Baseline)
+    CurrentBaseline = Baseline ? &Baseline->LastSerialized : nullptr;
+  }
+
+  if (ReplicationLODLevels)
+  {
+    // Connections that are not due for an update with their replication LOD tier only receive a single bit, the client leaves the state
+    // untouched in this case so the update is discarded.
+    uint8 bSkipUpdate = Ar.IsSaving() && Baseline && Baseline->bSkipReplicationLODUpdate;
+    Ar.SerializeBits(&bSkipUpdate, 1);
+    if (bSkipUpdate)
     {
-      const auto ReplicationComponent = Cast<UGenMovementReplicationComponent>(Owner->GetMovementComponent());
-      check(ReplicationComponent)
-      // This state will be replicated to a simulated proxy, set the appropriate flag within the state queue of the owning pawn.
-      ReplicationComponent->Server_SetReplicationFlag(CurrentTargetConnection);
+      if (Ar.IsSaving())
+      {
+        INC_DWORD_STAT(STAT_ReplicationLODSkips)
+        Baseline->NumBitsSent += static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits;
+      }
+      bOutSuccess = true;
+      return true;
+    }
+    if (Ar.IsSaving())
+    {
+      CurrentReplicationLODTier = Baseline ? Baseline->ReplicationLODTier : 0;
+      if (Baseline) Baseline->LastReplicationLODTimestamp = Timestamp;
     }
   }
 
+  if (Ar.IsSaving() && Owner && RecipientRole == ROLE_SimulatedProxy)
+  {
+    const auto ReplicationComponent = Cast<UGenMovementReplicationComponent>(Owner->GetMovementComponent());
+    check(ReplicationComponent)
+    // This state will be replicated to a simulated proxy, set the appropriate flag within the state queue of the owning pawn.
+    ReplicationComponent->Server_SetReplicationFlag(CurrentTargetConnection);
+    if (Baseline)
+    {
+      if (const auto CacheEntry = ReplicationComponent->Server_FindCachedSerialization(*Baseline))
+      {
+        // Connections of the same serialization group receive the same bits, only the baseline has to be updated like the serialization
+        // would have done.
+        Ar.SerializeBits(const_cast<uint8*>(CacheEntry->Bits.GetData()), CacheEntry->NumBits);
+        const bool bWasNetRelevantLastFrame = Baseline->LastSerialized.bWasNetRelevantLastFrame;
+        Baseline->LastSerialized = CacheEntry->Result;
+        Baseline->LastSerialized.bWasNetRelevantLastFrame = bWasNetRelevantLastFrame;
+        Baseline->SerializationGroup = CacheEntry->ResultGroup;
+        Baseline->NumBitsSent += static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits;
+        INC_DWORD_STAT(STAT_SerializationCacheHits)
+        INC_DWORD_STAT(STAT_SerializedStates)
+        INC_DWORD_STAT_BY(STAT_SerializedStateBits, CacheEntry->NumBits)
+        INC_DWORD_STAT_BY(STAT_EstimatedStateBitsWithoutDirtyMask, CacheEntry->EstimatedBitsWithoutDirtyMask)
+        bOutSuccess = true;
+        return true;
+      }
+      INC_DWORD_STAT(STAT_SerializationCacheMisses)
+      // The connection is serialized to individually so its last serialized data is no longer shared with any other connection.
+      Baseline->SerializationGroup = ReplicationComponent->Server_NewSerializationGroup();
+    }
+  }
+
+#if STATS
+  const int64 DataStartBits = Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : 0;
+#endif
+  const int64 EstimatedBitsWithoutDirtyMask = SerializeStateData(Ar, bOutSuccess);
+  if (Ar.IsSaving())
+  {
+    if (Baseline) Baseline->NumBitsSent += static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits;
+    INC_DWORD_STAT(STAT_SerializedStates)
+    INC_DWORD_STAT_BY(STAT_SerializedStateBits, static_cast<FBitWriter&>(Ar).GetNumBits() - DataStartBits)
+    INC_DWORD_STAT_BY(STAT_EstimatedStateBitsWithoutDirtyMask, EstimatedBitsWithoutDirtyMask)
+  }
+
+  UE_CLOG(!bOutSuccess, LogGMCReplication, Error, TEXT("FState net serialization returned with bOutSuccess = false."))
+  return true;
+}
+
+int64 FState::SerializeStateData(FArchive& Ar, bool& bOutSuccess)
+{
+  // Serializes the replicated data against the current baseline. Separate from @see NetSerialize so the server can also serialize the state
+  // for a serialization group without a target connection (@see UGenMovementReplicationComponent::Server_BuildSerializationCache).
+  check(Ar.IsLoading() || CurrentBaseline)
+
+  int64 EstimatedBitsWithoutDirtyMask = 0;
+#if STATS
+  // The state is only ever serialized through a bit writer when saving.
+  const int64 StartBits = Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : 0;
+  int64 DirtyMaskBits = 0;
+#endif
+
   // (De)serialization of replication data.
   bOutSuccess = true;
+  // The tier determines the quantization levels of everything that follows.
+  if (ReplicationLODLevels) bOutSuccess &= SerializeReplicationLODTier(Ar);
   if (bSerializeTimestamp) Ar << Timestamp;
   // Data that the client does not send to the server is always serialized for the autonomous proxy server state as well, because the server
   // cannot verify them. The client checks them locally from the replicated values every time a replication update is received and replays
   // if necessary.
   SerializeMoveValidation(Ar);
-  bOutSuccess &= SerializeVelocity(Ar);
-  SerializeInputMode(Ar);
-  SerializeBoundData(Ar);
+  // The dirty mask must be serialized after the move validation since the groups that are part of it depend on "bContainsFullRepBatch".
+#if STATS
+  const int64 DirtyMaskStartBits = Ar.IsSaving() ? static_cast<FBitWriter&>(Ar).GetNumBits() : 0;
+#endif
+  const uint8 DirtyGroups = SerializeDirtyMask(Ar);
+#if STATS
+  if (Ar.IsSaving()) DirtyMaskBits = static_cast<FBitWriter&>(Ar).GetNumBits() - DirtyMaskStartBits;
+#endif
+  if (DirtyGroups & DirtyVelocity) bOutSuccess &= SerializeVelocity(Ar);
+  if (DirtyGroups & DirtyInputMode) SerializeInputMode(Ar);
+  SerializeRawBoundData(Ar);
+  if (DirtyGroups & DirtyBoundData) SerializeBoundData(Ar);
   if (bContainsFullRepBatch)
   {
     // "bContainsFullRepBatch" may be true or false for the autonomous proxy server state, but will always be true for the simulated proxy.
-    bOutSuccess &= SerializeLocation(Ar);
-    SerializeRotation(Ar);
-    SerializeControlRotation(Ar);
+    if (DirtyGroups & DirtyLocation) bOutSuccess &= SerializeLocation(Ar);
+    if (DirtyGroups & DirtyRotation) SerializeRotation(Ar);
+    if (DirtyGroups & DirtyControlRotation) SerializeControlRotation(Ar);
     // The input flags will never be serialized for the autonomous proxy server state.
     SerializeInputFlags(Ar);
   }
@@ -5584,11 +7292,206 @@ bool FState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
   if (Ar.IsSaving())
   {
     // Server only: Reset the flag to force full serialization, this should have happened within this call.
-    LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate = false;
+    CurrentBaseline->bForceFullSerializationOnNextUpdate = false;
+    // The server state itself always keeps the full detail quantization levels.
+    if (ReplicationLODLevels) ApplyReplicationLODLevels(0);
+
+#if STATS
+    // Estimate the size the state would have had without the dirty mask, i.e. with every change flag serialized and the location and
+    // velocity flags taking up a full byte each. This is derived from the bits that were actually written, the old layout is not serialized
+    // again to measure it.
+    const uint8 EnabledGroups = GetEnabledDirtyGroups();
+    const uint8 CleanGroups = EnabledGroups & ~DirtyGroups;
+    int64 SkippedFlagBits = 0;
+    if (CleanGroups & DirtyVelocity) SkippedFlagBits += 1;
+    if (CleanGroups & DirtyInputMode) SkippedFlagBits += 1;
+    if (CleanGroups & DirtyBoundData) SkippedFlagBits += CountReplicatedBoundData();
+    if (CleanGroups & DirtyLocation) SkippedFlagBits += 1;
+    if (CleanGroups & DirtyRotation) SkippedFlagBits += bSerializeRotationRoll + bSerializeRotationPitch + bSerializeRotationYaw;
+    if (CleanGroups & DirtyControlRotation)
+    {
+      SkippedFlagBits += bSerializeControlRotationRoll + bSerializeControlRotationPitch + bSerializeControlRotationYaw;
+    }
+    const int64 ByteFlagBits = 7 * (((EnabledGroups & DirtyVelocity) ? 1 : 0) + ((EnabledGroups & DirtyLocation) ? 1 : 0));
+    const int64 NumBits = static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits;
+    EstimatedBitsWithoutDirtyMask = NumBits - DirtyMaskBits + SkippedFlagBits + ByteFlagBits;
+#endif
   }
 
-  UE_CLOG(!bOutSuccess, LogGMCReplication, Error, TEXT("FState net serialization returned with bOutSuccess = false."))
-  return true;
+  return EstimatedBitsWithoutDirtyMask;
+}
+
+bool FState::SerializeReplicationLODTier(FArchive& Ar)
+{
+  check(ReplicationLODLevels)
+  uint8 Tier = CurrentReplicationLODTier;
+  Ar.SerializeBits(&Tier, 2);
+  bool bOutSuccess = true;
+  if (Ar.IsLoading())
+  {
+    if (!ReplicationLODLevels->IsValidIndex(Tier))
+    {
+      // The replication LOD tiers are configured differently on the server.
+      bOutSuccess = false;
+      Tier = 0;
+    }
+    CurrentReplicationLODTier = Tier;
+  }
+  ApplyReplicationLODLevels(Tier);
+  return bOutSuccess;
+}
+
+void FState::ApplyReplicationLODLevels(uint8 Tier)
+{
+  const FReplicationLODTier& Levels = (*ReplicationLODLevels)[Tier];
+  LocationQuantize = Levels.LocationQuantize;
+  VelocityQuantize = Levels.VelocityQuantize;
+  RotationQuantize = Levels.RotationQuantize;
+  ControlRotationQuantize = Levels.ControlRotationQuantize;
+}
+
+uint8 FState::SerializeDirtyMask(FArchive& Ar)
+{
+  // The mask is hierarchical: a single bit tells whether anything changed at all, so an unchanged pawn only costs one bit for all of its
+  // delta-serialized values. If something changed, each group that contains multiple change flags gets one more bit. Groups that consist of
+  // a single value are not part of the second level since their own change flag already carries the same information.
+  constexpr uint8 SingleValueGroups = DirtyVelocity | DirtyInputMode | DirtyLocation;
+  constexpr uint8 MultiValueGroups[] = {DirtyBoundData, DirtyRotation, DirtyControlRotation};
+
+  const uint8 EnabledGroups = GetEnabledDirtyGroups();
+  if (EnabledGroups == 0) return 0;
+
+  uint8 DirtyGroups = Ar.IsSaving() ? GetChangedDirtyGroups(EnabledGroups) : 0;
+  uint8 B = DirtyGroups != 0;
+  Ar.SerializeBits(&B, 1);
+  if (B)
+  {
+    DirtyGroups |= EnabledGroups & SingleValueGroups;
+    for (const uint8 Group : MultiValueGroups)
+    {
+      if (!(EnabledGroups & Group)) continue;
+      B = (DirtyGroups & Group) != 0;
+      Ar.SerializeBits(&B, 1);
+      DirtyGroups = B ? DirtyGroups | Group : DirtyGroups & ~Group;
+    }
+  }
+  else
+  {
+    DirtyGroups = 0;
+  }
+
+  if (Ar.IsLoading())
+  {
+    MarkGroupsUnchanged(EnabledGroups & ~DirtyGroups);
+  }
+  return DirtyGroups;
+}
+
+uint8 FState::GetEnabledDirtyGroups() const
+{
+  uint8 EnabledGroups = 0;
+  if (bSerializeVelocity) EnabledGroups |= DirtyVelocity;
+  if (bSerializeInputMode) EnabledGroups |= DirtyInputMode;
+  if (bSerializeBoundData && CountReplicatedBoundData() > 0) EnabledGroups |= DirtyBoundData;
+  if (bContainsFullRepBatch)
+  {
+    if (bSerializeLocation) EnabledGroups |= DirtyLocation;
+    if (bSerializeRotationRoll || bSerializeRotationPitch || bSerializeRotationYaw) EnabledGroups |= DirtyRotation;
+    if (bSerializeControlRotationRoll || bSerializeControlRotationPitch || bSerializeControlRotationYaw) EnabledGroups |= DirtyControlRotation;
+  }
+  return EnabledGroups;
+}
+
+uint8 FState::GetChangedDirtyGroups(uint8 EnabledGroups) const
+{
+  check(CurrentBaseline)
+  if (!bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate) return EnabledGroups;
+
+  // Uses the same tolerances as the individual serialization functions so a group is never marked clean while one of its values would have
+  // been sent.
+  uint8 ChangedGroups = 0;
+  if (EnabledGroups & DirtyVelocity)
+  {
+    const float CompareTolerance = UGenMovementReplicationComponent::GetCompareTolerance(VelocityQuantize);
+    if (!Velocity.Equals(CurrentBaseline->Velocity, CompareTolerance)) ChangedGroups |= DirtyVelocity;
+  }
+  if (EnabledGroups & DirtyInputMode)
+  {
+    if (InputMode != CurrentBaseline->InputMode) ChangedGroups |= DirtyInputMode;
+  }
+  if (EnabledGroups & DirtyBoundData)
+  {
+    if (HasBoundDataChanged()) ChangedGroups |= DirtyBoundData;
+  }
+  if (EnabledGroups & DirtyLocation)
+  {
+    const float CompareTolerance = UGenMovementReplicationComponent::GetCompareTolerance(LocationQuantize);
+    if (!Location.Equals(CurrentBaseline->Location, CompareTolerance)) ChangedGroups |= DirtyLocation;
+  }
+  if (EnabledGroups & DirtyRotation)
+  {
+    const float CompareTolerance = UGenMovementReplicationComponent::GetCompareToleranceRotator(RotationQuantize);
+    if (
+      (bSerializeRotationRoll && !FMath::IsNearlyEqual(Rotation.Roll, CurrentBaseline->RotationRoll, CompareTolerance))
+      || (bSerializeRotationPitch && !FMath::IsNearlyEqual(Rotation.Pitch, CurrentBaseline->RotationPitch, CompareTolerance))
+      || (bSerializeRotationYaw && !FMath::IsNearlyEqual(Rotation.Yaw, CurrentBaseline->RotationYaw, CompareTolerance))
+    )
+    {
+      ChangedGroups |= DirtyRotation;
+    }
+  }
+  if (EnabledGroups & DirtyControlRotation)
+  {
+    const float CompareTolerance = UGenMovementReplicationComponent::GetCompareToleranceRotator(ControlRotationQuantize);
+    if (
+      (bSerializeControlRotationRoll && !FMath::IsNearlyEqual(ControlRotation.Roll, CurrentBaseline->ControlRotationRoll, CompareTolerance))
+      || (bSerializeControlRotationPitch && !FMath::IsNearlyEqual(ControlRotation.Pitch, CurrentBaseline->ControlRotationPitch, CompareTolerance))
+      || (bSerializeControlRotationYaw && !FMath::IsNearlyEqual(ControlRotation.Yaw, CurrentBaseline->ControlRotationYaw, CompareTolerance))
+    )
+    {
+      ChangedGroups |= DirtyControlRotation;
+    }
+  }
+  return ChangedGroups;
+}
+
+void FState::MarkGroupsUnchanged(uint8 CleanGroups)
+{
+  // Client only: the values of skipped groups were not received, so the read-new flags must be reset the same way the individual
+  // serialization functions would have done it for unchanged values.
+  if (CleanGroups & DirtyVelocity) bReadNewVelocity = false;
+  if (CleanGroups & DirtyInputMode) bReadNewInputMode = false;
+  if (CleanGroups & DirtyBoundData)
+  {
+    MarkBoundDataUnchanged_IMPLEMENTATION()
+  }
+  if (CleanGroups & DirtyLocation) bReadNewLocation = false;
+  if (CleanGroups & DirtyRotation)
+  {
+    bReadNewRotationRoll = false;
+    bReadNewRotationPitch = false;
+    bReadNewRotationYaw = false;
+  }
+  if (CleanGroups & DirtyControlRotation)
+  {
+    bReadNewControlRotationRoll = false;
+    bReadNewControlRotationPitch = false;
+    bReadNewControlRotationYaw = false;
+  }
+}
+
+int32 FState::CountReplicatedBoundData() const
+{
+  int32 Count = 0;
+  CountReplicatedBoundData_IMPLEMENTATION()
+  return Count;
+}
+
+bool FState::HasBoundDataChanged() const
+{
+  check(CurrentBaseline)
+  HasBoundDataChanged_IMPLEMENTATION()
+  return false;
 }
 
 bool FState::SerializeLocation(FArchive& Ar)
@@ -5597,17 +7500,17 @@ bool FState::SerializeLocation(FArchive& Ar)
   const bool bArIsLoading = Ar.IsLoading();
   const float CompareTolerance = UGenMovementReplicationComponent::GetCompareTolerance(LocationQuantize);
   bool bOutSuccess = true;
-  checkCodeGMC(if (bArIsSaving) check(LastSerialized.Contains(CurrentTargetConnection)))
+  checkCodeGMC(if (bArIsSaving) check(CurrentBaseline))
 
   if (bSerializeLocation)
   {
     uint8 B = 0;
     if (bArIsSaving)
     {
-      const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-      B = bForceFullSerialization ? 1 : !Location.Equals(LastSerialized[CurrentTargetConnection].Location, CompareTolerance);
+      const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+      B = bForceFullSerialization ? 1 : !Location.Equals(CurrentBaseline->Location, CompareTolerance);
     }
-    Ar.Serialize(&B, 1);
+    Ar.SerializeBits(&B, 1);
     if (B)
     {
       switch (LocationQuantize)
@@ -5626,7 +7529,7 @@ bool FState::SerializeLocation(FArchive& Ar)
           break;
         default: checkNoEntryGMC();
       }
-      if (bArIsSaving) LastSerialized[CurrentTargetConnection].Location = Location;
+      if (bArIsSaving) CurrentBaseline->Location = Location;
       if (bArIsLoading) bReadNewLocation = true;
     }
     else
@@ -5643,17 +7546,17 @@ bool FState::SerializeVelocity(FArchive& Ar)
   const bool bArIsLoading = Ar.IsLoading();
   const float CompareTolerance = UGenMovementReplicationComponent::GetCompareTolerance(VelocityQuantize);
   bool bOutSuccess = true;
-  checkCodeGMC(if (bArIsSaving) check(LastSerialized.Contains(CurrentTargetConnection)))
+  checkCodeGMC(if (bArIsSaving) check(CurrentBaseline))
 
   if (bSerializeVelocity)
   {
     uint8 B = 0;
     if (bArIsSaving)
     {
-      const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-      B = bForceFullSerialization ? 1 : !Velocity.Equals(LastSerialized[CurrentTargetConnection].Velocity, CompareTolerance);
+      const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+      B = bForceFullSerialization ? 1 : !Velocity.Equals(CurrentBaseline->Velocity, CompareTolerance);
     }
-    Ar.Serialize(&B, 1);
+    Ar.SerializeBits(&B, 1);
     if (B)
     {
       switch (VelocityQuantize)
@@ -5672,7 +7575,7 @@ bool FState::SerializeVelocity(FArchive& Ar)
           break;
         default: checkNoEntryGMC();
       }
-      if (bArIsSaving) LastSerialized[CurrentTargetConnection].Velocity = Velocity;
+      if (bArIsSaving) CurrentBaseline->Velocity = Velocity;
       if (bArIsLoading) bReadNewVelocity = true;
     }
     else
@@ -5688,7 +7591,7 @@ void FState::SerializeRotation(FArchive& Ar)
   const bool bArIsSaving = Ar.IsSaving();
   const bool bArIsLoading = Ar.IsLoading();
   const float CompareTolerance = UGenMovementReplicationComponent::GetCompareToleranceRotator(RotationQuantize);
-  checkCodeGMC(if (bArIsSaving) check(LastSerialized.Contains(CurrentTargetConnection)))
+  checkCodeGMC(if (bArIsSaving) check(CurrentBaseline))
 
   switch (uint8 B = 0; RotationQuantize)
   {
@@ -5698,38 +7601,38 @@ void FState::SerializeRotation(FArchive& Ar)
       uint8 Pitch = 0, Yaw = 0, Roll = 0;
       if (bArIsSaving)
       {
-        const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+        const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
         if (bSerializeRotationRoll)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, LastSerialized[CurrentTargetConnection].RotationRoll, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, CurrentBaseline->RotationRoll, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Roll = FRotator::CompressAxisToByte(Rotation.Roll);
             Ar << Roll;
-            LastSerialized[CurrentTargetConnection].RotationRoll = Rotation.Roll;
+            CurrentBaseline->RotationRoll = Rotation.Roll;
           }
         }
         if (bSerializeRotationPitch)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, LastSerialized[CurrentTargetConnection].RotationPitch, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, CurrentBaseline->RotationPitch, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Pitch = FRotator::CompressAxisToByte(Rotation.Pitch);
             Ar << Pitch;
-            LastSerialized[CurrentTargetConnection].RotationPitch = Rotation.Pitch;
+            CurrentBaseline->RotationPitch = Rotation.Pitch;
           }
         }
         if (bSerializeRotationYaw)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, LastSerialized[CurrentTargetConnection].RotationYaw, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, CurrentBaseline->RotationYaw, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Yaw = FRotator::CompressAxisToByte(Rotation.Yaw);
             Ar << Yaw;
-            LastSerialized[CurrentTargetConnection].RotationYaw = Rotation.Yaw;
+            CurrentBaseline->RotationYaw = Rotation.Yaw;
           }
         }
       }
@@ -5786,38 +7689,38 @@ void FState::SerializeRotation(FArchive& Ar)
       uint16 Pitch = 0, Yaw = 0, Roll = 0;
       if (bArIsSaving)
       {
-        const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+        const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
         if (bSerializeRotationRoll)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, LastSerialized[CurrentTargetConnection].RotationRoll, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, CurrentBaseline->RotationRoll, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Roll = FRotator::CompressAxisToShort(Rotation.Roll);
             Ar << Roll;
-            LastSerialized[CurrentTargetConnection].RotationRoll = Rotation.Roll;
+            CurrentBaseline->RotationRoll = Rotation.Roll;
           }
         }
         if (bSerializeRotationPitch)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, LastSerialized[CurrentTargetConnection].RotationPitch, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, CurrentBaseline->RotationPitch, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Pitch = FRotator::CompressAxisToShort(Rotation.Pitch);
             Ar << Pitch;
-            LastSerialized[CurrentTargetConnection].RotationPitch = Rotation.Pitch;
+            CurrentBaseline->RotationPitch = Rotation.Pitch;
           }
         }
         if (bSerializeRotationYaw)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, LastSerialized[CurrentTargetConnection].RotationYaw, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, CurrentBaseline->RotationYaw, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Yaw = FRotator::CompressAxisToShort(Rotation.Yaw);
             Ar << Yaw;
-            LastSerialized[CurrentTargetConnection].RotationYaw = Rotation.Yaw;
+            CurrentBaseline->RotationYaw = Rotation.Yaw;
           }
         }
       }
@@ -5874,14 +7777,14 @@ void FState::SerializeRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, LastSerialized[CurrentTargetConnection].RotationRoll, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Roll, CurrentBaseline->RotationRoll, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << Rotation.Roll;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].RotationRoll = Rotation.Roll;
+          if (bArIsSaving) CurrentBaseline->RotationRoll = Rotation.Roll;
           if (bArIsLoading) bReadNewRotationRoll = true;
         }
         else
@@ -5893,14 +7796,14 @@ void FState::SerializeRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, LastSerialized[CurrentTargetConnection].RotationPitch, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Pitch, CurrentBaseline->RotationPitch, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << Rotation.Pitch;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].RotationPitch = Rotation.Pitch;
+          if (bArIsSaving) CurrentBaseline->RotationPitch = Rotation.Pitch;
           if (bArIsLoading) bReadNewRotationPitch = true;
         }
         else
@@ -5912,14 +7815,14 @@ void FState::SerializeRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, LastSerialized[CurrentTargetConnection].RotationYaw, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(Rotation.Yaw, CurrentBaseline->RotationYaw, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << Rotation.Yaw;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].RotationYaw = Rotation.Yaw;
+          if (bArIsSaving) CurrentBaseline->RotationYaw = Rotation.Yaw;
           if (bArIsLoading) bReadNewRotationYaw = true;
         }
         else
@@ -5938,7 +7841,7 @@ void FState::SerializeControlRotation(FArchive& Ar)
   const bool bArIsSaving = Ar.IsSaving();
   const bool bArIsLoading = Ar.IsLoading();
   const float CompareTolerance = UGenMovementReplicationComponent::GetCompareToleranceRotator(ControlRotationQuantize);
-  checkCodeGMC(if (bArIsSaving) check(LastSerialized.Contains(CurrentTargetConnection)))
+  checkCodeGMC(if (bArIsSaving) check(CurrentBaseline))
 
   switch (uint8 B = 0; ControlRotationQuantize)
   {
@@ -5948,38 +7851,38 @@ void FState::SerializeControlRotation(FArchive& Ar)
       uint8 Pitch = 0, Yaw = 0, Roll = 0;
       if (bArIsSaving)
       {
-        const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+        const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
         if (bSerializeControlRotationRoll)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, LastSerialized[CurrentTargetConnection].ControlRotationRoll, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, CurrentBaseline->ControlRotationRoll, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Roll = FRotator::CompressAxisToByte(ControlRotation.Roll);
             Ar << Roll;
-            LastSerialized[CurrentTargetConnection].ControlRotationRoll = ControlRotation.Roll;
+            CurrentBaseline->ControlRotationRoll = ControlRotation.Roll;
           }
         }
         if (bSerializeControlRotationPitch)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, LastSerialized[CurrentTargetConnection].ControlRotationPitch, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, CurrentBaseline->ControlRotationPitch, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Pitch = FRotator::CompressAxisToByte(ControlRotation.Pitch);
             Ar << Pitch;
-            LastSerialized[CurrentTargetConnection].ControlRotationPitch = ControlRotation.Pitch;
+            CurrentBaseline->ControlRotationPitch = ControlRotation.Pitch;
           }
         }
         if (bSerializeControlRotationYaw)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, LastSerialized[CurrentTargetConnection].ControlRotationYaw, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, CurrentBaseline->ControlRotationYaw, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Yaw = FRotator::CompressAxisToByte(ControlRotation.Yaw);
             Ar << Yaw;
-            LastSerialized[CurrentTargetConnection].ControlRotationYaw = ControlRotation.Yaw;
+            CurrentBaseline->ControlRotationYaw = ControlRotation.Yaw;
           }
         }
       }
@@ -6036,38 +7939,38 @@ void FState::SerializeControlRotation(FArchive& Ar)
       uint16 Pitch = 0, Yaw = 0, Roll = 0;
       if (bArIsSaving)
       {
-        const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+        const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
         if (bSerializeControlRotationRoll)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, LastSerialized[CurrentTargetConnection].ControlRotationRoll, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, CurrentBaseline->ControlRotationRoll, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Roll = FRotator::CompressAxisToShort(ControlRotation.Roll);
             Ar << Roll;
-            LastSerialized[CurrentTargetConnection].ControlRotationRoll = ControlRotation.Roll;
+            CurrentBaseline->ControlRotationRoll = ControlRotation.Roll;
           }
         }
         if (bSerializeControlRotationPitch)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, LastSerialized[CurrentTargetConnection].ControlRotationPitch, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, CurrentBaseline->ControlRotationPitch, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Pitch = FRotator::CompressAxisToShort(ControlRotation.Pitch);
             Ar << Pitch;
-            LastSerialized[CurrentTargetConnection].ControlRotationPitch = ControlRotation.Pitch;
+            CurrentBaseline->ControlRotationPitch = ControlRotation.Pitch;
           }
         }
         if (bSerializeControlRotationYaw)
         {
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, LastSerialized[CurrentTargetConnection].ControlRotationYaw, CompareTolerance);
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, CurrentBaseline->ControlRotationYaw, CompareTolerance);
           Ar.SerializeBits(&B, 1);
           if (B)
           {
             Yaw = FRotator::CompressAxisToShort(ControlRotation.Yaw);
             Ar << Yaw;
-            LastSerialized[CurrentTargetConnection].ControlRotationYaw = ControlRotation.Yaw;
+            CurrentBaseline->ControlRotationYaw = ControlRotation.Yaw;
           }
         }
       }
@@ -6124,14 +8027,14 @@ void FState::SerializeControlRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, LastSerialized[CurrentTargetConnection].ControlRotationRoll, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Roll, CurrentBaseline->ControlRotationRoll, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << ControlRotation.Roll;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].ControlRotationRoll = ControlRotation.Roll;
+          if (bArIsSaving) CurrentBaseline->ControlRotationRoll = ControlRotation.Roll;
           if (bArIsLoading) bReadNewControlRotationRoll = true;
         }
         else
@@ -6143,14 +8046,14 @@ void FState::SerializeControlRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, LastSerialized[CurrentTargetConnection].ControlRotationPitch, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Pitch, CurrentBaseline->ControlRotationPitch, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << ControlRotation.Pitch;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].ControlRotationPitch = ControlRotation.Pitch;
+          if (bArIsSaving) CurrentBaseline->ControlRotationPitch = ControlRotation.Pitch;
           if (bArIsLoading) bReadNewControlRotationPitch = true;
         }
         else
@@ -6162,14 +8065,14 @@ void FState::SerializeControlRotation(FArchive& Ar)
       {
         if (bArIsSaving)
         {
-          const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, LastSerialized[CurrentTargetConnection].ControlRotationYaw, CompareTolerance);
+          const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+          B = bForceFullSerialization ? 1 : !FMath::IsNearlyEqual(ControlRotation.Yaw, CurrentBaseline->ControlRotationYaw, CompareTolerance);
         }
         Ar.SerializeBits(&B, 1);
         if (B)
         {
           Ar << ControlRotation.Yaw;
-          if (bArIsSaving) LastSerialized[CurrentTargetConnection].ControlRotationYaw = ControlRotation.Yaw;
+          if (bArIsSaving) CurrentBaseline->ControlRotationYaw = ControlRotation.Yaw;
           if (bArIsLoading) bReadNewControlRotationYaw = true;
         }
         else
@@ -6216,6 +8119,14 @@ void FState::SerializeBoundData(FArchive& Ar)
   }
 }
 
+void FState::SerializeRawBoundData(FArchive& Ar)
+{
+  if (bSerializeBoundData)
+  {
+    SerializeRawBoundData_IMPLEMENTATION()
+  }
+}
+
 void FState::SerializeMoveValidation(FArchive& Ar)
 {
   if (bSerializeMoveValidation)
@@ -6227,19 +8138,19 @@ void FState::SerializeMoveValidation(FArchive& Ar)
 void FState::SerializeInputMode(FArchive& Ar)
 {
   uint8 B = 0;
-  checkCodeGMC(if (Ar.IsSaving()) check(LastSerialized.Contains(CurrentTargetConnection)))
+  checkCodeGMC(if (Ar.IsSaving()) check(CurrentBaseline))
 
   if (bSerializeInputMode)
   {
     if (Ar.IsSaving())
     {
-      const bool bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-      B = bForceFullSerialization ? 1 : InputMode != LastSerialized[CurrentTargetConnection].InputMode;
+      const bool bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
+      B = bForceFullSerialization ? 1 : InputMode != CurrentBaseline->InputMode;
       Ar.SerializeBits(&B, 1);
       if (B)
       {
         Ar.SerializeBits(&InputMode, 3);
-        LastSerialized[CurrentTargetConnection].InputMode = InputMode;
+        CurrentBaseline->InputMode = InputMode;
       }
     }
     else if (Ar.IsLoading())
@@ -6492,58 +8403,26 @@ void FState::SerializeHalfByteTypes(FArchive& Ar)
   bool bForceFullSerialization = false;
   if (bArIsSaving)
   {
-    check(LastSerialized.Contains(CurrentTargetConnection))
-    bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
-  }
-  uint8 B = 0;
-  if (bArIsSaving) { if (bReplicateHalfByte1)  { B = bForceFullSerialization ? 1 : HalfByte1  != LastSerialized[CurrentTargetConnection].HalfByte1;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte1, 4);  LastSerialized[CurrentTargetConnection].HalfByte1  = HalfByte1;  } } } else if (bArIsLoading) { if (bReplicateHalfByte1)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte1, 4);  bReadNewHalfByte1  = true; } else { bReadNewHalfByte1  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte2)  { B = bForceFullSerialization ? 1 : HalfByte2  != LastSerialized[CurrentTargetConnection].HalfByte2;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte2, 4);  LastSerialized[CurrentTargetConnection].HalfByte2  = HalfByte2;  } } } else if (bArIsLoading) { if (bReplicateHalfByte2)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte2, 4);  bReadNewHalfByte2  = true; } else { bReadNewHalfByte2  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte3)  { B = bForceFullSerialization ? 1 : HalfByte3  != LastSerialized[CurrentTargetConnection].HalfByte3;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte3, 4);  LastSerialized[CurrentTargetConnection].HalfByte3  = HalfByte3;  } } } else if (bArIsLoading) { if (bReplicateHalfByte3)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte3, 4);  bReadNewHalfByte3  = true; } else { bReadNewHalfByte3  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte4)  { B = bForceFullSerialization ? 1 : HalfByte4  != LastSerialized[CurrentTargetConnection].HalfByte4;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte4, 4);  LastSerialized[CurrentTargetConnection].HalfByte4  = HalfByte4;  } } } else if (bArIsLoading) { if (bReplicateHalfByte4)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte4, 4);  bReadNewHalfByte4  = true; } else { bReadNewHalfByte4  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte5)  { B = bForceFullSerialization ? 1 : HalfByte5  != LastSerialized[CurrentTargetConnection].HalfByte5;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte5, 4);  LastSerialized[CurrentTargetConnection].HalfByte5  = HalfByte5;  } } } else if (bArIsLoading) { if (bReplicateHalfByte5)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte5, 4);  bReadNewHalfByte5  = true; } else { bReadNewHalfByte5  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte6)  { B = bForceFullSerialization ? 1 : HalfByte6  != LastSerialized[CurrentTargetConnection].HalfByte6;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte6, 4);  LastSerialized[CurrentTargetConnection].HalfByte6  = HalfByte6;  } } } else if (bArIsLoading) { if (bReplicateHalfByte6)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte6, 4);  bReadNewHalfByte6  = true; } else { bReadNewHalfByte6  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte7)  { B = bForceFullSerialization ? 1 : HalfByte7  != LastSerialized[CurrentTargetConnection].HalfByte7;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte7, 4);  LastSerialized[CurrentTargetConnection].HalfByte7  = HalfByte7;  } } } else if (bArIsLoading) { if (bReplicateHalfByte7)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte7, 4);  bReadNewHalfByte7  = true; } else { bReadNewHalfByte7  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte8)  { B = bForceFullSerialization ? 1 : HalfByte8  != LastSerialized[CurrentTargetConnection].HalfByte8;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte8, 4);  LastSerialized[CurrentTargetConnection].HalfByte8  = HalfByte8;  } } } else if (bArIsLoading) { if (bReplicateHalfByte8)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte8, 4);  bReadNewHalfByte8  = true; } else { bReadNewHalfByte8  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte9)  { B = bForceFullSerialization ? 1 : HalfByte9  != LastSerialized[CurrentTargetConnection].HalfByte9;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte9, 4);  LastSerialized[CurrentTargetConnection].HalfByte9  = HalfByte9;  } } } else if (bArIsLoading) { if (bReplicateHalfByte9)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte9, 4);  bReadNewHalfByte9  = true; } else { bReadNewHalfByte9  = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte10) { B = bForceFullSerialization ? 1 : HalfByte10 != LastSerialized[CurrentTargetConnection].HalfByte10; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte10, 4); LastSerialized[CurrentTargetConnection].HalfByte10 = HalfByte10; } } } else if (bArIsLoading) { if (bReplicateHalfByte10) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte10, 4); bReadNewHalfByte10 = true; } else { bReadNewHalfByte10 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte11) { B = bForceFullSerialization ? 1 : HalfByte11 != LastSerialized[CurrentTargetConnection].HalfByte11; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte11, 4); LastSerialized[CurrentTargetConnection].HalfByte11 = HalfByte11; } } } else if (bArIsLoading) { if (bReplicateHalfByte11) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte11, 4); bReadNewHalfByte11 = true; } else { bReadNewHalfByte11 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte12) { B = bForceFullSerialization ? 1 : HalfByte12 != LastSerialized[CurrentTargetConnection].HalfByte12; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte12, 4); LastSerialized[CurrentTargetConnection].HalfByte12 = HalfByte12; } } } else if (bArIsLoading) { if (bReplicateHalfByte12) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte12, 4); bReadNewHalfByte12 = true; } else { bReadNewHalfByte12 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte13) { B = bForceFullSerialization ? 1 : HalfByte13 != LastSerialized[CurrentTargetConnection].HalfByte13; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte13, 4); LastSerialized[CurrentTargetConnection].HalfByte13 = HalfByte13; } } } else if (bArIsLoading) { if (bReplicateHalfByte13) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte13, 4); bReadNewHalfByte13 = true; } else { bReadNewHalfByte13 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte14) { B = bForceFullSerialization ? 1 : HalfByte14 != LastSerialized[CurrentTargetConnection].HalfByte14; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte14, 4); LastSerialized[CurrentTargetConnection].HalfByte14 = HalfByte14; } } } else if (bArIsLoading) { if (bReplicateHalfByte14) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte14, 4); bReadNewHalfByte14 = true; } else { bReadNewHalfByte14 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte15) { B = bForceFullSerialization ? 1 : HalfByte15 != LastSerialized[CurrentTargetConnection].HalfByte15; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte15, 4); LastSerialized[CurrentTargetConnection].HalfByte15 = HalfByte15; } } } else if (bArIsLoading) { if (bReplicateHalfByte15) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte15, 4); bReadNewHalfByte15 = true; } else { bReadNewHalfByte15 = false; } } }
-  if (bArIsSaving) { if (bReplicateHalfByte16) { B = bForceFullSerialization ? 1 : HalfByte16 != LastSerialized[CurrentTargetConnection].HalfByte16; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte16, 4); LastSerialized[CurrentTargetConnection].HalfByte16 = HalfByte16; } } } else if (bArIsLoading) { if (bReplicateHalfByte16) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte16, 4); bReadNewHalfByte16 = true; } else { bReadNewHalfByte16 = false; } } }
-}
-
-void FState::SerializeVectorTypes(FArchive& Ar)
-{
-  // Vectors are rounded to 2 decimal places.
-
-  const bool bArIsSaving = Ar.IsSaving();
-  const bool bArIsLoading = Ar.IsLoading();
-  bool bForceFullSerialization = false;
-  if (bArIsSaving)
-  {
-    check(LastSerialized.Contains(CurrentTargetConnection))
-    bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+    check(CurrentBaseline)
+    bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
   }
-  constexpr float COMPARE_TOLERANCE = 0.01f;
   uint8 B = 0;
-  if (bArIsSaving) { if (bReplicateVector1)  { B = bForceFullSerialization ? 1 : !Vector1.Equals(LastSerialized[CurrentTargetConnection].Vector1, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector1, Ar);  LastSerialized[CurrentTargetConnection].Vector1  = Vector1;  } } } else if (bArIsLoading) { if (bReplicateVector1)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector1, Ar);  bReadNewVector1  = true; } else { bReadNewVector1  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector2)  { B = bForceFullSerialization ? 1 : !Vector2.Equals(LastSerialized[CurrentTargetConnection].Vector2, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector2, Ar);  LastSerialized[CurrentTargetConnection].Vector2  = Vector2;  } } } else if (bArIsLoading) { if (bReplicateVector2)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector2, Ar);  bReadNewVector2  = true; } else { bReadNewVector2  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector3)  { B = bForceFullSerialization ? 1 : !Vector3.Equals(LastSerialized[CurrentTargetConnection].Vector3, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector3, Ar);  LastSerialized[CurrentTargetConnection].Vector3  = Vector3;  } } } else if (bArIsLoading) { if (bReplicateVector3)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector3, Ar);  bReadNewVector3  = true; } else { bReadNewVector3  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector4)  { B = bForceFullSerialization ? 1 : !Vector4.Equals(LastSerialized[CurrentTargetConnection].Vector4, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector4, Ar);  LastSerialized[CurrentTargetConnection].Vector4  = Vector4;  } } } else if (bArIsLoading) { if (bReplicateVector4)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector4, Ar);  bReadNewVector4  = true; } else { bReadNewVector4  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector5)  { B = bForceFullSerialization ? 1 : !Vector5.Equals(LastSerialized[CurrentTargetConnection].Vector5, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector5, Ar);  LastSerialized[CurrentTargetConnection].Vector5  = Vector5;  } } } else if (bArIsLoading) { if (bReplicateVector5)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector5, Ar);  bReadNewVector5  = true; } else { bReadNewVector5  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector6)  { B = bForceFullSerialization ? 1 : !Vector6.Equals(LastSerialized[CurrentTargetConnection].Vector6, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector6, Ar);  LastSerialized[CurrentTargetConnection].Vector6  = Vector6;  } } } else if (bArIsLoading) { if (bReplicateVector6)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector6, Ar);  bReadNewVector6  = true; } else { bReadNewVector6  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector7)  { B = bForceFullSerialization ? 1 : !Vector7.Equals(LastSerialized[CurrentTargetConnection].Vector7, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector7, Ar);  LastSerialized[CurrentTargetConnection].Vector7  = Vector7;  } } } else if (bArIsLoading) { if (bReplicateVector7)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector7, Ar);  bReadNewVector7  = true; } else { bReadNewVector7  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector8)  { B = bForceFullSerialization ? 1 : !Vector8.Equals(LastSerialized[CurrentTargetConnection].Vector8, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector8, Ar);  LastSerialized[CurrentTargetConnection].Vector8  = Vector8;  } } } else if (bArIsLoading) { if (bReplicateVector8)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector8, Ar);  bReadNewVector8  = true; } else { bReadNewVector8  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector9)  { B = bForceFullSerialization ? 1 : !Vector9.Equals(LastSerialized[CurrentTargetConnection].Vector9, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector9, Ar);  LastSerialized[CurrentTargetConnection].Vector9  = Vector9;  } } } else if (bArIsLoading) { if (bReplicateVector9)  { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector9, Ar);  bReadNewVector9  = true; } else { bReadNewVector9  = false; } } }
-  if (bArIsSaving) { if (bReplicateVector10) { B = bForceFullSerialization ? 1 : !Vector10.Equals(LastSerialized[CurrentTargetConnection].Vector10, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector10, Ar); LastSerialized[CurrentTargetConnection].Vector10 = Vector10; } } } else if (bArIsLoading) { if (bReplicateVector10) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector10, Ar); bReadNewVector10 = true; } else { bReadNewVector10 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector11) { B = bForceFullSerialization ? 1 : !Vector11.Equals(LastSerialized[CurrentTargetConnection].Vector11, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector11, Ar); LastSerialized[CurrentTargetConnection].Vector11 = Vector11; } } } else if (bArIsLoading) { if (bReplicateVector11) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector11, Ar); bReadNewVector11 = true; } else { bReadNewVector11 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector12) { B = bForceFullSerialization ? 1 : !Vector12.Equals(LastSerialized[CurrentTargetConnection].Vector12, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector12, Ar); LastSerialized[CurrentTargetConnection].Vector12 = Vector12; } } } else if (bArIsLoading) { if (bReplicateVector12) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector12, Ar); bReadNewVector12 = true; } else { bReadNewVector12 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector13) { B = bForceFullSerialization ? 1 : !Vector13.Equals(LastSerialized[CurrentTargetConnection].Vector13, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector13, Ar); LastSerialized[CurrentTargetConnection].Vector13 = Vector13; } } } else if (bArIsLoading) { if (bReplicateVector13) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector13, Ar); bReadNewVector13 = true; } else { bReadNewVector13 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector14) { B = bForceFullSerialization ? 1 : !Vector14.Equals(LastSerialized[CurrentTargetConnection].Vector14, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector14, Ar); LastSerialized[CurrentTargetConnection].Vector14 = Vector14; } } } else if (bArIsLoading) { if (bReplicateVector14) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector14, Ar); bReadNewVector14 = true; } else { bReadNewVector14 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector15) { B = bForceFullSerialization ? 1 : !Vector15.Equals(LastSerialized[CurrentTargetConnection].Vector15, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector15, Ar); LastSerialized[CurrentTargetConnection].Vector15 = Vector15; } } } else if (bArIsLoading) { if (bReplicateVector15) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector15, Ar); bReadNewVector15 = true; } else { bReadNewVector15 = false; } } }
-  if (bArIsSaving) { if (bReplicateVector16) { B = bForceFullSerialization ? 1 : !Vector16.Equals(LastSerialized[CurrentTargetConnection].Vector16, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector16, Ar); LastSerialized[CurrentTargetConnection].Vector16 = Vector16; } } } else if (bArIsLoading) { if (bReplicateVector16) { Ar.SerializeBits(&B, 1); if (B) { SerializePackedVector<100, 30>(Vector16, Ar); bReadNewVector16 = true; } else { bReadNewVector16 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte1)  { B = bForceFullSerialization ? 1 : HalfByte1  != CurrentBaseline->HalfByte1;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte1, 4);  CurrentBaseline->HalfByte1  = HalfByte1;  } } } else if (bArIsLoading) { if (bReplicateHalfByte1)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte1, 4);  bReadNewHalfByte1  = true; } else { bReadNewHalfByte1  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte2)  { B = bForceFullSerialization ? 1 : HalfByte2  != CurrentBaseline->HalfByte2;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte2, 4);  CurrentBaseline->HalfByte2  = HalfByte2;  } } } else if (bArIsLoading) { if (bReplicateHalfByte2)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte2, 4);  bReadNewHalfByte2  = true; } else { bReadNewHalfByte2  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte3)  { B = bForceFullSerialization ? 1 : HalfByte3  != CurrentBaseline->HalfByte3;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte3, 4);  CurrentBaseline->HalfByte3  = HalfByte3;  } } } else if (bArIsLoading) { if (bReplicateHalfByte3)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte3, 4);  bReadNewHalfByte3  = true; } else { bReadNewHalfByte3  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte4)  { B = bForceFullSerialization ? 1 : HalfByte4  != CurrentBaseline->HalfByte4;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte4, 4);  CurrentBaseline->HalfByte4  = HalfByte4;  } } } else if (bArIsLoading) { if (bReplicateHalfByte4)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte4, 4);  bReadNewHalfByte4  = true; } else { bReadNewHalfByte4  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte5)  { B = bForceFullSerialization ? 1 : HalfByte5  != CurrentBaseline->HalfByte5;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte5, 4);  CurrentBaseline->HalfByte5  = HalfByte5;  } } } else if (bArIsLoading) { if (bReplicateHalfByte5)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte5, 4);  bReadNewHalfByte5  = true; } else { bReadNewHalfByte5  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte6)  { B = bForceFullSerialization ? 1 : HalfByte6  != CurrentBaseline->HalfByte6;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte6, 4);  CurrentBaseline->HalfByte6  = HalfByte6;  } } } else if (bArIsLoading) { if (bReplicateHalfByte6)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte6, 4);  bReadNewHalfByte6  = true; } else { bReadNewHalfByte6  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte7)  { B = bForceFullSerialization ? 1 : HalfByte7  != CurrentBaseline->HalfByte7;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte7, 4);  CurrentBaseline->HalfByte7  = HalfByte7;  } } } else if (bArIsLoading) { if (bReplicateHalfByte7)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte7, 4);  bReadNewHalfByte7  = true; } else { bReadNewHalfByte7  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte8)  { B = bForceFullSerialization ? 1 : HalfByte8  != CurrentBaseline->HalfByte8;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte8, 4);  CurrentBaseline->HalfByte8  = HalfByte8;  } } } else if (bArIsLoading) { if (bReplicateHalfByte8)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte8, 4);  bReadNewHalfByte8  = true; } else { bReadNewHalfByte8  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte9)  { B = bForceFullSerialization ? 1 : HalfByte9  != CurrentBaseline->HalfByte9;  Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte9, 4);  CurrentBaseline->HalfByte9  = HalfByte9;  } } } else if (bArIsLoading) { if (bReplicateHalfByte9)  { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte9, 4);  bReadNewHalfByte9  = true; } else { bReadNewHalfByte9  = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte10) { B = bForceFullSerialization ? 1 : HalfByte10 != CurrentBaseline->HalfByte10; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte10, 4); CurrentBaseline->HalfByte10 = HalfByte10; } } } else if (bArIsLoading) { if (bReplicateHalfByte10) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte10, 4); bReadNewHalfByte10 = true; } else { bReadNewHalfByte10 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte11) { B = bForceFullSerialization ? 1 : HalfByte11 != CurrentBaseline->HalfByte11; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte11, 4); CurrentBaseline->HalfByte11 = HalfByte11; } } } else if (bArIsLoading) { if (bReplicateHalfByte11) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte11, 4); bReadNewHalfByte11 = true; } else { bReadNewHalfByte11 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte12) { B = bForceFullSerialization ? 1 : HalfByte12 != CurrentBaseline->HalfByte12; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte12, 4); CurrentBaseline->HalfByte12 = HalfByte12; } } } else if (bArIsLoading) { if (bReplicateHalfByte12) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte12, 4); bReadNewHalfByte12 = true; } else { bReadNewHalfByte12 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte13) { B = bForceFullSerialization ? 1 : HalfByte13 != CurrentBaseline->HalfByte13; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte13, 4); CurrentBaseline->HalfByte13 = HalfByte13; } } } else if (bArIsLoading) { if (bReplicateHalfByte13) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte13, 4); bReadNewHalfByte13 = true; } else { bReadNewHalfByte13 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte14) { B = bForceFullSerialization ? 1 : HalfByte14 != CurrentBaseline->HalfByte14; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte14, 4); CurrentBaseline->HalfByte14 = HalfByte14; } } } else if (bArIsLoading) { if (bReplicateHalfByte14) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte14, 4); bReadNewHalfByte14 = true; } else { bReadNewHalfByte14 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte15) { B = bForceFullSerialization ? 1 : HalfByte15 != CurrentBaseline->HalfByte15; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte15, 4); CurrentBaseline->HalfByte15 = HalfByte15; } } } else if (bArIsLoading) { if (bReplicateHalfByte15) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte15, 4); bReadNewHalfByte15 = true; } else { bReadNewHalfByte15 = false; } } }
+  if (bArIsSaving) { if (bReplicateHalfByte16) { B = bForceFullSerialization ? 1 : HalfByte16 != CurrentBaseline->HalfByte16; Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte16, 4); CurrentBaseline->HalfByte16 = HalfByte16; } } } else if (bArIsLoading) { if (bReplicateHalfByte16) { Ar.SerializeBits(&B, 1); if (B) { Ar.SerializeBits(&HalfByte16, 4); bReadNewHalfByte16 = true; } else { bReadNewHalfByte16 = false; } } }
 }
 
 void FState::SerializeNormalTypes(FArchive& Ar)
@@ -6556,27 +8435,27 @@ void FState::SerializeNormalTypes(FArchive& Ar)
   bool bForceFullSerialization = false;
   if (bArIsSaving)
   {
-    check(LastSerialized.Contains(CurrentTargetConnection))
-    bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+    check(CurrentBaseline)
+    bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
   }
   constexpr float COMPARE_TOLERANCE = 0.0001f;
   uint8 B = 0;
-  if (bArIsSaving) { if (bReplicateNormal1)  { B = bForceFullSerialization ? 1 : !Normal1.Equals(LastSerialized[CurrentTargetConnection].Normal1, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal1, Ar);  LastSerialized[CurrentTargetConnection].Normal1  = Normal1;  } } } else if (bArIsLoading) { if (bReplicateNormal1)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal1, Ar);  bReadNewNormal1  = true; } else { bReadNewNormal1  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal2)  { B = bForceFullSerialization ? 1 : !Normal2.Equals(LastSerialized[CurrentTargetConnection].Normal2, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal2, Ar);  LastSerialized[CurrentTargetConnection].Normal2  = Normal2;  } } } else if (bArIsLoading) { if (bReplicateNormal2)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal2, Ar);  bReadNewNormal2  = true; } else { bReadNewNormal2  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal3)  { B = bForceFullSerialization ? 1 : !Normal3.Equals(LastSerialized[CurrentTargetConnection].Normal3, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal3, Ar);  LastSerialized[CurrentTargetConnection].Normal3  = Normal3;  } } } else if (bArIsLoading) { if (bReplicateNormal3)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal3, Ar);  bReadNewNormal3  = true; } else { bReadNewNormal3  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal4)  { B = bForceFullSerialization ? 1 : !Normal4.Equals(LastSerialized[CurrentTargetConnection].Normal4, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal4, Ar);  LastSerialized[CurrentTargetConnection].Normal4  = Normal4;  } } } else if (bArIsLoading) { if (bReplicateNormal4)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal4, Ar);  bReadNewNormal4  = true; } else { bReadNewNormal4  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal5)  { B = bForceFullSerialization ? 1 : !Normal5.Equals(LastSerialized[CurrentTargetConnection].Normal5, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal5, Ar);  LastSerialized[CurrentTargetConnection].Normal5  = Normal5;  } } } else if (bArIsLoading) { if (bReplicateNormal5)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal5, Ar);  bReadNewNormal5  = true; } else { bReadNewNormal5  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal6)  { B = bForceFullSerialization ? 1 : !Normal6.Equals(LastSerialized[CurrentTargetConnection].Normal6, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal6, Ar);  LastSerialized[CurrentTargetConnection].Normal6  = Normal6;  } } } else if (bArIsLoading) { if (bReplicateNormal6)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal6, Ar);  bReadNewNormal6  = true; } else { bReadNewNormal6  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal7)  { B = bForceFullSerialization ? 1 : !Normal7.Equals(LastSerialized[CurrentTargetConnection].Normal7, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal7, Ar);  LastSerialized[CurrentTargetConnection].Normal7  = Normal7;  } } } else if (bArIsLoading) { if (bReplicateNormal7)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal7, Ar);  bReadNewNormal7  = true; } else { bReadNewNormal7  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal8)  { B = bForceFullSerialization ? 1 : !Normal8.Equals(LastSerialized[CurrentTargetConnection].Normal8, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal8, Ar);  LastSerialized[CurrentTargetConnection].Normal8  = Normal8;  } } } else if (bArIsLoading) { if (bReplicateNormal8)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal8, Ar);  bReadNewNormal8  = true; } else { bReadNewNormal8  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal9)  { B = bForceFullSerialization ? 1 : !Normal9.Equals(LastSerialized[CurrentTargetConnection].Normal9, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal9, Ar);  LastSerialized[CurrentTargetConnection].Normal9  = Normal9;  } } } else if (bArIsLoading) { if (bReplicateNormal9)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal9, Ar);  bReadNewNormal9  = true; } else { bReadNewNormal9  = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal10) { B = bForceFullSerialization ? 1 : !Normal10.Equals(LastSerialized[CurrentTargetConnection].Normal10, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal10, Ar); LastSerialized[CurrentTargetConnection].Normal10 = Normal10; } } } else if (bArIsLoading) { if (bReplicateNormal10) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal10, Ar); bReadNewNormal10 = true; } else { bReadNewNormal10 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal11) { B = bForceFullSerialization ? 1 : !Normal11.Equals(LastSerialized[CurrentTargetConnection].Normal11, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal11, Ar); LastSerialized[CurrentTargetConnection].Normal11 = Normal11; } } } else if (bArIsLoading) { if (bReplicateNormal11) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal11, Ar); bReadNewNormal11 = true; } else { bReadNewNormal11 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal12) { B = bForceFullSerialization ? 1 : !Normal12.Equals(LastSerialized[CurrentTargetConnection].Normal12, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal12, Ar); LastSerialized[CurrentTargetConnection].Normal12 = Normal12; } } } else if (bArIsLoading) { if (bReplicateNormal12) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal12, Ar); bReadNewNormal12 = true; } else { bReadNewNormal12 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal13) { B = bForceFullSerialization ? 1 : !Normal13.Equals(LastSerialized[CurrentTargetConnection].Normal13, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal13, Ar); LastSerialized[CurrentTargetConnection].Normal13 = Normal13; } } } else if (bArIsLoading) { if (bReplicateNormal13) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal13, Ar); bReadNewNormal13 = true; } else { bReadNewNormal13 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal14) { B = bForceFullSerialization ? 1 : !Normal14.Equals(LastSerialized[CurrentTargetConnection].Normal14, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal14, Ar); LastSerialized[CurrentTargetConnection].Normal14 = Normal14; } } } else if (bArIsLoading) { if (bReplicateNormal14) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal14, Ar); bReadNewNormal14 = true; } else { bReadNewNormal14 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal15) { B = bForceFullSerialization ? 1 : !Normal15.Equals(LastSerialized[CurrentTargetConnection].Normal15, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal15, Ar); LastSerialized[CurrentTargetConnection].Normal15 = Normal15; } } } else if (bArIsLoading) { if (bReplicateNormal15) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal15, Ar); bReadNewNormal15 = true; } else { bReadNewNormal15 = false; } } }
-  if (bArIsSaving) { if (bReplicateNormal16) { B = bForceFullSerialization ? 1 : !Normal16.Equals(LastSerialized[CurrentTargetConnection].Normal16, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal16, Ar); LastSerialized[CurrentTargetConnection].Normal16 = Normal16; } } } else if (bArIsLoading) { if (bReplicateNormal16) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal16, Ar); bReadNewNormal16 = true; } else { bReadNewNormal16 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal1)  { B = bForceFullSerialization ? 1 : !Normal1.Equals(CurrentBaseline->Normal1, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal1, Ar);  CurrentBaseline->Normal1  = Normal1;  } } } else if (bArIsLoading) { if (bReplicateNormal1)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal1, Ar);  bReadNewNormal1  = true; } else { bReadNewNormal1  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal2)  { B = bForceFullSerialization ? 1 : !Normal2.Equals(CurrentBaseline->Normal2, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal2, Ar);  CurrentBaseline->Normal2  = Normal2;  } } } else if (bArIsLoading) { if (bReplicateNormal2)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal2, Ar);  bReadNewNormal2  = true; } else { bReadNewNormal2  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal3)  { B = bForceFullSerialization ? 1 : !Normal3.Equals(CurrentBaseline->Normal3, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal3, Ar);  CurrentBaseline->Normal3  = Normal3;  } } } else if (bArIsLoading) { if (bReplicateNormal3)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal3, Ar);  bReadNewNormal3  = true; } else { bReadNewNormal3  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal4)  { B = bForceFullSerialization ? 1 : !Normal4.Equals(CurrentBaseline->Normal4, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal4, Ar);  CurrentBaseline->Normal4  = Normal4;  } } } else if (bArIsLoading) { if (bReplicateNormal4)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal4, Ar);  bReadNewNormal4  = true; } else { bReadNewNormal4  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal5)  { B = bForceFullSerialization ? 1 : !Normal5.Equals(CurrentBaseline->Normal5, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal5, Ar);  CurrentBaseline->Normal5  = Normal5;  } } } else if (bArIsLoading) { if (bReplicateNormal5)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal5, Ar);  bReadNewNormal5  = true; } else { bReadNewNormal5  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal6)  { B = bForceFullSerialization ? 1 : !Normal6.Equals(CurrentBaseline->Normal6, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal6, Ar);  CurrentBaseline->Normal6  = Normal6;  } } } else if (bArIsLoading) { if (bReplicateNormal6)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal6, Ar);  bReadNewNormal6  = true; } else { bReadNewNormal6  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal7)  { B = bForceFullSerialization ? 1 : !Normal7.Equals(CurrentBaseline->Normal7, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal7, Ar);  CurrentBaseline->Normal7  = Normal7;  } } } else if (bArIsLoading) { if (bReplicateNormal7)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal7, Ar);  bReadNewNormal7  = true; } else { bReadNewNormal7  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal8)  { B = bForceFullSerialization ? 1 : !Normal8.Equals(CurrentBaseline->Normal8, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal8, Ar);  CurrentBaseline->Normal8  = Normal8;  } } } else if (bArIsLoading) { if (bReplicateNormal8)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal8, Ar);  bReadNewNormal8  = true; } else { bReadNewNormal8  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal9)  { B = bForceFullSerialization ? 1 : !Normal9.Equals(CurrentBaseline->Normal9, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal9, Ar);  CurrentBaseline->Normal9  = Normal9;  } } } else if (bArIsLoading) { if (bReplicateNormal9)  { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal9, Ar);  bReadNewNormal9  = true; } else { bReadNewNormal9  = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal10) { B = bForceFullSerialization ? 1 : !Normal10.Equals(CurrentBaseline->Normal10, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal10, Ar); CurrentBaseline->Normal10 = Normal10; } } } else if (bArIsLoading) { if (bReplicateNormal10) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal10, Ar); bReadNewNormal10 = true; } else { bReadNewNormal10 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal11) { B = bForceFullSerialization ? 1 : !Normal11.Equals(CurrentBaseline->Normal11, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal11, Ar); CurrentBaseline->Normal11 = Normal11; } } } else if (bArIsLoading) { if (bReplicateNormal11) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal11, Ar); bReadNewNormal11 = true; } else { bReadNewNormal11 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal12) { B = bForceFullSerialization ? 1 : !Normal12.Equals(CurrentBaseline->Normal12, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal12, Ar); CurrentBaseline->Normal12 = Normal12; } } } else if (bArIsLoading) { if (bReplicateNormal12) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal12, Ar); bReadNewNormal12 = true; } else { bReadNewNormal12 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal13) { B = bForceFullSerialization ? 1 : !Normal13.Equals(CurrentBaseline->Normal13, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal13, Ar); CurrentBaseline->Normal13 = Normal13; } } } else if (bArIsLoading) { if (bReplicateNormal13) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal13, Ar); bReadNewNormal13 = true; } else { bReadNewNormal13 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal14) { B = bForceFullSerialization ? 1 : !Normal14.Equals(CurrentBaseline->Normal14, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal14, Ar); CurrentBaseline->Normal14 = Normal14; } } } else if (bArIsLoading) { if (bReplicateNormal14) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal14, Ar); bReadNewNormal14 = true; } else { bReadNewNormal14 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal15) { B = bForceFullSerialization ? 1 : !Normal15.Equals(CurrentBaseline->Normal15, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal15, Ar); CurrentBaseline->Normal15 = Normal15; } } } else if (bArIsLoading) { if (bReplicateNormal15) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal15, Ar); bReadNewNormal15 = true; } else { bReadNewNormal15 = false; } } }
+  if (bArIsSaving) { if (bReplicateNormal16) { B = bForceFullSerialization ? 1 : !Normal16.Equals(CurrentBaseline->Normal16, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal16, Ar); CurrentBaseline->Normal16 = Normal16; } } } else if (bArIsLoading) { if (bReplicateNormal16) { Ar.SerializeBits(&B, 1); if (B) { SerializeFixedVector<1, 16>(Normal16, Ar); bReadNewNormal16 = true; } else { bReadNewNormal16 = false; } } }
 }
 
 void FState::SerializeRotatorTypes(FArchive& Ar)
@@ -6588,25 +8467,25 @@ void FState::SerializeRotatorTypes(FArchive& Ar)
   bool bForceFullSerialization = false;
   if (bArIsSaving)
   {
-    check(LastSerialized.Contains(CurrentTargetConnection))
-    bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;
+    check(CurrentBaseline)
+    bForceFullSerialization = !bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate;
   }
   constexpr float COMPARE_TOLERANCE = 0.01f;
   uint8 B = 0;
-  if (bArIsSaving) { if (bReplicateRotator1)  { B = bForceFullSerialization ? 1 : !Rotator1.Equals(LastSerialized[CurrentTargetConnection].Rotator1, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator1.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator1  = Rotator1;  } } } else if (bArIsLoading) { if (bReplicateRotator1)  { Ar.SerializeBits(&B, 1); if (B) { Rotator1.SerializeCompressedShort(Ar);  bReadNewRotator1  = true; } else { bReadNewRotator1  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator2)  { B = bForceFullSerialization ? 1 : !Rotator2.Equals(LastSerialized[CurrentTargetConnection].Rotator2, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator2.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator2  = Rotator2;  } } } else if (bArIsLoading) { if (bReplicateRotator2)  { Ar.SerializeBits(&B, 1); if (B) { Rotator2.SerializeCompressedShort(Ar);  bReadNewRotator2  = true; } else { bReadNewRotator2  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator3)  { B = bForceFullSerialization ? 1 : !Rotator3.Equals(LastSerialized[CurrentTargetConnection].Rotator3, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator3.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator3  = Rotator3;  } } } else if (bArIsLoading) { if (bReplicateRotator3)  { Ar.SerializeBits(&B, 1); if (B) { Rotator3.SerializeCompressedShort(Ar);  bReadNewRotator3  = true; } else { bReadNewRotator3  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator4)  { B = bForceFullSerialization ? 1 : !Rotator4.Equals(LastSerialized[CurrentTargetConnection].Rotator4, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator4.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator4  = Rotator4;  } } } else if (bArIsLoading) { if (bReplicateRotator4)  { Ar.SerializeBits(&B, 1); if (B) { Rotator4.SerializeCompressedShort(Ar);  bReadNewRotator4  = true; } else { bReadNewRotator4  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator5)  { B = bForceFullSerialization ? 1 : !Rotator5.Equals(LastSerialized[CurrentTargetConnection].Rotator5, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator5.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator5  = Rotator5;  } } } else if (bArIsLoading) { if (bReplicateRotator5)  { Ar.SerializeBits(&B, 1); if (B) { Rotator5.SerializeCompressedShort(Ar);  bReadNewRotator5  = true; } else { bReadNewRotator5  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator6)  { B = bForceFullSerialization ? 1 : !Rotator6.Equals(LastSerialized[CurrentTargetConnection].Rotator6, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator6.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator6  = Rotator6;  } } } else if (bArIsLoading) { if (bReplicateRotator6)  { Ar.SerializeBits(&B, 1); if (B) { Rotator6.SerializeCompressedShort(Ar);  bReadNewRotator6  = true; } else { bReadNewRotator6  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator7)  { B = bForceFullSerialization ? 1 : !Rotator7.Equals(LastSerialized[CurrentTargetConnection].Rotator7, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator7.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator7  = Rotator7;  } } } else if (bArIsLoading) { if (bReplicateRotator7)  { Ar.SerializeBits(&B, 1); if (B) { Rotator7.SerializeCompressedShort(Ar);  bReadNewRotator7  = true; } else { bReadNewRotator7  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator8)  { B = bForceFullSerialization ? 1 : !Rotator8.Equals(LastSerialized[CurrentTargetConnection].Rotator8, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator8.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator8  = Rotator8;  } } } else if (bArIsLoading) { if (bReplicateRotator8)  { Ar.SerializeBits(&B, 1); if (B) { Rotator8.SerializeCompressedShort(Ar);  bReadNewRotator8  = true; } else { bReadNewRotator8  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator9)  { B = bForceFullSerialization ? 1 : !Rotator9.Equals(LastSerialized[CurrentTargetConnection].Rotator9, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator9.SerializeCompressedShort(Ar);  LastSerialized[CurrentTargetConnection].Rotator9  = Rotator9;  } } } else if (bArIsLoading) { if (bReplicateRotator9)  { Ar.SerializeBits(&B, 1); if (B) { Rotator9.SerializeCompressedShort(Ar);  bReadNewRotator9  = true; } else { bReadNewRotator9  = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator10) { B = bForceFullSerialization ? 1 : !Rotator10.Equals(LastSerialized[CurrentTargetConnection].Rotator10, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator10.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator10 = Rotator10; } } } else if (bArIsLoading) { if (bReplicateRotator10) { Ar.SerializeBits(&B, 1); if (B) { Rotator10.SerializeCompressedShort(Ar); bReadNewRotator10 = true; } else { bReadNewRotator10 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator11) { B = bForceFullSerialization ? 1 : !Rotator11.Equals(LastSerialized[CurrentTargetConnection].Rotator11, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator11.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator11 = Rotator11; } } } else if (bArIsLoading) { if (bReplicateRotator11) { Ar.SerializeBits(&B, 1); if (B) { Rotator11.SerializeCompressedShort(Ar); bReadNewRotator11 = true; } else { bReadNewRotator11 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator12) { B = bForceFullSerialization ? 1 : !Rotator12.Equals(LastSerialized[CurrentTargetConnection].Rotator12, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator12.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator12 = Rotator12; } } } else if (bArIsLoading) { if (bReplicateRotator12) { Ar.SerializeBits(&B, 1); if (B) { Rotator12.SerializeCompressedShort(Ar); bReadNewRotator12 = true; } else { bReadNewRotator12 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator13) { B = bForceFullSerialization ? 1 : !Rotator13.Equals(LastSerialized[CurrentTargetConnection].Rotator13, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator13.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator13 = Rotator13; } } } else if (bArIsLoading) { if (bReplicateRotator13) { Ar.SerializeBits(&B, 1); if (B) { Rotator13.SerializeCompressedShort(Ar); bReadNewRotator13 = true; } else { bReadNewRotator13 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator14) { B = bForceFullSerialization ? 1 : !Rotator14.Equals(LastSerialized[CurrentTargetConnection].Rotator14, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator14.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator14 = Rotator14; } } } else if (bArIsLoading) { if (bReplicateRotator14) { Ar.SerializeBits(&B, 1); if (B) { Rotator14.SerializeCompressedShort(Ar); bReadNewRotator14 = true; } else { bReadNewRotator14 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator15) { B = bForceFullSerialization ? 1 : !Rotator15.Equals(LastSerialized[CurrentTargetConnection].Rotator15, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator15.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator15 = Rotator15; } } } else if (bArIsLoading) { if (bReplicateRotator15) { Ar.SerializeBits(&B, 1); if (B) { Rotator15.SerializeCompressedShort(Ar); bReadNewRotator15 = true; } else { bReadNewRotator15 = false; } } }
-  if (bArIsSaving) { if (bReplicateRotator16) { B = bForceFullSerialization ? 1 : !Rotator16.Equals(LastSerialized[CurrentTargetConnection].Rotator16, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator16.SerializeCompressedShort(Ar); LastSerialized[CurrentTargetConnection].Rotator16 = Rotator16; } } } else if (bArIsLoading) { if (bReplicateRotator16) { Ar.SerializeBits(&B, 1); if (B) { Rotator16.SerializeCompressedShort(Ar); bReadNewRotator16 = true; } else { bReadNewRotator16 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator1)  { B = bForceFullSerialization ? 1 : !Rotator1.Equals(CurrentBaseline->Rotator1, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator1.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator1  = Rotator1;  } } } else if (bArIsLoading) { if (bReplicateRotator1)  { Ar.SerializeBits(&B, 1); if (B) { Rotator1.SerializeCompressedShort(Ar);  bReadNewRotator1  = true; } else { bReadNewRotator1  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator2)  { B = bForceFullSerialization ? 1 : !Rotator2.Equals(CurrentBaseline->Rotator2, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator2.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator2  = Rotator2;  } } } else if (bArIsLoading) { if (bReplicateRotator2)  { Ar.SerializeBits(&B, 1); if (B) { Rotator2.SerializeCompressedShort(Ar);  bReadNewRotator2  = true; } else { bReadNewRotator2  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator3)  { B = bForceFullSerialization ? 1 : !Rotator3.Equals(CurrentBaseline->Rotator3, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator3.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator3  = Rotator3;  } } } else if (bArIsLoading) { if (bReplicateRotator3)  { Ar.SerializeBits(&B, 1); if (B) { Rotator3.SerializeCompressedShort(Ar);  bReadNewRotator3  = true; } else { bReadNewRotator3  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator4)  { B = bForceFullSerialization ? 1 : !Rotator4.Equals(CurrentBaseline->Rotator4, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator4.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator4  = Rotator4;  } } } else if (bArIsLoading) { if (bReplicateRotator4)  { Ar.SerializeBits(&B, 1); if (B) { Rotator4.SerializeCompressedShort(Ar);  bReadNewRotator4  = true; } else { bReadNewRotator4  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator5)  { B = bForceFullSerialization ? 1 : !Rotator5.Equals(CurrentBaseline->Rotator5, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator5.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator5  = Rotator5;  } } } else if (bArIsLoading) { if (bReplicateRotator5)  { Ar.SerializeBits(&B, 1); if (B) { Rotator5.SerializeCompressedShort(Ar);  bReadNewRotator5  = true; } else { bReadNewRotator5  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator6)  { B = bForceFullSerialization ? 1 : !Rotator6.Equals(CurrentBaseline->Rotator6, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator6.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator6  = Rotator6;  } } } else if (bArIsLoading) { if (bReplicateRotator6)  { Ar.SerializeBits(&B, 1); if (B) { Rotator6.SerializeCompressedShort(Ar);  bReadNewRotator6  = true; } else { bReadNewRotator6  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator7)  { B = bForceFullSerialization ? 1 : !Rotator7.Equals(CurrentBaseline->Rotator7, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator7.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator7  = Rotator7;  } } } else if (bArIsLoading) { if (bReplicateRotator7)  { Ar.SerializeBits(&B, 1); if (B) { Rotator7.SerializeCompressedShort(Ar);  bReadNewRotator7  = true; } else { bReadNewRotator7  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator8)  { B = bForceFullSerialization ? 1 : !Rotator8.Equals(CurrentBaseline->Rotator8, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator8.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator8  = Rotator8;  } } } else if (bArIsLoading) { if (bReplicateRotator8)  { Ar.SerializeBits(&B, 1); if (B) { Rotator8.SerializeCompressedShort(Ar);  bReadNewRotator8  = true; } else { bReadNewRotator8  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator9)  { B = bForceFullSerialization ? 1 : !Rotator9.Equals(CurrentBaseline->Rotator9, COMPARE_TOLERANCE);   Ar.SerializeBits(&B, 1); if (B) { Rotator9.SerializeCompressedShort(Ar);  CurrentBaseline->Rotator9  = Rotator9;  } } } else if (bArIsLoading) { if (bReplicateRotator9)  { Ar.SerializeBits(&B, 1); if (B) { Rotator9.SerializeCompressedShort(Ar);  bReadNewRotator9  = true; } else { bReadNewRotator9  = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator10) { B = bForceFullSerialization ? 1 : !Rotator10.Equals(CurrentBaseline->Rotator10, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator10.SerializeCompressedShort(Ar); CurrentBaseline->Rotator10 = Rotator10; } } } else if (bArIsLoading) { if (bReplicateRotator10) { Ar.SerializeBits(&B, 1); if (B) { Rotator10.SerializeCompressedShort(Ar); bReadNewRotator10 = true; } else { bReadNewRotator10 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator11) { B = bForceFullSerialization ? 1 : !Rotator11.Equals(CurrentBaseline->Rotator11, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator11.SerializeCompressedShort(Ar); CurrentBaseline->Rotator11 = Rotator11; } } } else if (bArIsLoading) { if (bReplicateRotator11) { Ar.SerializeBits(&B, 1); if (B) { Rotator11.SerializeCompressedShort(Ar); bReadNewRotator11 = true; } else { bReadNewRotator11 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator12) { B = bForceFullSerialization ? 1 : !Rotator12.Equals(CurrentBaseline->Rotator12, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator12.SerializeCompressedShort(Ar); CurrentBaseline->Rotator12 = Rotator12; } } } else if (bArIsLoading) { if (bReplicateRotator12) { Ar.SerializeBits(&B, 1); if (B) { Rotator12.SerializeCompressedShort(Ar); bReadNewRotator12 = true; } else { bReadNewRotator12 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator13) { B = bForceFullSerialization ? 1 : !Rotator13.Equals(CurrentBaseline->Rotator13, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator13.SerializeCompressedShort(Ar); CurrentBaseline->Rotator13 = Rotator13; } } } else if (bArIsLoading) { if (bReplicateRotator13) { Ar.SerializeBits(&B, 1); if (B) { Rotator13.SerializeCompressedShort(Ar); bReadNewRotator13 = true; } else { bReadNewRotator13 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator14) { B = bForceFullSerialization ? 1 : !Rotator14.Equals(CurrentBaseline->Rotator14, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator14.SerializeCompressedShort(Ar); CurrentBaseline->Rotator14 = Rotator14; } } } else if (bArIsLoading) { if (bReplicateRotator14) { Ar.SerializeBits(&B, 1); if (B) { Rotator14.SerializeCompressedShort(Ar); bReadNewRotator14 = true; } else { bReadNewRotator14 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator15) { B = bForceFullSerialization ? 1 : !Rotator15.Equals(CurrentBaseline->Rotator15, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator15.SerializeCompressedShort(Ar); CurrentBaseline->Rotator15 = Rotator15; } } } else if (bArIsLoading) { if (bReplicateRotator15) { Ar.SerializeBits(&B, 1); if (B) { Rotator15.SerializeCompressedShort(Ar); bReadNewRotator15 = true; } else { bReadNewRotator15 = false; } } }
+  if (bArIsSaving) { if (bReplicateRotator16) { B = bForceFullSerialization ? 1 : !Rotator16.Equals(CurrentBaseline->Rotator16, COMPARE_TOLERANCE); Ar.SerializeBits(&B, 1); if (B) { Rotator16.SerializeCompressedShort(Ar); CurrentBaseline->Rotator16 = Rotator16; } } } else if (bArIsLoading) { if (bReplicateRotator16) { Ar.SerializeBits(&B, 1); if (B) { Rotator16.SerializeCompressedShort(Ar); bReadNewRotator16 = true; } else { bReadNewRotator16 = false; } } }
 }
@@ -20,11 +20,23 @@ DECLARE_CYCLE_STAT(TEXT("Physics Airborne"), STAT_PhysicsAirborne, STATGROUP_GMC
 DECLARE_CYCLE_STAT(TEXT("Physics Buoyant"), STAT_PhysicsBuoyant, STATGROUP_GMCOrganicMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Physics Custom"), STAT_PhysicsCustom, STATGROUP_GMCOrganicMovementComp)
 DECLARE_CYCLE_STAT(TEXT("Calculate Velocity"), STAT_CalculateVelocity, STATGROUP_GMCOrganicMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Idle Sleeping Pawns"), STAT_IdleSleepingPawns, STATGROUP_GMCOrganicMovementComp)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Idle Slept Ticks"), STAT_IdleSleptTicks, STATGROUP_GMCOrganicMovementComp)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Idle Sleep Saved Time (ms)"), STAT_IdleSleepSavedTime, STATGROUP_GMCOrganicMovementComp)
 
 namespace GMCCVars
 {
+  int32 IdleSleep = 1;
+
 #if ALLOW_CONSOLE && !NO_LOGGING
 
+  FAutoConsoleVariableRef CVarIdleSleep(
+    TEXT("gmc.IdleSleep"),
+    IdleSleep,
+    TEXT("Allow pawns with \"bAllowIdleSleep\" enabled to skip their movement update while they are at rest. 0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
   int32 StatOrganicMovementValues = 0;
   FAutoConsoleVariableRef CVarStatOrganicMovementValues(
     TEXT("gmc.StatOrganicMovementValues"),
@@ -153,6 +165,16 @@ void UGenOrganicMovementComponent::GenReplicatedTick_Implementation(float DeltaT
     AvoidanceLockTimer = FMath::Clamp(AvoidanceLockTimer - DeltaTime, 0.f, BIG_NUMBER);
   }
 
+  // A sleeping pawn skips penetration resolution, the movement update and physics interaction altogether.
+  if (TickIdleSleep())
+  {
+    return;
+  }
+
+#if STATS
+  const uint64 MovementStartCycles = FPlatformTime::Cycles64();
+#endif
+
   AutoResolvePenetration();
 
   PerformMovement(DeltaTime);
@@ -164,6 +186,15 @@ void UGenOrganicMovementComponent::GenReplicatedTick_Implementation(float DeltaT
     ApplyRepulsionForce(DeltaTime);
   }
 
+  if (IsIdleSleepEnabled())
+  {
+#if STATS
+    const float MovementTime = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - MovementStartCycles);
+    AverageAwakeUpdateTime = AverageAwakeUpdateTime > 0.f ? FMath::Lerp(AverageAwakeUpdateTime, MovementTime, 0.1f) : MovementTime;
+#endif
+    UpdateIdleSleepAfterMovement();
+  }
+
   if (ShouldComputeAvoidance())
   {
     UpdateAvoidance();
@@ -253,6 +284,21 @@ void UGenOrganicMovementComponent::Client_DoNotCombineNextMove()
   }
 }
 
+bool UGenOrganicMovementComponent::Server_ShouldCaptureServerState_Custom()
+{
+  const UAnimInstance* AnimInstance = SkeletalMesh ? SkeletalMesh->GetAnimInstance() : nullptr;
+  const UAnimMontage* Montage = AnimInstance ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+  const bool bMontageStarted = Montage && Montage != Server_LastCaptureCheckMontage.Get();
+  const bool bCapture =
+    bMontageStarted
+    || MovementMode != Server_LastCaptureCheckMovementMode
+    || CurrentRootCollisionShape != Server_LastCaptureCheckRootCollisionShape;
+  Server_LastCaptureCheckMovementMode = MovementMode;
+  Server_LastCaptureCheckRootCollisionShape = CurrentRootCollisionShape;
+  Server_LastCaptureCheckMontage = Montage;
+  return bCapture;
+}
+
 EGenCollisionShape UGenOrganicMovementComponent::GetRootCollisionShape() const
 {
   checkGMC(
@@ -403,6 +449,7 @@ void UGenOrganicMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdat
   if (IsValid(UpdatedPrimitive) && UpdatedPrimitive->OnComponentBeginOverlap.IsBound())
   {
     UpdatedPrimitive->OnComponentBeginOverlap.RemoveDynamic(this, &UGenOrganicMovementComponent::RootCollisionTouched);
+    UpdatedPrimitive->OnComponentBeginOverlap.RemoveDynamic(this, &UGenOrganicMovementComponent::WakeOnOverlap);
   }
 
   Super::SetUpdatedComponent(NewUpdatedComponent);
@@ -427,13 +474,44 @@ void UGenOrganicMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdat
   {
     UpdatedPrimitive->OnComponentBeginOverlap.AddUniqueDynamic(this, &UGenOrganicMovementComponent::RootCollisionTouched);
   }
+
+  if (bAllowIdleSleep)
+  {
+    UpdatedPrimitive->OnComponentBeginOverlap.AddUniqueDynamic(this, &UGenOrganicMovementComponent::WakeOnOverlap);
+  }
+}
+
+void UGenOrganicMovementComponent::CacheBlueprintHooks()
+{
+  Super::CacheBlueprintHooks();
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PreProcessInputVector);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PreMovementUpdate);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostMovementUpdate);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PrePhysicsUpdate);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostPhysicsUpdate);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, MovementUpdate);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PhysicsCustom);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, CalculateVelocityCustom);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostProcessPawnVelocity);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostProcessBaseVelocity);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostProcessVelocityToImpart);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, UpdateMovementModeDynamic);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, UpdateMovementModeStatic);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, OnMovementModeUpdated);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, OnStuckInGeometry);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, OnLanded);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, OnMovementModeChanged);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, PostProcessAnimRootMotionVelocity);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, GetInputAccelerationCustom);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, GetBrakingDecelerationCustom);
+  GMC_CACHE_BLUEPRINT_HOOK(UGenOrganicMovementComponent, GetOverMaxSpeedDecelerationCustom);
 }
 
 void UGenOrganicMovementComponent::PerformMovement(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_PerformMovement)
 
-	PreMovementUpdate(DeltaSeconds);
+	GMC_CALL_HOOK(PreMovementUpdate, DeltaSeconds);
 
 	if (!CanMove())
 	{
@@ -447,17 +525,17 @@ void UGenOrganicMovementComponent::PerformMovement(float DeltaSeconds)
 
 		EGenMovementMode PreviousMovementMode = GetMovementMode();
 
-		if (!UpdateMovementModeDynamic(CurrentFloor))
+		if (!GMC_CALL_HOOK(UpdateMovementModeDynamic, CurrentFloor))
 		{
-			UpdateMovementModeStatic(CurrentFloor);
+			GMC_CALL_HOOK(UpdateMovementModeStatic, CurrentFloor);
 		}
 
-		OnMovementModeUpdated(PreviousMovementMode);
+		GMC_CALL_HOOK(OnMovementModeUpdated, PreviousMovementMode);
 	}
 
 	// @note Often the input vector is processed with regard to the current movement mode so we call this after the movement mode was updated.
 	// 通常输入向量是根据当前的移动模式来处理的，所以我们在移动模式被更新后调用它。
-	ProcessedInputVector = PreProcessInputVector(GetMoveInputVector());
+	ProcessedInputVector = GMC_CALL_HOOK(PreProcessInputVector, GetMoveInputVector());
 
 	RunPhysics(DeltaSeconds);
 
@@ -465,7 +543,7 @@ void UGenOrganicMovementComponent::PerformMovement(float DeltaSeconds)
 
 	// Preferred entry point for subclasses to implement their own movement logic.
 	// 子类实现自己的移动逻辑的首选入口点。
-	MovementUpdate(DeltaSeconds);
+	GMC_CALL_HOOK(MovementUpdate, DeltaSeconds);
 
 	bHasAnimRootMotion = false;
 	bool bSimulatePoseTick{false};
@@ -477,7 +555,7 @@ void UGenOrganicMovementComponent::PerformMovement(float DeltaSeconds)
 	// 将受到的外力设置为向上
 	SetReceivedExternalForceUpward(VelocityBeforeMovementUpdate);
 
-	PostMovementUpdate(DeltaSeconds);
+	GMC_CALL_HOOK(PostMovementUpdate, DeltaSeconds);
 
 	if (bClearMontageInstancesPerTick)
 	{
@@ -532,7 +610,7 @@ void UGenOrganicMovementComponent::ClampToValidValues()
 
 void UGenOrganicMovementComponent::RunPhysics(float DeltaSeconds)
 {
-  PrePhysicsUpdate(DeltaSeconds);
+  GMC_CALL_HOOK(PrePhysicsUpdate, DeltaSeconds);
 
   switch (GetMovementMode())
   {
@@ -562,11 +640,11 @@ void UGenOrganicMovementComponent::RunPhysics(float DeltaSeconds)
     default:
     {
       SCOPE_CYCLE_COUNTER(STAT_PhysicsCustom)
-      PhysicsCustom(DeltaSeconds);
+      GMC_CALL_HOOK(PhysicsCustom, DeltaSeconds);
     }
   }
 
-  PostPhysicsUpdate(DeltaSeconds);
+  GMC_CALL_HOOK(PostPhysicsUpdate, DeltaSeconds);
 }
 
 void UGenOrganicMovementComponent::PostPhysicsUpdate_Implementation(float DeltaSeconds)
@@ -903,7 +981,7 @@ void UGenOrganicMovementComponent::CalculateVelocity(float DeltaSeconds)
 
   ApplyExternalForces(DeltaSeconds);
 
-  CalculateVelocityCustom(DeltaSeconds);
+  GMC_CALL_HOOK(CalculateVelocityCustom, DeltaSeconds);
 
   ApplyDeceleration(DeltaSeconds);
 
@@ -914,7 +992,7 @@ void UGenOrganicMovementComponent::CalculateVelocity(float DeltaSeconds)
     CalculateAvoidanceVelocity(DeltaSeconds);
   }
 
-  PostProcessPawnVelocity();
+  GMC_CALL_HOOK(PostProcessPawnVelocity);
 }
 
 void UGenOrganicMovementComponent::DirectMove(float DeltaSeconds)
@@ -1322,7 +1400,7 @@ FVector UGenOrganicMovementComponent::ComputeBaseVelocity(UPrimitiveComponent* M
     }
   }
 
-  BaseVelocity = PostProcessBaseVelocity(MovementBase, BaseVelocity);
+  BaseVelocity = GMC_CALL_HOOK(PostProcessBaseVelocity, MovementBase, BaseVelocity);
   CFLog(!BaseVelocity.IsZero(), VeryVerbose, "Calculated base velocity is %s.", *BaseVelocity.ToString())
   return BaseVelocity;
 }
@@ -2177,7 +2255,7 @@ FHitResult UGenOrganicMovementComponent::AutoResolvePenetration()
     }
     FLog(Warning, "Pawn stuck in %s.", bHitPawn ? TEXT("other pawn") : TEXT("geometry"))
     bStuckInGeometry = true;
-    OnStuckInGeometry();
+    GMC_CALL_HOOK(OnStuckInGeometry);
   }
 
   DEBUG_LOG_AUTO_RESOLVE_PENETRATION_END
@@ -2349,7 +2427,7 @@ void UGenOrganicMovementComponent::SetMovementMode(uint8 NewMovementMode)
   {
     uint8 PreviousMovementMode = MovementMode;
     MovementMode = NewMovementMode;
-    OnMovementModeChanged(static_cast<EGenMovementMode>(PreviousMovementMode));
+    GMC_CALL_HOOK(OnMovementModeChanged, static_cast<EGenMovementMode>(PreviousMovementMode));
   }
 }
 
@@ -2481,7 +2559,7 @@ void UGenOrganicMovementComponent::OnMovementModeChanged_Implementation(EGenMove
 
   if (IsMovingOnGround() && PreviousMovementMode == EGenMovementMode::Airborne)
   {
-    OnLanded();
+    GMC_CALL_HOOK(OnLanded);
     if (const auto PFAgent = GetPathFollowingAgent()) PFAgent->OnLanded();
   }
   else if (IsAirborne() && PreviousMovementMode == EGenMovementMode::Grounded)
@@ -2512,7 +2590,7 @@ void UGenOrganicMovementComponent::OnMovementModeChanged_Implementation(EGenMove
             VelocityToImpart += ComputeTangentialVelocity(GetLowerBound(), PreviousMovementBase);
           }
         }
-        AddVelocity(PostProcessVelocityToImpart(PreviousMovementBase, VelocityToImpart));
+        AddVelocity(GMC_CALL_HOOK(PostProcessVelocityToImpart, PreviousMovementBase, VelocityToImpart));
       }
     }
   }
@@ -2576,6 +2654,172 @@ void UGenOrganicMovementComponent::DisableMovement()
   SetMovementMode(EGenMovementMode::None);
 }
 
+bool UGenOrganicMovementComponent::IsIdleSleepEnabled() const
+{
+  return bAllowIdleSleep && GMCCVars::IdleSleep != 0;
+}
+
+void UGenOrganicMovementComponent::WakeFromIdleSleep()
+{
+  bIdleSleepWakeRequested = true;
+}
+
+bool UGenOrganicMovementComponent::CanIdleSleep() const
+{
+  if (!IsMovingOnGround() || !GetVelocity().IsZero() || !GetMoveInputVector().IsZero() || GetMoveInputFlags() != 0)
+  {
+    return false;
+  }
+  // @see ShouldComputeAvoidance is not const but does not modify the component, it is called here so that overrides are respected.
+  if (
+    !RequestedVelocity.IsZero() || bHasAnimRootMotion || bStuckInGeometry
+    || const_cast<UGenOrganicMovementComponent*>(this)->ShouldComputeAvoidance()
+  )
+  {
+    return false;
+  }
+  if (SkeletalMesh && IsPlayingMontage(SkeletalMesh))
+  {
+    return false;
+  }
+  // A base simulating physics can be moved by the pawn itself (@see ApplyDownwardForce).
+  const auto MovementBase = GetMovementBase();
+  return !MovementBase || !MovementBase->IsSimulatingPhysics();
+}
+
+bool UGenOrganicMovementComponent::CanExecuteMovesConcurrently() const
+{
+  if (!Super::CanExecuteMovesConcurrently()) return false;
+  // Montages are advanced by ticking the pose of the skeletal mesh, which runs the animation Blueprint.
+  if (SkeletalMesh && IsPlayingMontage(SkeletalMesh)) return false;
+  // Physics interaction applies forces to the components the pawn collides with or stands on.
+  if (bEnablePhysicsInteraction) return false;
+#if ALLOW_CONSOLE && !NO_LOGGING
+  // On-screen debug messages can only be added on the game thread.
+  if (GMCCVars::StatOrganicMovementValues != 0) return false;
+#endif
+  return true;
+}
+
+bool UGenOrganicMovementComponent::IsPawnStateUnchanged() const
+{
+  // The pawn may still have been moved after the move execution (e.g. when the server accepts the client location).
+  return bIdleSleptThroughMove && MatchesIdleSleepSnapshot(IdleSleepSnapshot);
+}
+
+bool UGenOrganicMovementComponent::SubmitAsyncBotQueries()
+{
+  if (IsIdleSleeping()) return false;
+  return Super::SubmitAsyncBotQueries();
+}
+
+void UGenOrganicMovementComponent::WakeOnOverlap(
+  UPrimitiveComponent* OverlappedComponent,
+  AActor* OtherActor,
+  UPrimitiveComponent* OtherComponent,
+  int32 OtherBodyIndex,
+  bool bFromSweep,
+  const FHitResult& SweepResult
+)
+{
+  bIdleSleepWakeRequested = true;
+}
+
+bool UGenOrganicMovementComponent::TickIdleSleep()
+{
+  if (!IsIdleSleepEnabled())
+  {
+    bIsIdleSleeping = false;
+    bIdleSleptThroughMove = false;
+    IdleTicksAtRest = 0;
+    return false;
+  }
+
+  // Replays must always execute the full movement logic since the pawn state was reset to an earlier move.
+  bIdleSleepUndisturbed = !bIdleSleepWakeRequested && !IsReplaying() && MatchesIdleSleepSnapshot(IdleSleepSnapshot) && CanIdleSleep();
+  bIdleSleepWakeRequested = false;
+  if (bIsIdleSleeping && !bIdleSleepUndisturbed)
+  {
+    bIsIdleSleeping = false;
+    IdleTicksAtRest = 0;
+  }
+
+  const bool bSleeps = bIsIdleSleeping;
+  bIdleSleptThroughMove = (GetIterationNumber() <= 1 || bIdleSleptThroughMove) && bSleeps;
+  if (!bSleeps)
+  {
+    return false;
+  }
+
+  // The only per-tick state of the movement update that must be maintained while sleeping.
+  if (IsAutonomousProxy()) Client_bDoNotCombineNextMove = false;
+
+  INC_DWORD_STAT(STAT_IdleSleptTicks)
+#if STATS
+  INC_FLOAT_STAT_BY(STAT_IdleSleepSavedTime, AverageAwakeUpdateTime)
+  if (IdleSleepStatFrame != GFrameCounter)
+  {
+    IdleSleepStatFrame = GFrameCounter;
+    INC_DWORD_STAT(STAT_IdleSleepingPawns)
+  }
+#endif
+  return true;
+}
+
+void UGenOrganicMovementComponent::UpdateIdleSleepAfterMovement()
+{
+  // The pawn is at rest if neither an external change nor the movement update itself has modified it.
+  const bool bAtRest = bIdleSleepUndisturbed && MatchesIdleSleepSnapshot(IdleSleepSnapshot) && CanIdleSleep();
+  IdleTicksAtRest = bAtRest ? IdleTicksAtRest + 1 : 0;
+  TakeIdleSleepSnapshot(IdleSleepSnapshot);
+  if (IdleTicksAtRest >= FMath::Max(IdleSleepTicks, 1))
+  {
+    bIsIdleSleeping = true;
+  }
+}
+
+void UGenOrganicMovementComponent::TakeIdleSleepSnapshot(FIdleSleepSnapshot& OutSnapshot) const
+{
+  OutSnapshot.Location = UpdatedComponent->GetComponentLocation();
+  OutSnapshot.Rotation = UpdatedComponent->GetComponentQuat();
+  OutSnapshot.ControlRotation = PawnOwner->GetControlRotation();
+  OutSnapshot.RootCollisionExtent = Super::GetRootCollisionExtent();
+  OutSnapshot.RootCollisionShape = CurrentRootCollisionShape;
+  OutSnapshot.MovementMode = MovementMode;
+  const auto MovementBase = GetMovementBase();
+  OutSnapshot.MovementBase = MovementBase;
+  OutSnapshot.MovementBaseTransform = MovementBase ? MovementBase->GetComponentTransform() : FTransform::Identity;
+}
+
+bool UGenOrganicMovementComponent::MatchesIdleSleepSnapshot(const FIdleSleepSnapshot& Snapshot) const
+{
+  if (
+    Snapshot.MovementMode != MovementMode
+    || Snapshot.RootCollisionShape != CurrentRootCollisionShape
+    || Snapshot.Location != UpdatedComponent->GetComponentLocation()
+    || Snapshot.Rotation != UpdatedComponent->GetComponentQuat()
+    || Snapshot.ControlRotation != PawnOwner->GetControlRotation()
+    || Snapshot.RootCollisionExtent != Super::GetRootCollisionExtent()
+  )
+  {
+    return false;
+  }
+  const auto MovementBase = GetMovementBase();
+  if (Snapshot.MovementBase.Get() != MovementBase)
+  {
+    return false;
+  }
+  if (!MovementBase || MovementBase->Mobility == EComponentMobility::Static)
+  {
+    return true;
+  }
+  if (!MovementBase->IsCollisionEnabled())
+  {
+    return false;
+  }
+  return MovementBase->GetComponentTransform().Equals(Snapshot.MovementBaseTransform, 0.f);
+}
+
 void UGenOrganicMovementComponent::RootCollisionTouched(
   UPrimitiveComponent* OverlappedComponent,
   AActor* OtherActor,
@@ -3055,7 +3299,7 @@ void UGenOrganicMovementComponent::CalculateAnimRootMotionVelocity(float DeltaSe
   RootMotionDelta.Z = FMath::IsNearlyEqual(RootMotionDelta.Z, 0.f, 0.01f) ? 0.f : RootMotionDelta.Z;
 
   FVector RootMotionVelocity = RootMotionDelta / DeltaSeconds;
-  UpdateVelocity(PostProcessAnimRootMotionVelocity(RootMotionVelocity, DeltaSeconds));
+  UpdateVelocity(GMC_CALL_HOOK(PostProcessAnimRootMotionVelocity, RootMotionVelocity, DeltaSeconds));
 }
 
 FVector UGenOrganicMovementComponent::PostProcessAnimRootMotionVelocity_Implementation(
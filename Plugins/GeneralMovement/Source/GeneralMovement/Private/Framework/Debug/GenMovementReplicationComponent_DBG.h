@@ -49,7 +49,7 @@
     DEBUG_PRINT_MSG(0, "");\
     DEBUG_PRINT_MSG(0, "bUsingExtrapolatedData: %s", bUsingExtrapolatedData ? TEXT("true") : TEXT("false"));\
     DEBUG_PRINT_MSG(0, "StateQueue.Size: %d", StateQueue.Num());\
-    DEBUG_PRINT_MSG(0, "PendingMoves.Size: %d", Client_PendingMoves.Num());\
+    DEBUG_PRINT_MSG(0, "PendingMoves.Size: %d", Client_NumPendingMoves);\
     DEBUG_PRINT_MSG(0, "MoveQueue.Size: %d", Client_MoveQueue.Num());\
     DEBUG_PRINT_MSG(0, "WorldTimeSeconds: %f", GetTime());\
     DEBUG_PRINT_MSG(0, "OwnerNetRole: %s", *DebugGetNetRoleAsString(PawnOwner->GetLocalRole()));\
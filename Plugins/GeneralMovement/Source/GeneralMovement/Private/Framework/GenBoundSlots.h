@@ -0,0 +1,427 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+
+// Per-slot serialization settings and statistics of a bound variable.
+struct FGenBoundSlotInfo
+{
+  // The value range of a quantized slot. Values outside of the range are clamped before they are sent.
+  double Min{0.};
+  double Max{0.};
+
+  // The number of bits per value (per component for vectors). Zero if the slot uses the default serialization of its type.
+  uint8 NumBits{0};
+
+  // The number of bits written for this slot (including the change flag) since the value was last reset. Only counted on the server.
+  uint64 NumBitsSent{0};
+
+  bool IsQuantized() const { return NumBits > 0; }
+
+  uint32 GetMaxStep() const { return (1u << NumBits) - 1; }
+
+  uint32 EncodeFloat(float Value) const
+  {
+    const double Alpha = (FMath::Clamp<double>(Value, Min, Max) - Min) / (Max - Min);
+    return static_cast<uint32>(FMath::RoundToDouble(Alpha * GetMaxStep()));
+  }
+
+  float DecodeFloat(uint32 Step) const
+  {
+    return static_cast<float>(Min + (Max - Min) * Step / GetMaxStep());
+  }
+
+  void SerializeFloat(float& Value, FArchive& Ar) const
+  {
+    uint32 Step = Ar.IsSaving() ? EncodeFloat(Value) : 0;
+    Ar.SerializeInt(Step, GetMaxStep() + 1);
+    if (Ar.IsLoading()) Value = DecodeFloat(Step);
+  }
+};
+
+// Comparison and serialization of the values of a bound data type. Types that can be serialized with a declared value range specialize
+// this template (@see FGenBoundSlotInfo).
+template<typename T>
+struct TGenBoundSlotCodec
+{
+  static constexpr bool bSupportsQuantization = false;
+  static constexpr uint8 MaxQuantizationBits = 0;
+  static bool IsEqual(const T& A, const T& B) { return A == B; }
+  static void Serialize(T& Value, FArchive& Ar) { Ar << Value; }
+  static T Quantize(const T& Value, const FGenBoundSlotInfo& Info) { return Value; }
+  static void SerializeQuantized(T& Value, const FGenBoundSlotInfo& Info, FArchive& Ar) { Serialize(Value, Ar); }
+};
+
+template<>
+struct TGenBoundSlotCodec<float>
+{
+  // Limited by the precision of the float mantissa.
+  static constexpr bool bSupportsQuantization = true;
+  static constexpr uint8 MaxQuantizationBits = 24;
+  static bool IsEqual(float A, float B) { return A == B; }
+  static void Serialize(float& Value, FArchive& Ar) { Ar << Value; }
+  static float Quantize(float Value, const FGenBoundSlotInfo& Info) { return Info.DecodeFloat(Info.EncodeFloat(Value)); }
+  static void SerializeQuantized(float& Value, const FGenBoundSlotInfo& Info, FArchive& Ar) { Info.SerializeFloat(Value, Ar); }
+};
+
+template<>
+struct TGenBoundSlotCodec<int32>
+{
+  static constexpr bool bSupportsQuantization = true;
+  static constexpr uint8 MaxQuantizationBits = 31;
+  static bool IsEqual(int32 A, int32 B) { return A == B; }
+  static void Serialize(int32& Value, FArchive& Ar) { Ar << Value; }
+  static int32 Quantize(int32 Value, const FGenBoundSlotInfo& Info)
+  {
+    return FMath::Clamp(Value, static_cast<int32>(Info.Min), static_cast<int32>(Info.Max));
+  }
+  static void SerializeQuantized(int32& Value, const FGenBoundSlotInfo& Info, FArchive& Ar)
+  {
+    const int32 Min = static_cast<int32>(Info.Min);
+    uint32 Step = Ar.IsSaving() ? static_cast<uint32>(Quantize(Value, Info) - Min) : 0;
+    Ar.SerializeInt(Step, static_cast<uint32>(static_cast<int32>(Info.Max) - Min) + 1);
+    if (Ar.IsLoading()) Value = Min + static_cast<int32>(Step);
+  }
+};
+
+template<>
+struct TGenBoundSlotCodec<FVector>
+{
+  // The default serialization rounds vectors to 2 decimal places.
+  static constexpr bool bSupportsQuantization = true;
+  static constexpr uint8 MaxQuantizationBits = 24;
+  static bool IsEqual(const FVector& A, const FVector& B) { return A.Equals(B, 0.01f); }
+  static void Serialize(FVector& Value, FArchive& Ar) { SerializePackedVector<100, 30>(Value, Ar); }
+  static FVector Quantize(const FVector& Value, const FGenBoundSlotInfo& Info)
+  {
+    return FVector(
+      TGenBoundSlotCodec<float>::Quantize(Value.X, Info),
+      TGenBoundSlotCodec<float>::Quantize(Value.Y, Info),
+      TGenBoundSlotCodec<float>::Quantize(Value.Z, Info)
+    );
+  }
+  static void SerializeQuantized(FVector& Value, const FGenBoundSlotInfo& Info, FArchive& Ar)
+  {
+    Info.SerializeFloat(Value.X, Ar);
+    Info.SerializeFloat(Value.Y, Ar);
+    Info.SerializeFloat(Value.Z, Ar);
+  }
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+// Typed slot table for bound data (@see PrereplicatedData.h).
+
+// Every bound data type has 16 named slots in FMove, FState and FStateReduced. The traits type maps a slot index to those members at compile
+// time (@see ADD_PREREPLICATED_TYPE_SLOT_TRAITS), and the slot table keeps a dense runtime list of the variables that are actually bound. All
+// operations iterate only the bound entries instead of testing every slot.
+// Variables are always bound to the lowest free slot, so the index of an entry in the dense list is also its slot index.
+// Slots of types with a specialized codec can declare a value range and bit count, in which case the value is quantized for serialization,
+// change detection and prediction comparisons alike (@see SetQuantization).
+// @attention The traits type must provide ValueType, MoveType, StateType, ReducedStateType, NumSlots and the member pointer tables
+// InMoveSlots, OutMoveSlots, StateSlots, ReplicateSlots, ReadNewSlots, ReducedStateSlots, NumBoundSlots and SlotInfoTable.
+template<typename TraitsType>
+class TGenBoundSlots
+{
+public:
+
+  using ValueType = typename TraitsType::ValueType;
+  using MoveType = typename TraitsType::MoveType;
+  using StateType = typename TraitsType::StateType;
+  using ReducedStateType = typename TraitsType::ReducedStateType;
+  using CodecType = TGenBoundSlotCodec<ValueType>;
+
+  TGenBoundSlots() = default;
+
+  /// Adds a variable to the next free slot.
+  ///
+  /// @param        Variable    The variable to bind.
+  /// @returns      int32       The slot index the variable was bound to, INDEX_NONE if all slots are taken.
+  int32 Bind(ValueType& Variable)
+  {
+    if (Variables.Num() >= TraitsType::NumSlots) return INDEX_NONE;
+    SlotInfo.AddDefaulted();
+    return Variables.Add(&Variable);
+  }
+
+  /// Declares the value range of a bound slot. The number of bits is derived from the range and the requested precision.
+  ///
+  /// @param        Slot         The slot to quantize.
+  /// @param        Min          The lower bound of the value range.
+  /// @param        Max          The upper bound of the value range.
+  /// @param        Precision    The largest acceptable difference between the sent and the received value.
+  /// @returns      bool         True if the slot was quantized, false if the type does not support it or the parameters are invalid.
+  bool SetQuantization(int32 Slot, double Min, double Max, double Precision)
+  {
+    if (!CodecType::bSupportsQuantization || !SlotInfo.IsValidIndex(Slot) || !(Max > Min) || !(Precision > 0.)) return false;
+    const double NumSteps = FMath::CeilToDouble((Max - Min) / Precision);
+    if (NumSteps >= static_cast<double>(1u << CodecType::MaxQuantizationBits)) return false;
+    FGenBoundSlotInfo& Info = SlotInfo[Slot];
+    Info.Min = Min;
+    Info.Max = Max;
+    Info.NumBits = static_cast<uint8>(FMath::Max(FMath::CeilLogTwo64(static_cast<uint64>(NumSteps) + 1), 1ull));
+    return true;
+  }
+
+  FORCEINLINE int32 Num() const { return Variables.Num(); }
+  FORCEINLINE bool IsEmpty() const { return Variables.Num() == 0; }
+  FORCEINLINE ValueType* GetVariable(int32 Slot) const { return Variables[Slot]; }
+  FORCEINLINE FGenBoundSlotInfo& GetSlotInfo(int32 Slot) { return SlotInfo[Slot]; }
+
+  /// The slot info is referenced by the states so it can be used during net serialization (@see TraitsType::SlotInfoTable).
+  /// @attention Only stable once all variables are bound.
+  FORCEINLINE FGenBoundSlotInfo* GetSlotInfoData() { return SlotInfo.GetData(); }
+
+  /// Returns the value as it would be received by a client, i.e. quantized if the slot has a declared range.
+  ///
+  /// @param        Slot     The slot the value belongs to.
+  /// @param        Value    The value to quantize.
+  /// @returns      ValueType    The quantized value, or the unmodified value if the slot is not quantized.
+  ValueType QuantizeValue(int32 Slot, const ValueType& Value) const
+  {
+    return SlotInfo[Slot].IsQuantized() ? CodecType::Quantize(Value, SlotInfo[Slot]) : Value;
+  }
+
+  /// Saves the bound variables to the in- or output slots of a move.
+  ///
+  /// @param        Move        The move to save to.
+  /// @param        bOutput     Whether to save to the output slots instead of the input slots.
+  /// @returns      void
+  void SaveToMove(MoveType& Move, bool bOutput) const
+  {
+    const auto& Members = bOutput ? TraitsType::OutMoveSlots : TraitsType::InMoveSlots;
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      Move.*Members[Slot] = *Variables[Slot];
+    }
+  }
+
+  /// Loads the bound variables from the in- or output slots of a move.
+  ///
+  /// @param        Move        The move to load from.
+  /// @param        bOutput     Whether to load from the output slots instead of the input slots.
+  /// @returns      void
+  void LoadFromMove(const MoveType& Move, bool bOutput) const
+  {
+    const auto& Members = bOutput ? TraitsType::OutMoveSlots : TraitsType::InMoveSlots;
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      *Variables[Slot] = Move.*Members[Slot];
+    }
+  }
+
+  /// Saves the bound variables to a state.
+  ///
+  /// @param        State    The state to save to.
+  /// @returns      void
+  void SaveToState(StateType& State) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      State.*TraitsType::StateSlots[Slot] = *Variables[Slot];
+    }
+  }
+
+  /// Loads the bound variables from a state.
+  ///
+  /// @param        State    The state to load from.
+  /// @returns      void
+  void LoadFromState(const StateType& State) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      *Variables[Slot] = State.*TraitsType::StateSlots[Slot];
+    }
+  }
+
+  /// Loads only the bound variables that are flagged for replication in the passed flags state.
+  ///
+  /// @param        State         The state to load from.
+  /// @param        FlagsState    The state that holds the replication flags.
+  /// @returns      void
+  void LoadReplicatedFromState(const StateType& State, const StateType& FlagsState) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      if (FlagsState.*TraitsType::ReplicateSlots[Slot]) *Variables[Slot] = State.*TraitsType::StateSlots[Slot];
+    }
+  }
+
+  /// Exchanges the values of the bound variables with the values saved in a state.
+  ///
+  /// @param        State    The state to swap with.
+  /// @returns      void
+  void SwapWithState(StateType& State) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      Swap(*Variables[Slot], State.*TraitsType::StateSlots[Slot]);
+    }
+  }
+
+  /// Loads the bound variables for a replay. Replicated values are taken from the server state, all others from the output of the source
+  /// move.
+  ///
+  /// @param        ServerState    The received server state.
+  /// @param        SourceMove     The move the server state corresponds to.
+  /// @returns      void
+  void LoadForReplay(const StateType& ServerState, const MoveType& SourceMove) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      *Variables[Slot] = ServerState.*TraitsType::ReplicateSlots[Slot]
+        ? ServerState.*TraitsType::StateSlots[Slot]
+        : SourceMove.*TraitsType::OutMoveSlots[Slot];
+    }
+  }
+
+  /// Compares the output slots of two moves for all bound variables. Quantized slots are compared at the precision they are replicated with.
+  ///
+  /// @param        MoveA        The first move.
+  /// @param        MoveB        The second move.
+  /// @param        IsEqual      Callable that compares two values of the bound type.
+  /// @returns      bool         True if all bound outputs are equal, false otherwise.
+  template<typename PredicateType>
+  bool AreOutputsEqual(const MoveType& MoveA, const MoveType& MoveB, PredicateType IsEqual) const
+  {
+    const auto& Members = TraitsType::OutMoveSlots;
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      if (!IsEqual(QuantizeValue(Slot, MoveA.*Members[Slot]), QuantizeValue(Slot, MoveB.*Members[Slot]))) return false;
+    }
+    return true;
+  }
+
+  /// Fills in the values that were not received with the last update from the previously received state.
+  ///
+  /// @param        State                The newly received state.
+  /// @param        LastReceivedState    The previously received state.
+  /// @returns      void
+  void UnpackState(StateType& State, const StateType& LastReceivedState) const
+  {
+    for (int32 Slot = 0; Slot < Variables.Num(); ++Slot)
+    {
+      if (State.*TraitsType::ReplicateSlots[Slot] && !(State.*TraitsType::ReadNewSlots[Slot]))
+      {
+        State.*TraitsType::StateSlots[Slot] = LastReceivedState.*TraitsType::StateSlots[Slot];
+      }
+    }
+  }
+
+  // The functions below operate on a state alone (e.g. during net serialization) and use the number of bound slots saved in the state.
+
+  /// Checks whether any replicated slot of the state differs from the baseline. The baseline acts as the shadow buffer of the last values
+  /// sent to the connection, and only the bound slots are compared.
+  ///
+  /// @param        State       The state to check.
+  /// @param        Baseline    The baseline of the current target connection.
+  /// @returns      bool        True if a replicated value changed, false otherwise.
+  static bool HasStateChanged(const StateType& State, const ReducedStateType& Baseline)
+  {
+    const int32 NumBound = State.*TraitsType::NumBoundSlots;
+    for (int32 Slot = 0; Slot < NumBound; ++Slot)
+    {
+      if (!(State.*TraitsType::ReplicateSlots[Slot])) continue;
+      if (!CodecType::IsEqual(GetSentValue(State, Slot), Baseline.*TraitsType::ReducedStateSlots[Slot]))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Resets the read-new flags of all bound slots.
+  ///
+  /// @param        State    The state to modify.
+  /// @returns      void
+  static void MarkStateUnchanged(StateType& State)
+  {
+    const int32 NumBound = State.*TraitsType::NumBoundSlots;
+    for (int32 Slot = 0; Slot < NumBound; ++Slot)
+    {
+      State.*TraitsType::ReadNewSlots[Slot] = false;
+    }
+  }
+
+  /// Counts the replicated slots of the state.
+  ///
+  /// @param        State    The state to check.
+  /// @returns      int32    The number of replicated slots.
+  static int32 CountReplicated(const StateType& State)
+  {
+    const int32 NumBound = State.*TraitsType::NumBoundSlots;
+    int32 Count = 0;
+    for (int32 Slot = 0; Slot < NumBound; ++Slot)
+    {
+      Count += State.*TraitsType::ReplicateSlots[Slot] ? 1 : 0;
+    }
+    return Count;
+  }
+
+  /// Generic delta serialization of the replicated slots. Every replicated value is preceded by a change bit, changed values are serialized
+  /// with the codec of the type (quantized if the slot has a declared range) and written to the baseline as received by the client.
+  ///
+  /// @param        State                      The state to serialize.
+  /// @param        Ar                         The archive to serialize to/from.
+  /// @param        Baseline                   The baseline of the current target connection, only used when saving.
+  /// @param        bForceFullSerialization    Whether all replicated values should be sent regardless of the baseline.
+  /// @returns      void
+  static void SerializeState(StateType& State, FArchive& Ar, ReducedStateType* Baseline, bool bForceFullSerialization)
+  {
+    const int32 NumBound = State.*TraitsType::NumBoundSlots;
+    FGenBoundSlotInfo* const Infos = State.*TraitsType::SlotInfoTable;
+    if (Ar.IsSaving())
+    {
+      check(Baseline)
+      for (int32 Slot = 0; Slot < NumBound; ++Slot)
+      {
+        if (!(State.*TraitsType::ReplicateSlots[Slot])) continue;
+        const int64 StartBits = static_cast<FBitWriter&>(Ar).GetNumBits();
+        ValueType& Value = State.*TraitsType::StateSlots[Slot];
+        ValueType& BaselineValue = Baseline->*TraitsType::ReducedStateSlots[Slot];
+        const ValueType SentValue = GetSentValue(State, Slot);
+        uint8 B = bForceFullSerialization || !CodecType::IsEqual(SentValue, BaselineValue);
+        Ar.SerializeBits(&B, 1);
+        if (B)
+        {
+          if (Infos && Infos[Slot].IsQuantized()) CodecType::SerializeQuantized(Value, Infos[Slot], Ar);
+          else CodecType::Serialize(Value, Ar);
+          BaselineValue = SentValue;
+        }
+        if (Infos) Infos[Slot].NumBitsSent += static_cast<FBitWriter&>(Ar).GetNumBits() - StartBits;
+      }
+    }
+    else if (Ar.IsLoading())
+    {
+      for (int32 Slot = 0; Slot < NumBound; ++Slot)
+      {
+        if (!(State.*TraitsType::ReplicateSlots[Slot])) continue;
+        uint8 B = 0;
+        Ar.SerializeBits(&B, 1);
+        if (B)
+        {
+          ValueType& Value = State.*TraitsType::StateSlots[Slot];
+          if (Infos && Infos[Slot].IsQuantized()) CodecType::SerializeQuantized(Value, Infos[Slot], Ar);
+          else CodecType::Serialize(Value, Ar);
+        }
+        State.*TraitsType::ReadNewSlots[Slot] = B != 0;
+      }
+    }
+  }
+
+private:
+
+  /// Returns the value of a state slot as it is received by a client.
+  static ValueType GetSentValue(const StateType& State, int32 Slot)
+  {
+    const ValueType& Value = State.*TraitsType::StateSlots[Slot];
+    const FGenBoundSlotInfo* const Infos = State.*TraitsType::SlotInfoTable;
+    return Infos && Infos[Slot].IsQuantized() ? CodecType::Quantize(Value, Infos[Slot]) : Value;
+  }
+
+  /// The bound variables, the array index is the slot index.
+  TArray<ValueType*, TInlineAllocator<4>> Variables;
+
+  /// The serialization settings and statistics of the bound variables, indexed like the variables.
+  TArray<FGenBoundSlotInfo, TInlineAllocator<4>> SlotInfo;
+};
@@ -0,0 +1,426 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+
+#include "GenFloorField.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// Identifies a baked floor field file ("GMCF") and the version of its layout.
+static constexpr uint32 FLOOR_FIELD_MAGIC = 0x46434D47;
+static constexpr int32 FLOOR_FIELD_VERSION = 2;
+// Max number of overlapping floors that are baked for a single column.
+static constexpr int32 MAX_LAYERS_PER_COLUMN = 32;
+// Max number of cells that are visited during a bake (corresponds to roughly 2 km x 2 km at the default cell size).
+static constexpr int64 MAX_BAKE_CELLS = 16 * 1024 * 1024;
+// Vertical distance below a found layer at which the search for the next layer continues.
+static constexpr float LAYER_GAP = 1.f;
+// Max deviation (cm) of a trace result from the plane of a layer for the layer to be considered planar.
+static constexpr float PLANE_TOLERANCE = 0.1f;
+// Min dot product of the normals of a planar layer.
+static constexpr float PLANE_NORMAL_TOLERANCE = 0.9999f;
+// Max deviation (cm) of the radius of a query from the baked radius.
+static constexpr float RADIUS_TOLERANCE = 0.01f;
+
+FIntPoint FGenFloorField::GetCell(const FVector& Location) const
+{
+  return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+FVector2D FGenFloorField::GetCellCenter(const FIntPoint& Cell) const
+{
+  return FVector2D((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize);
+}
+
+float FGenFloorField::GetRestZ(const FLayer& Layer, const FVector2D& CellCenter, const FVector2D& Point)
+{
+  // The rest locations of a sphere on a plane form a parallel plane.
+  const FVector& N = Layer.Normal;
+  return Layer.RestZ - (N.X * (Point.X - CellCenter.X) + N.Y * (Point.Y - CellCenter.Y)) / N.Z;
+}
+
+float FGenFloorField::GetSurfaceZ(const FLayer& Layer, const FVector2D& CellCenter, const FVector2D& Point) const
+{
+  return GetRestZ(Layer, CellCenter, Point) - Radius / Layer.Normal.Z;
+}
+
+void FGenFloorField::Bake(UWorld* World, const FBakeSettings& Settings)
+{
+  check(World)
+
+  CellSize = FMath::Max(Settings.CellSize, 1.f);
+  Radius = FMath::Max(Settings.Radius, 1.f);
+  // Sphere sweeps are verified over this distance above the layers, see IsPlanarLayer.
+  ValidHeight = 2.f * Radius;
+  MinWalkableNormalZ = Settings.MinWalkableNormalZ;
+  TraceChannel = Settings.TraceChannel;
+  Columns.Reset();
+  Layers.Reset();
+  ComponentPaths.Reset();
+  Components.Reset();
+  LevelHashes.Reset();
+  for (const ULevel* Level : World->GetLevels())
+  {
+    if (Level) LevelHashes.Emplace(GetLevelName(Level), ComputeLevelHash(Level));
+  }
+
+  // Only static geometry is baked so the bounds of the static colliding components are the bounds of the field.
+  FBox Bounds(ForceInit);
+  for (TActorIterator<AActor> It(World); It; ++It)
+  {
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(*It);
+    for (const auto Primitive : Primitives)
+    {
+      if (Primitive->Mobility == EComponentMobility::Static && Primitive->IsCollisionEnabled())
+      {
+        Bounds += Primitive->Bounds.GetBox();
+      }
+    }
+  }
+  if (!Bounds.IsValid) return;
+
+  const FIntPoint MinCell = GetCell(Bounds.Min);
+  const FIntPoint MaxCell = GetCell(Bounds.Max);
+  const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+  if (NumCells > MAX_BAKE_CELLS) return;
+
+  const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
+  const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCBakeFloorField), false);
+  const float StartZ = Bounds.Max.Z + Radius + LAYER_GAP;
+  const float EndZ = Bounds.Min.Z - Radius - LAYER_GAP;
+  TMap<const UPrimitiveComponent*, int32> ComponentIndices;
+  for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+  {
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+      const FIntPoint Cell(X, Y);
+      const FVector2D CellCenter = GetCellCenter(Cell);
+      FColumn Column{Layers.Num(), 0};
+      float SweepStartZ = StartZ;
+      while (SweepStartZ > EndZ && Column.NumLayers < MAX_LAYERS_PER_COLUMN)
+      {
+        FHitResult Hit;
+        if (!World->SweepSingleByChannel(
+          Hit,
+          FVector(CellCenter, SweepStartZ),
+          FVector(CellCenter, EndZ),
+          FQuat::Identity,
+          TraceChannel,
+          Sphere,
+          QueryParams
+        ))
+        {
+          break;
+        }
+        if (Hit.bStartPenetrating)
+        {
+          // Started inside of a solid object, keep moving down until we are out of it.
+          SweepStartZ -= Radius;
+          continue;
+        }
+
+        FLayer Layer;
+        Layer.RestZ = Hit.Location.Z;
+        Layer.Normal = Hit.ImpactNormal;
+        const UPrimitiveComponent* Component = Hit.GetComponent();
+        if (Component)
+        {
+          int32& ComponentIndex = ComponentIndices.FindOrAdd(Component, INDEX_NONE);
+          if (ComponentIndex == INDEX_NONE)
+          {
+            ComponentIndex = ComponentPaths.Emplace(UWorld::RemovePIEPrefix(FSoftObjectPath(Component).ToString()));
+            Components.Emplace(const_cast<UPrimitiveComponent*>(Component));
+          }
+          Layer.ComponentIndex = ComponentIndex;
+          if (Component->Mobility == EComponentMobility::Static) Layer.Flags |= Layer_Static;
+        }
+        // A sphere resting on an edge reports a contact normal that differs from the normal of the surface.
+        const bool bHitFace = (Hit.Normal | Hit.ImpactNormal) >= PLANE_NORMAL_TOLERANCE;
+        if (bHitFace && Layer.Normal.Z >= MinWalkableNormalZ && Layer.Normal.Z > KINDA_SMALL_NUMBER)
+        {
+          Layer.Flags |= Layer_Walkable;
+          if ((Layer.Flags & Layer_Static) && IsPlanarLayer(World, Layer, CellCenter, Component))
+          {
+            Layer.Flags |= Layer_Planar;
+          }
+        }
+        Layers.Emplace(Layer);
+        ++Column.NumLayers;
+
+        // Continue the search for overlapping floors below the surface that was just found.
+        SweepStartZ = Hit.ImpactPoint.Z - Radius - LAYER_GAP;
+      }
+      if (Column.NumLayers > 0)
+      {
+        Columns.Emplace(Cell, Column);
+      }
+    }
+  }
+  Columns.Compact();
+  Layers.Shrink();
+}
+
+bool FGenFloorField::IsPlanarLayer(UWorld* World, const FLayer& Layer, const FVector2D& CellCenter, const UPrimitiveComponent* Component) const
+{
+  const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCBakeFloorField), false);
+
+  // The surface must be planar wherever a sphere within the cell can touch it, i.e. out to the radius beyond the cell bounds.
+  const float LineOffset = 0.5f * CellSize + Radius;
+  for (int32 I = -1; I <= 1; ++I)
+  {
+    for (int32 J = -1; J <= 1; ++J)
+    {
+      const FVector2D Point = CellCenter + FVector2D(I, J) * LineOffset;
+      const float SurfaceZ = GetSurfaceZ(Layer, CellCenter, Point);
+      FHitResult Hit;
+      if (!World->LineTraceSingleByChannel(
+        Hit,
+        FVector(Point, SurfaceZ + Radius),
+        FVector(Point, SurfaceZ - Radius),
+        TraceChannel,
+        QueryParams
+      ))
+      {
+        return false;
+      }
+      if (
+        Hit.bStartPenetrating
+        || Hit.GetComponent() != Component
+        || FMath::Abs(Hit.ImpactPoint.Z - SurfaceZ) > PLANE_TOLERANCE
+        || (Hit.ImpactNormal | Layer.Normal) < PLANE_NORMAL_TOLERANCE
+      )
+      {
+        return false;
+      }
+    }
+  }
+
+  // The sphere must come to rest where the plane predicts everywhere within the cell. This also rejects layers with walls, steps or other
+  // obstacles within reach of the sphere.
+  const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
+  const float SphereOffset = 0.5f * CellSize;
+  for (int32 I = -1; I <= 1; ++I)
+  {
+    for (int32 J = -1; J <= 1; ++J)
+    {
+      const FVector2D Point = CellCenter + FVector2D(I, J) * SphereOffset;
+      const float RestZ = GetRestZ(Layer, CellCenter, Point);
+      FHitResult Hit;
+      if (!World->SweepSingleByChannel(
+        Hit,
+        FVector(Point, RestZ + ValidHeight),
+        FVector(Point, RestZ - Radius),
+        FQuat::Identity,
+        TraceChannel,
+        Sphere,
+        QueryParams
+      ))
+      {
+        return false;
+      }
+      if (Hit.bStartPenetrating || Hit.GetComponent() != Component || FMath::Abs(Hit.Location.Z - RestZ) > PLANE_TOLERANCE)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool FGenFloorField::FindFloor(
+  const FVector& SphereCenter,
+  const FVector& LineStart,
+  float SphereRadius,
+  float TraceLength,
+  FFloor& OutFloor
+) const
+{
+  if (FMath::Abs(SphereRadius - Radius) > RADIUS_TOLERANCE) return false;
+  const FIntPoint Cell = GetCell(SphereCenter);
+  const FColumn* Column = Columns.Find(Cell);
+  if (!Column) return false;
+
+  const FVector2D CellCenter = GetCellCenter(Cell);
+  const FVector2D Point(SphereCenter);
+  const float MaxDistance = FMath::Min(TraceLength, ValidHeight);
+  for (int32 LayerIndex = Column->FirstLayer; LayerIndex < Column->FirstLayer + Column->NumLayers; ++LayerIndex)
+  {
+    const FLayer& Layer = Layers[LayerIndex];
+    if (!Layer.IsUsable()) continue;
+    // The volume up to the valid height above a usable layer is free of other static geometry, so if the sphere is within that range there
+    // cannot be any other layer in between.
+    const float RestZ = GetRestZ(Layer, CellCenter, Point);
+    const float Distance = SphereCenter.Z - RestZ;
+    if (Distance < 0.f || Distance > MaxDistance) continue;
+    const float LineImpactZ = GetSurfaceZ(Layer, CellCenter, Point);
+    const float LineDistance = LineStart.Z - LineImpactZ;
+    if (LineDistance < 0.f || LineDistance > TraceLength) return false;
+
+    OutFloor.RestLocation = FVector(SphereCenter.X, SphereCenter.Y, RestZ);
+    OutFloor.ImpactNormal = Layer.Normal;
+    OutFloor.ImpactPoint = OutFloor.RestLocation - Layer.Normal * Radius;
+    OutFloor.LineImpactPoint = FVector(LineStart.X, LineStart.Y, LineImpactZ);
+    OutFloor.ComponentIndex = Layer.ComponentIndex;
+    return true;
+  }
+  return false;
+}
+
+UPrimitiveComponent* FGenFloorField::GetComponent(int32 Index) const
+{
+  return Components.IsValidIndex(Index) ? Components[Index].Get() : nullptr;
+}
+
+void FGenFloorField::ResolveComponents(UWorld* World)
+{
+  check(World)
+  Components.SetNum(ComponentPaths.Num());
+  for (int32 Index = 0; Index < ComponentPaths.Num(); ++Index)
+  {
+    if (Components[Index].IsValid()) continue;
+    FSoftObjectPath Path(ComponentPaths[Index]);
+#if WITH_EDITOR
+    if (World->IsPlayInEditor())
+    {
+      Path.FixupForPIE(World->GetOutermost()->PIEInstanceID);
+    }
+#endif
+    Components[Index] = Cast<UPrimitiveComponent>(Path.ResolveObject());
+  }
+}
+
+static FIntVector RoundToCm(const FVector& Vector)
+{
+  return FIntVector(FMath::RoundToInt(Vector.X), FMath::RoundToInt(Vector.Y), FMath::RoundToInt(Vector.Z));
+}
+
+FString FGenFloorField::GetLevelName(const ULevel* Level)
+{
+  return UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName());
+}
+
+uint32 FGenFloorField::ComputeLevelHash(const ULevel* Level) const
+{
+  TArray<uint32> ComponentHashes;
+  for (const AActor* Actor : Level->Actors)
+  {
+    if (!Actor) continue;
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(Actor);
+    for (const auto Primitive : Primitives)
+    {
+      if (Primitive->Mobility != EComponentMobility::Static || !Primitive->IsCollisionEnabled()) continue;
+      // The bounds are rounded to full cm so the hash is not affected by floating point noise between the editor and a cooked build.
+      uint32 Hash = GetTypeHash(UWorld::RemovePIEPrefix(FSoftObjectPath(Primitive).ToString()));
+      Hash = HashCombine(Hash, GetTypeHash(RoundToCm(Primitive->Bounds.Origin)));
+      Hash = HashCombine(Hash, GetTypeHash(RoundToCm(Primitive->Bounds.BoxExtent)));
+      Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Primitive->GetCollisionResponseToChannel(TraceChannel))));
+      ComponentHashes.Emplace(Hash);
+    }
+  }
+  if (ComponentHashes.Num() == 0) return 0;
+  // The order of the actors is not guaranteed to be the same in the editor and a cooked build.
+  ComponentHashes.Sort();
+  return FCrc::MemCrc32(ComponentHashes.GetData(), ComponentHashes.Num() * ComponentHashes.GetTypeSize());
+}
+
+bool FGenFloorField::IsUpToDate(const ULevel* Level) const
+{
+  check(Level)
+  const uint32* BakedHash = LevelHashes.Find(GetLevelName(Level));
+  return ComputeLevelHash(Level) == (BakedHash ? *BakedHash : 0);
+}
+
+void FGenFloorField::GenerateSamples(int32 NumSamples, int32 Seed, TArray<FVector>& OutSphereCenters) const
+{
+  OutSphereCenters.Reset();
+  TArray<TPair<FIntPoint, int32>> UsableLayers;
+  for (const auto& Entry : Columns)
+  {
+    for (int32 LayerIndex = Entry.Value.FirstLayer; LayerIndex < Entry.Value.FirstLayer + Entry.Value.NumLayers; ++LayerIndex)
+    {
+      if (Layers[LayerIndex].IsUsable()) UsableLayers.Emplace(Entry.Key, LayerIndex);
+    }
+  }
+  if (UsableLayers.Num() == 0) return;
+
+  const FRandomStream RandomStream(Seed);
+  OutSphereCenters.Reserve(NumSamples);
+  for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+  {
+    const auto& Entry = UsableLayers[RandomStream.RandHelper(UsableLayers.Num())];
+    const FVector2D CellCenter = GetCellCenter(Entry.Key);
+    const FVector2D Point = CellCenter + FVector2D(RandomStream.FRandRange(-0.5f, 0.5f), RandomStream.FRandRange(-0.5f, 0.5f)) * CellSize;
+    const float RestZ = GetRestZ(Layers[Entry.Value], CellCenter, Point);
+    OutSphereCenters.Emplace(Point, RestZ + RandomStream.FRandRange(0.f, ValidHeight));
+  }
+}
+
+int32 FGenFloorField::GetNumUsableLayers() const
+{
+  int32 NumUsableLayers{0};
+  for (const auto& Layer : Layers)
+  {
+    if (Layer.IsUsable()) ++NumUsableLayers;
+  }
+  return NumUsableLayers;
+}
+
+bool FGenFloorField::Save(const FString& FileName)
+{
+  TArray<uint8> Bytes;
+  FMemoryWriter Writer(Bytes);
+  uint32 Magic = FLOOR_FIELD_MAGIC;
+  int32 Version = FLOOR_FIELD_VERSION;
+  Writer << Magic << Version << LevelHashes;
+  Writer << CellSize << Radius << ValidHeight << MinWalkableNormalZ << TraceChannel;
+  Writer << ComponentPaths << Columns << Layers;
+  return FFileHelper::SaveArrayToFile(Bytes, *FileName);
+}
+
+bool FGenFloorField::Load(const FString& FileName)
+{
+  TArray<uint8> Bytes;
+  if (!FFileHelper::LoadFileToArray(Bytes, *FileName, FILEREAD_Silent)) return false;
+  FMemoryReader Reader(Bytes);
+  uint32 Magic{0};
+  int32 Version{0};
+  Reader << Magic << Version;
+  if (Magic != FLOOR_FIELD_MAGIC || Version != FLOOR_FIELD_VERSION) return false;
+  Reader << LevelHashes;
+  Reader << CellSize << Radius << ValidHeight << MinWalkableNormalZ << TraceChannel;
+  Reader << ComponentPaths << Columns << Layers;
+  Components.Reset();
+  if (Reader.IsError() || !Reader.AtEnd() || !IsValidData())
+  {
+    Columns.Reset();
+    Layers.Reset();
+    ComponentPaths.Reset();
+    LevelHashes.Reset();
+    return false;
+  }
+  return true;
+}
+
+bool FGenFloorField::IsValidData() const
+{
+  if (CellSize <= 0.f || Radius <= 0.f || ValidHeight < 0.f) return false;
+  for (const auto& Entry : Columns)
+  {
+    const FColumn& Column = Entry.Value;
+    // Written as a subtraction so corrupt values cannot overflow.
+    if (
+      Column.FirstLayer < 0
+      || Column.NumLayers < 0
+      || Column.FirstLayer > Layers.Num() - Column.NumLayers
+    )
+    {
+      return false;
+    }
+  }
+  for (const auto& Layer : Layers)
+  {
+    if (Layer.ComponentIndex != INDEX_NONE && !ComponentPaths.IsValidIndex(Layer.ComponentIndex)) return false;
+    // The rest location on a usable layer is computed by dividing by the Z-component of its normal (same condition as in Bake).
+    if (Layer.IsUsable() && (Layer.Normal.Z < MinWalkableNormalZ || Layer.Normal.Z <= KINDA_SMALL_NUMBER)) return false;
+  }
+  return true;
+}
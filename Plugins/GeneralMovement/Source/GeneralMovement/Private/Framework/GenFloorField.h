@@ -0,0 +1,189 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+#pragma once
+
+#include "GMC_PCH.h"
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+// Baked walkable-surface field of the static geometry of a world.
+
+// The field is a sparse grid of columns in the XY-plane. Every column stores the surfaces found by sweeping a sphere of the baked radius
+// from the top of the world down through the cell center (multiple layers for overlapping floors, sorted from top to bottom). A layer is
+// only usable for floor queries if it is:
+// - static: the hit component has static mobility (it cannot move, so the baked data cannot become stale at runtime),
+// - walkable: the surface normal is not steeper than the baked walkable floor Z,
+// - planar: line traces around the cell (out to the baked radius beyond its bounds) all hit the same plane, and sphere sweeps at the cell
+//   corners and edges come to rest where the plane predicts, i.e. there are no steps, ledges, walls or other obstacles in reach.
+// For a usable layer the rest location of the sphere and the line trace impact can be computed analytically for any point within the cell,
+// which replaces the shape sweep and the line trace of a floor query. Everything else is answered with "unknown" so the caller falls back to
+// querying the physics scene.
+// @attention Dynamic objects are not part of the field. The caller must make sure that the volume between the pawn and the floor is free of
+// them (@see UGenWorldSubsystem::FindFloorInField).
+// The field stores a hash of the static colliding geometry of every level it was baked for. A level whose geometry changed after the bake
+// makes the field stale (@see IsUpToDate) and the field must not be used anymore.
+class FGenFloorField
+{
+public:
+
+  struct FBakeSettings
+  {
+    /// The edge length of a grid cell in cm.
+    float CellSize{50.f};
+    /// The radius of the sphere the field is baked for. Only pawns with this collision radius can use the field.
+    float Radius{34.f};
+    /// The min Z-component of the normal of a walkable surface.
+    float MinWalkableNormalZ{0.71f};
+    /// The collision channel of the traces.
+    TEnumAsByte<ECollisionChannel> TraceChannel{ECC_Pawn};
+  };
+
+  struct FFloor
+  {
+    /// The location of the center of the sphere when it comes to rest on the floor.
+    FVector RestLocation{0};
+    /// The point at which the sphere touches the floor.
+    FVector ImpactPoint{0};
+    /// The normal of the floor.
+    FVector ImpactNormal{0};
+    /// The impact point of the line trace.
+    FVector LineImpactPoint{0};
+    /// Index of the floor component (@see GetComponent).
+    int32 ComponentIndex{INDEX_NONE};
+  };
+
+  /// Bakes the field for the static geometry of the passed world. Replaces the current data.
+  ///
+  /// @param        World       The world to bake the field for.
+  /// @param        Settings    The bake settings.
+  /// @returns      void
+  void Bake(UWorld* World, const FBakeSettings& Settings);
+
+  /// Answers a downward floor query of a sphere and a line trace from the field.
+  ///
+  /// @param        SphereCenter    The center of the sphere to sweep down.
+  /// @param        LineStart       The start of the line trace, must have the same XY-coordinates as the sphere.
+  /// @param        SphereRadius    The radius of the sphere. Must match the baked radius.
+  /// @param        TraceLength     The length of both traces.
+  /// @param        OutFloor        The floor below the sphere. Only valid if the function returned true.
+  /// @returns      bool            True if the query could be answered from the field, false if the physics scene must be queried instead.
+  bool FindFloor(const FVector& SphereCenter, const FVector& LineStart, float SphereRadius, float TraceLength, FFloor& OutFloor) const;
+
+  /// Returns the floor component with the passed index if it is currently loaded.
+  ///
+  /// @param        Index                   The component index of a floor.
+  /// @returns      UPrimitiveComponent*    The component or nullptr if it is not loaded.
+  UPrimitiveComponent* GetComponent(int32 Index) const;
+
+  /// Resolves the references to the floor components that are not loaded yet. Should be called whenever a level was added to the world.
+  ///
+  /// @param        World    The world the field belongs to.
+  /// @returns      void
+  void ResolveComponents(UWorld* World);
+
+  /// Checks whether the static colliding geometry of the passed level is still the same as when the field was baked. Levels that were not
+  /// loaded during the bake are only up to date if they do not contain any static colliding geometry.
+  ///
+  /// @param        Level    The level to check, must be part of the world the field belongs to.
+  /// @returns      bool     True if the field is valid for the level, false if the field is stale and must be rebaked.
+  bool IsUpToDate(const ULevel* Level) const;
+
+  /// Generates random query locations above the usable layers of the field (for validation and benchmarking).
+  ///
+  /// @param        NumSamples             The number of locations to generate.
+  /// @param        Seed                   The seed of the random stream.
+  /// @param        OutSphereCenters       The generated sphere centers. Empty if the field has no usable layers.
+  /// @returns      void
+  void GenerateSamples(int32 NumSamples, int32 Seed, TArray<FVector>& OutSphereCenters) const;
+
+  /// Writes the field to a file / replaces the field with the contents of a file. The components must be resolved after loading. Loading
+  /// fails if the file is corrupt or was written by a different version, staleness must be checked separately (@see IsUpToDate).
+  bool Save(const FString& FileName);
+  bool Load(const FString& FileName);
+
+  bool IsEmpty() const { return Columns.Num() == 0; }
+  int32 GetNumColumns() const { return Columns.Num(); }
+  int32 GetNumLayers() const { return Layers.Num(); }
+  int32 GetNumUsableLayers() const;
+  float GetRadius() const { return Radius; }
+  /// The max distance between the sphere and the floor for which the field answers queries.
+  float GetValidHeight() const { return ValidHeight; }
+  ECollisionChannel GetTraceChannel() const { return TraceChannel; }
+
+private:
+
+  enum ELayerFlags : uint8
+  {
+    Layer_Static = 1 << 0,
+    Layer_Walkable = 1 << 1,
+    Layer_Planar = 1 << 2,
+    Layer_Usable = Layer_Static | Layer_Walkable | Layer_Planar,
+  };
+
+  struct FLayer
+  {
+    /// Z-coordinate of the rest location of the sphere above the cell center.
+    float RestZ{0.f};
+    /// The surface normal.
+    FVector Normal{0};
+    int32 ComponentIndex{INDEX_NONE};
+    uint8 Flags{0};
+
+    bool IsUsable() const { return (Flags & Layer_Usable) == Layer_Usable; }
+
+    friend FArchive& operator<<(FArchive& Ar, FLayer& Layer)
+    {
+      return Ar << Layer.RestZ << Layer.Normal << Layer.ComponentIndex << Layer.Flags;
+    }
+  };
+
+  struct FColumn
+  {
+    int32 FirstLayer{0};
+    int32 NumLayers{0};
+
+    friend FArchive& operator<<(FArchive& Ar, FColumn& Column)
+    {
+      return Ar << Column.FirstLayer << Column.NumLayers;
+    }
+  };
+
+  float CellSize{50.f};
+  float Radius{34.f};
+  float ValidHeight{68.f};
+  float MinWalkableNormalZ{0.71f};
+  TEnumAsByte<ECollisionChannel> TraceChannel{ECC_Pawn};
+
+  /// The columns of all cells that contain at least one layer.
+  TMap<FIntPoint, FColumn> Columns;
+
+  /// The layers of all columns.
+  TArray<FLayer> Layers;
+
+  /// Paths of the floor components (without PIE prefix) and the resolved components.
+  TArray<FString> ComponentPaths;
+  TArray<TWeakObjectPtr<UPrimitiveComponent>> Components;
+
+  /// Hashes of the static colliding geometry of the levels that were loaded during the bake, keyed by level package name (without PIE
+  /// prefix).
+  TMap<FString, uint32> LevelHashes;
+
+  FIntPoint GetCell(const FVector& Location) const;
+  FVector2D GetCellCenter(const FIntPoint& Cell) const;
+
+  /// The Z-coordinate of the rest location of the sphere on the (planar) layer at the passed point.
+  static float GetRestZ(const FLayer& Layer, const FVector2D& CellCenter, const FVector2D& Point);
+
+  /// The Z-coordinate of the surface of the (planar) layer at the passed point.
+  float GetSurfaceZ(const FLayer& Layer, const FVector2D& CellCenter, const FVector2D& Point) const;
+
+  /// The package name of the level without PIE prefix.
+  static FString GetLevelName(const ULevel* Level);
+
+  /// Hashes the paths, bounds and collision responses of the static colliding components of the level.
+  uint32 ComputeLevelHash(const ULevel* Level) const;
+
+  /// Checks whether the loaded data is consistent, i.e. all indices are in range and all usable layers can be evaluated.
+  bool IsValidData() const;
+
+  /// Checks whether the layer is a plane that covers the entire reach of a sphere anywhere within the cell without any obstacles.
+  bool IsPlanarLayer(UWorld* World, const FLayer& Layer, const FVector2D& CellCenter, const UPrimitiveComponent* Component) const;
+};
@@ -0,0 +1,197 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+// Fixed-capacity circular buffer for timestamped history data (states, moves).
+
+// Elements are addressed with logical indices where 0 is always the oldest and Num() - 1 always the newest entry, so code that was written
+// against an append-only TArray keeps working unchanged. Adding an element to a full buffer overwrites the oldest entry in place instead of
+// shifting the remaining ones, which keeps the heap allocations of the stored elements (e.g. TMaps) alive and makes eviction O(1).
+// @attention The element type must have a public float member "Timestamp" if any of the search functions are used, and elements must be
+// added in non-decreasing timestamp order for the search results to be valid.
+template<typename ElementType>
+class TGenRingBuffer
+{
+public:
+
+  TGenRingBuffer() = default;
+
+  /// Empties the buffer and sets a new capacity. Already constructed elements are kept in storage so they can be reused.
+  ///
+  /// @param        NewCapacity    The max number of elements the buffer can hold.
+  /// @returns      void
+  void Reset(int32 NewCapacity)
+  {
+    check(NewCapacity >= 0)
+    Storage.SetNum(NewCapacity, false/*don't shrink*/);
+    Capacity = NewCapacity;
+    Head = 0;
+    Count = 0;
+  }
+
+  /// Empties the buffer without changing the capacity.
+  ///
+  /// @returns      void
+  void Empty()
+  {
+    Head = 0;
+    Count = 0;
+  }
+
+  /// Changes the capacity while preserving the newest elements (the oldest ones are discarded if they don't fit anymore).
+  ///
+  /// @param        NewCapacity    The max number of elements the buffer can hold.
+  /// @returns      void
+  void SetCapacity(int32 NewCapacity)
+  {
+    check(NewCapacity >= 0)
+    if (NewCapacity == Capacity) return;
+    const int32 NumToKeep = FMath::Min(Count, NewCapacity);
+    TArray<ElementType> NewStorage;
+    NewStorage.SetNum(NewCapacity);
+    for (int32 Index = 0; Index < NumToKeep; ++Index)
+    {
+      NewStorage[Index] = MoveTemp((*this)[Count - NumToKeep + Index]);
+    }
+    Storage = MoveTemp(NewStorage);
+    Capacity = NewCapacity;
+    Head = 0;
+    Count = NumToKeep;
+  }
+
+  /// Appends a copy of the passed element as the newest entry. If the buffer is full the oldest entry is overwritten.
+  ///
+  /// @param        Element         The element to add.
+  /// @returns      ElementType&    Reference to the added element.
+  ElementType& Add(const ElementType& Element)
+  {
+    ElementType& Slot = AddUninitialized();
+    Slot = Element;
+    return Slot;
+  }
+
+  /// Makes room for a new newest entry without assigning it. If the buffer is full the oldest entry is evicted. The returned slot still
+  /// holds whatever element was stored there before, which allows callers to reuse its allocations.
+  ///
+  /// @returns      ElementType&    Reference to the slot of the new newest element.
+  ElementType& AddUninitialized()
+  {
+    checkf(Capacity > 0, TEXT("Cannot add to a ring buffer with zero capacity."))
+    if (Count == Capacity)
+    {
+      Head = WrapIndex(Head + 1);
+    }
+    else
+    {
+      ++Count;
+    }
+    return Storage[WrapIndex(Head + Count - 1)];
+  }
+
+  /// Removes the given number of elements from the front (oldest end) of the buffer. This only advances the head index.
+  ///
+  /// @param        NumToRemove    How many of the oldest elements to remove. Clamped to the current number of elements.
+  /// @returns      void
+  void RemoveFront(int32 NumToRemove = 1)
+  {
+    NumToRemove = FMath::Clamp(NumToRemove, 0, Count);
+    Head = Count == NumToRemove ? 0 : WrapIndex(Head + NumToRemove);
+    Count -= NumToRemove;
+  }
+
+  /// Removes the given number of elements from the back (newest end) of the buffer.
+  ///
+  /// @param        NumToRemove    How many of the newest elements to remove. Clamped to the current number of elements.
+  /// @returns      void
+  void RemoveBack(int32 NumToRemove = 1)
+  {
+    Count -= FMath::Clamp(NumToRemove, 0, Count);
+    if (Count == 0) Head = 0;
+  }
+
+  FORCEINLINE int32 Num() const { return Count; }
+  FORCEINLINE int32 Max() const { return Capacity; }
+  FORCEINLINE bool IsEmpty() const { return Count == 0; }
+  FORCEINLINE bool IsFull() const { return Count == Capacity; }
+  FORCEINLINE bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Count; }
+
+  /// Returns the number of bytes allocated by the buffer itself (not including heap allocations owned by the stored elements).
+  FORCEINLINE SIZE_T GetAllocatedSize() const { return Storage.GetAllocatedSize(); }
+
+  FORCEINLINE ElementType& operator[](int32 Index)
+  {
+    checkSlow(IsValidIndex(Index))
+    return Storage[WrapIndex(Head + Index)];
+  }
+
+  FORCEINLINE const ElementType& operator[](int32 Index) const
+  {
+    checkSlow(IsValidIndex(Index))
+    return Storage[WrapIndex(Head + Index)];
+  }
+
+  FORCEINLINE ElementType& Last(int32 IndexFromTheEnd = 0) { return (*this)[Count - 1 - IndexFromTheEnd]; }
+  FORCEINLINE const ElementType& Last(int32 IndexFromTheEnd = 0) const { return (*this)[Count - 1 - IndexFromTheEnd]; }
+  FORCEINLINE ElementType& First() { return (*this)[0]; }
+  FORCEINLINE const ElementType& First() const { return (*this)[0]; }
+
+  /// Binary search for the first element with a timestamp greater than the passed time within the logical index range [0, EndIndex).
+  ///
+  /// @param        Time        The time to search for.
+  /// @param        EndIndex    Exclusive upper bound of the searched range. Uses the entire buffer if negative.
+  /// @returns      int32       The logical index of the found element, or EndIndex if no element in the range is newer than the passed time.
+  int32 UpperBound(float Time, int32 EndIndex = -1) const
+  {
+    int32 Low = 0;
+    int32 High = EndIndex < 0 ? Count : FMath::Min(EndIndex, Count);
+    while (Low < High)
+    {
+      const int32 Mid = Low + (High - Low) / 2;
+      if ((*this)[Mid].Timestamp <= Time)
+      {
+        Low = Mid + 1;
+      }
+      else
+      {
+        High = Mid;
+      }
+    }
+    return Low;
+  }
+
+  /// Binary search for the two entries that enclose the passed time. The start index is the newest entry with a timestamp smaller than or
+  /// equal to the passed time, the target index is the entry immediately after it.
+  ///
+  /// @param        Time                The time to search for.
+  /// @param        OutStartIndex       The logical index of the start entry, INDEX_NONE if all entries are newer than the passed time.
+  /// @param        OutTargetIndex      The logical index of the target entry, INDEX_NONE if no entry is newer than the start entry.
+  /// @returns      bool                True if both a start and a target entry were found, false otherwise.
+  bool FindBracketingStates(float Time, int32& OutStartIndex, int32& OutTargetIndex) const
+  {
+    const int32 FirstNewer = UpperBound(Time);
+    OutStartIndex = FirstNewer - 1 >= 0 ? FirstNewer - 1 : INDEX_NONE;
+    OutTargetIndex = OutStartIndex != INDEX_NONE && FirstNewer < Count ? FirstNewer : INDEX_NONE;
+    return OutStartIndex != INDEX_NONE && OutTargetIndex != INDEX_NONE;
+  }
+
+private:
+
+  FORCEINLINE int32 WrapIndex(int32 Index) const
+  {
+    return Index >= Capacity ? Index - Capacity : Index;
+  }
+
+  /// Backing storage, always has exactly "Capacity" constructed elements.
+  TArray<ElementType> Storage;
+
+  /// Physical index of the oldest element.
+  int32 Head{0};
+
+  /// Number of valid elements.
+  int32 Count{0};
+
+  /// Max number of elements.
+  int32 Capacity{0};
+};
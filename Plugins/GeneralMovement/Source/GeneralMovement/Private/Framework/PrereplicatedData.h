@@ -12,6 +12,8 @@
 // (@see IsBoundDataValid_IMPLEMENTATION, @see SerializeBoundData_IMPLEMENTATION).
 // @attention You can add user-defined UENUM classes (not un-scoped or non-reflected enums) but the definition should be placed within the
 // GenMovementReplicationComponent header, otherwise the UHT will might get confused (it is not advisable to include child class headers).
+// @attention Newly added types must also be listed in DEFINE_PREREPLICATED_DATA_SLOT_TRAITS so the generated functions can iterate only the
+// bound slots of the type (@see TGenBoundSlots).
 
 // Adds data members to FMove. Added types must support the == and != operators.
 #define DEFINE_PREREPLICATED_DATA_FMOVE()\
@@ -55,6 +57,20 @@
   ADD_PREREPLICATED_TYPE_TO_REDUCED_STATE(UActorComponent*, ActorComponentReference)\
   ADD_PREREPLICATED_TYPE_TO_REDUCED_STATE(UAnimMontage*,    AnimMontageReference)
 
+// Defines the compile-time slot tables of the bound data types (@see TGenBoundSlots). Must list the same types as the definitions above.
+#define DEFINE_PREREPLICATED_DATA_SLOT_TRAITS()\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(bool,             Bool)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(uint8,            HalfByte)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(uint8,            Byte)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(int32,            Int)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(float,            Float)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(FVector,          Vector)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(FVector,          Normal)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(FRotator,         Rotator)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(AActor*,          ActorReference)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(UActorComponent*, ActorComponentReference)\
+  ADD_PREREPLICATED_TYPE_SLOT_TRAITS(UAnimMontage*,    AnimMontageReference)
+
 // Implements the required functions and references within UGenMovementReplicationComponent for replication of the added data members.
 #define IMPLEMENT_REPLICATION_SYSTEM()\
   ADD_REPLICATION_LOGIC(bool,             Bool)\
@@ -97,6 +113,20 @@
   CALL_ForceNetUpdateCheckBoundData(ActorComponentReference)\
   CALL_ForceNetUpdateCheckBoundData(AnimMontageReference)
 
+// Implements the checks for capturing the server state immediately when a data member that forces net updates changed.
+#define CaptureCheckBoundData_IMPLEMENTATION()\
+  CALL_CaptureCheckBoundData(Bool)\
+  CALL_CaptureCheckBoundData(HalfByte)\
+  CALL_CaptureCheckBoundData(Byte)\
+  CALL_CaptureCheckBoundData(Int)\
+  CALL_CaptureCheckBoundData(Float)\
+  CALL_CaptureCheckBoundData(Vector)\
+  CALL_CaptureCheckBoundData(Normal)\
+  CALL_CaptureCheckBoundData(Rotator)\
+  CALL_CaptureCheckBoundData(ActorReference)\
+  CALL_CaptureCheckBoundData(ActorComponentReference)\
+  CALL_CaptureCheckBoundData(AnimMontageReference)
+
 // Saves the data members into the server state for replication to the client.
 #define SaveBoundDataToServerState_IMPLEMENTATION()\
   CALL_SaveBoundDataToServerState(Bool)\
@@ -211,6 +241,21 @@
   CALL_LoadInBoundDataFromMove(ActorComponentReference)\
   CALL_LoadInBoundDataFromMove(AnimMontageReference)
 
+// Loads the output data members from a move. This is used when a client replay is cut short and the pawn state is set to the originally
+// predicted output of the newest move (@see UGenMovementReplicationComponent::bAllowPartialReplay).
+#define LoadOutBoundDataFromMove_IMPLEMENTATION()\
+  CALL_LoadOutBoundDataFromMove(Bool)\
+  CALL_LoadOutBoundDataFromMove(HalfByte)\
+  CALL_LoadOutBoundDataFromMove(Byte)\
+  CALL_LoadOutBoundDataFromMove(Int)\
+  CALL_LoadOutBoundDataFromMove(Float)\
+  CALL_LoadOutBoundDataFromMove(Vector)\
+  CALL_LoadOutBoundDataFromMove(Normal)\
+  CALL_LoadOutBoundDataFromMove(Rotator)\
+  CALL_LoadOutBoundDataFromMove(ActorReference)\
+  CALL_LoadOutBoundDataFromMove(ActorComponentReference)\
+  CALL_LoadOutBoundDataFromMove(AnimMontageReference)
+
 // Loads bound data members from a state.
 #define LoadBoundDataFromState_IMPLEMENTATION()\
   CALL_LoadBoundDataFromState(Bool)\
@@ -284,23 +329,96 @@
   CALL_IsBoundDataValidGeneric(ActorComponentReference)\
   CALL_IsBoundDataValidGeneric(AnimMontageReference)
 
-// Implements the net serialization for replicated data members.
+// Check if the bound data produced by a replayed move matches the bound data that was originally predicted for the same move. If it does
+// (together with the rest of the pawn state) the replay has reconverged with the original prediction and can be cut short
+// (@see UGenMovementReplicationComponent::bAllowPartialReplay). Every type added to FMove must be listed here, otherwise its values would
+// be ignored when checking for convergence.
+#define IsReplayedBoundDataConverged_IMPLEMENTATION()\
+  CALL_IsReplayedBoundDataConverged(Bool)\
+  CALL_IsReplayedBoundDataConverged(HalfByte)\
+  CALL_IsReplayedBoundDataConverged(Byte)\
+  CALL_IsReplayedBoundDataConverged(Int)\
+  CALL_IsReplayedBoundDataConverged(Float)\
+  CALL_IsReplayedBoundDataConverged(Vector)\
+  CALL_IsReplayedBoundDataConverged(Normal)\
+  CALL_IsReplayedBoundDataConverged(Rotator)\
+  CALL_IsReplayedBoundDataConverged(ActorReference)\
+  CALL_IsReplayedBoundDataConverged(ActorComponentReference)\
+  CALL_IsReplayedBoundDataConverged(AnimMontageReference)
+
+// Implements the net serialization for replicated data members that only send a change flag if the value is the same as in the last update.
 // Supports type specific implementations. Add CALL_SerializeBoundDataSpecific(Name) and provide the function
 //   void FState::Serialize##Name##Types(FArchive& Ar) { ... }
 // which must serialize the bound data to the passed archive.
+// @attention The entire group may be skipped with a single bit if nothing changed (@see FState::SerializeDirtyMask), so every type listed
+// here must also be listed in @see HasBoundDataChanged_IMPLEMENTATION and @see MarkBoundDataUnchanged_IMPLEMENTATION. Types that are always
+// serialized without a change flag must be added to @see SerializeRawBoundData_IMPLEMENTATION instead.
 #define SerializeBoundData_IMPLEMENTATION()\
-  CALL_SerializeBoundDataSpecific(Bool)\
   CALL_SerializeBoundDataSpecific(HalfByte)\
   CALL_SerializeBoundDataGeneric(Byte)\
   CALL_SerializeBoundDataGeneric(Int)\
   CALL_SerializeBoundDataGeneric(Float)\
-  CALL_SerializeBoundDataSpecific(Vector)\
+  CALL_SerializeBoundDataGeneric(Vector)\
   CALL_SerializeBoundDataSpecific(Normal)\
   CALL_SerializeBoundDataSpecific(Rotator)\
   CALL_SerializeBoundDataGeneric(ActorReference)\
   CALL_SerializeBoundDataGeneric(ActorComponentReference)\
   CALL_SerializeBoundDataGeneric(AnimMontageReference)
 
+// Logs the per-slot bit counts of all types that are serialized generically (@see TGenBoundSlots::SerializeState).
+#define LogBoundDataBits_IMPLEMENTATION()\
+  CALL_LogBoundDataBits(Byte)\
+  CALL_LogBoundDataBits(Int)\
+  CALL_LogBoundDataBits(Float)\
+  CALL_LogBoundDataBits(Vector)\
+  CALL_LogBoundDataBits(ActorReference)\
+  CALL_LogBoundDataBits(ActorComponentReference)\
+  CALL_LogBoundDataBits(AnimMontageReference)
+
+// Implements the net serialization for replicated data members that are always sent in full (no change flag), i.e. types for which a change
+// flag would not save any bandwidth.
+#define SerializeRawBoundData_IMPLEMENTATION()\
+  CALL_SerializeBoundDataSpecific(Bool)
+
+// Server only: checks whether any delta-serialized bound data member differs from the baseline of the current target connection.
+#define HasBoundDataChanged_IMPLEMENTATION()\
+  CALL_HasBoundDataChanged(HalfByte)\
+  CALL_HasBoundDataChanged(Byte)\
+  CALL_HasBoundDataChanged(Int)\
+  CALL_HasBoundDataChanged(Float)\
+  CALL_HasBoundDataChanged(Vector)\
+  CALL_HasBoundDataChanged(Normal)\
+  CALL_HasBoundDataChanged(Rotator)\
+  CALL_HasBoundDataChanged(ActorReference)\
+  CALL_HasBoundDataChanged(ActorComponentReference)\
+  CALL_HasBoundDataChanged(AnimMontageReference)
+
+// Client only: marks all delta-serialized bound data members as not received when the bound data group was skipped during serialization.
+#define MarkBoundDataUnchanged_IMPLEMENTATION()\
+  CALL_MarkBoundDataUnchanged(HalfByte)\
+  CALL_MarkBoundDataUnchanged(Byte)\
+  CALL_MarkBoundDataUnchanged(Int)\
+  CALL_MarkBoundDataUnchanged(Float)\
+  CALL_MarkBoundDataUnchanged(Vector)\
+  CALL_MarkBoundDataUnchanged(Normal)\
+  CALL_MarkBoundDataUnchanged(Rotator)\
+  CALL_MarkBoundDataUnchanged(ActorReference)\
+  CALL_MarkBoundDataUnchanged(ActorComponentReference)\
+  CALL_MarkBoundDataUnchanged(AnimMontageReference)
+
+// Counts the delta-serialized bound data members (i.e. the number of change flags that are serialized when the group is not skipped).
+#define CountReplicatedBoundData_IMPLEMENTATION()\
+  CALL_CountReplicatedBoundData(HalfByte)\
+  CALL_CountReplicatedBoundData(Byte)\
+  CALL_CountReplicatedBoundData(Int)\
+  CALL_CountReplicatedBoundData(Float)\
+  CALL_CountReplicatedBoundData(Vector)\
+  CALL_CountReplicatedBoundData(Normal)\
+  CALL_CountReplicatedBoundData(Rotator)\
+  CALL_CountReplicatedBoundData(ActorReference)\
+  CALL_CountReplicatedBoundData(ActorComponentReference)\
+  CALL_CountReplicatedBoundData(AnimMontageReference)
+
 // Blueprint-type UENUMs that enumerate the variable names used to access the pre-replicated data of a state from Blueprint.
 UENUM(BlueprintType)
 enum class EPreReplicatedBool : uint8
@@ -440,7 +558,9 @@ enum class EPreReplicatedAnimMontageReference : uint8
   bool bReadNew##Name##13{false};\
   bool bReadNew##Name##14{false};\
   bool bReadNew##Name##15{false};\
-  bool bReadNew##Name##16{false};
+  bool bReadNew##Name##16{false};\
+  uint8 NumBound##Name{0};\
+  FGenBoundSlotInfo* BoundSlotInfo##Name{nullptr};
 
 #define ADD_PREREPLICATED_TYPE_TO_REDUCED_STATE(Type, Name)\
   Type Name##1{};\
@@ -460,6 +580,25 @@ enum class EPreReplicatedAnimMontageReference : uint8
   Type Name##15{};\
   Type Name##16{};
 
+// Slot table definitions (@see TGenBoundSlots). Maps the slot index to the data members of the move and state structs.
+#define ADD_PREREPLICATED_TYPE_SLOT_TRAITS(Type, Name)\
+  struct FBoundSlotTraits_##Name\
+  {\
+    using ValueType = Type;\
+    using MoveType = FMove;\
+    using StateType = FState;\
+    using ReducedStateType = FStateReduced;\
+    static constexpr int32 NumSlots = 16;\
+    static constexpr Type FMove::* InMoveSlots[NumSlots] = {&FMove::In##Name##1, &FMove::In##Name##2, &FMove::In##Name##3, &FMove::In##Name##4, &FMove::In##Name##5, &FMove::In##Name##6, &FMove::In##Name##7, &FMove::In##Name##8, &FMove::In##Name##9, &FMove::In##Name##10, &FMove::In##Name##11, &FMove::In##Name##12, &FMove::In##Name##13, &FMove::In##Name##14, &FMove::In##Name##15, &FMove::In##Name##16};\
+    static constexpr Type FMove::* OutMoveSlots[NumSlots] = {&FMove::Out##Name##1, &FMove::Out##Name##2, &FMove::Out##Name##3, &FMove::Out##Name##4, &FMove::Out##Name##5, &FMove::Out##Name##6, &FMove::Out##Name##7, &FMove::Out##Name##8, &FMove::Out##Name##9, &FMove::Out##Name##10, &FMove::Out##Name##11, &FMove::Out##Name##12, &FMove::Out##Name##13, &FMove::Out##Name##14, &FMove::Out##Name##15, &FMove::Out##Name##16};\
+    static constexpr Type FState::* StateSlots[NumSlots] = {&FState::Name##1, &FState::Name##2, &FState::Name##3, &FState::Name##4, &FState::Name##5, &FState::Name##6, &FState::Name##7, &FState::Name##8, &FState::Name##9, &FState::Name##10, &FState::Name##11, &FState::Name##12, &FState::Name##13, &FState::Name##14, &FState::Name##15, &FState::Name##16};\
+    static constexpr bool FState::* ReplicateSlots[NumSlots] = {&FState::bReplicate##Name##1, &FState::bReplicate##Name##2, &FState::bReplicate##Name##3, &FState::bReplicate##Name##4, &FState::bReplicate##Name##5, &FState::bReplicate##Name##6, &FState::bReplicate##Name##7, &FState::bReplicate##Name##8, &FState::bReplicate##Name##9, &FState::bReplicate##Name##10, &FState::bReplicate##Name##11, &FState::bReplicate##Name##12, &FState::bReplicate##Name##13, &FState::bReplicate##Name##14, &FState::bReplicate##Name##15, &FState::bReplicate##Name##16};\
+    static constexpr bool FState::* ReadNewSlots[NumSlots] = {&FState::bReadNew##Name##1, &FState::bReadNew##Name##2, &FState::bReadNew##Name##3, &FState::bReadNew##Name##4, &FState::bReadNew##Name##5, &FState::bReadNew##Name##6, &FState::bReadNew##Name##7, &FState::bReadNew##Name##8, &FState::bReadNew##Name##9, &FState::bReadNew##Name##10, &FState::bReadNew##Name##11, &FState::bReadNew##Name##12, &FState::bReadNew##Name##13, &FState::bReadNew##Name##14, &FState::bReadNew##Name##15, &FState::bReadNew##Name##16};\
+    static constexpr Type FStateReduced::* ReducedStateSlots[NumSlots] = {&FStateReduced::Name##1, &FStateReduced::Name##2, &FStateReduced::Name##3, &FStateReduced::Name##4, &FStateReduced::Name##5, &FStateReduced::Name##6, &FStateReduced::Name##7, &FStateReduced::Name##8, &FStateReduced::Name##9, &FStateReduced::Name##10, &FStateReduced::Name##11, &FStateReduced::Name##12, &FStateReduced::Name##13, &FStateReduced::Name##14, &FStateReduced::Name##15, &FStateReduced::Name##16};\
+    static constexpr uint8 FState::* NumBoundSlots = &FState::NumBound##Name;\
+    static constexpr FGenBoundSlotInfo* FState::* SlotInfoTable = &FState::BoundSlotInfo##Name;\
+  };
+
 // Replication component pointer definitions.
 #define ADD_PREREPLICATED_TYPE_PTR(Type, Name)\
   Type* Name##1{nullptr};\
@@ -539,6 +678,7 @@ enum class EPreReplicatedAnimMontageReference : uint8
 // Implementation calls.
 #define CALL_SwapStateBufferBoundData(Name)           Server_SwapStateBuffer##Name();
 #define CALL_ForceNetUpdateCheckBoundData(Name)       if (Server_ForceNetUpdateCheck##Name()) bShouldForceNetUpdate = true;
+#define CALL_CaptureCheckBoundData(Name)              if (Server_CaptureCheck##Name()) return true;
 #define CALL_SaveBoundDataToServerState(Name)         Server_Save##Name##ToServerState(ServerState, RecipientRole);
 #define CALL_ResetLockedBoundData(Name)               Server_ResetLocked##Name();
 #define CALL_UnpackBoundData(Name)                    Client_Unpack##Name(ServerState);
@@ -548,6 +688,7 @@ enum class EPreReplicatedAnimMontageReference : uint8
 #define CALL_SaveOutBoundDataToMove(Name)             Save##Name##ToMove(Move, FMove::EStateVars::Output);
 #define CALL_SaveBoundDataToState(Name)               Save##Name##ToState(State);
 #define CALL_LoadInBoundDataFromMove(Name)            Load##Name##FromMove(Move, FMove::EStateVars::Input);
+#define CALL_LoadOutBoundDataFromMove(Name)           Load##Name##FromMove(Move, FMove::EStateVars::Output);
 #define CALL_LoadBoundDataFromState(Name)             Load##Name##FromState(State);
 #define CALL_LoadReplicatedBoundDataFromState(Name)   LoadReplicated##Name##FromState(State);
 #define CALL_AddTargetStateBoundDataToInitState(Name) AddFromTargetState##Name(InitializationState, TargetState);
@@ -560,22 +701,22 @@ public:\
   void Bind##Name(Type& VariableToBind, bool bReplicateToAutonomousProxy, bool bReplicateToSimulatedProxy, bool bForceNetUpdateOnChange)\
   {\
     check(Name##Counter >= 0)\
-    if (!Name##1)  { Name##1  = &VariableToBind; check(Name##Counter == 0)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##1  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##1  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##1  = true; } return; }\
-    if (!Name##2)  { Name##2  = &VariableToBind; check(Name##Counter == 1)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##2  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##2  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##2  = true; } return; }\
-    if (!Name##3)  { Name##3  = &VariableToBind; check(Name##Counter == 2)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##3  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##3  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##3  = true; } return; }\
-    if (!Name##4)  { Name##4  = &VariableToBind; check(Name##Counter == 3)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##4  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##4  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##4  = true; } return; }\
-    if (!Name##5)  { Name##5  = &VariableToBind; check(Name##Counter == 4)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##5  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##5  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##5  = true; } return; }\
-    if (!Name##6)  { Name##6  = &VariableToBind; check(Name##Counter == 5)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##6  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##6  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##6  = true; } return; }\
-    if (!Name##7)  { Name##7  = &VariableToBind; check(Name##Counter == 6)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##7  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##7  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##7  = true; } return; }\
-    if (!Name##8)  { Name##8  = &VariableToBind; check(Name##Counter == 7)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##8  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##8  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##8  = true; } return; }\
-    if (!Name##9)  { Name##9  = &VariableToBind; check(Name##Counter == 8)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##9  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##9  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##9  = true; } return; }\
-    if (!Name##10) { Name##10 = &VariableToBind; check(Name##Counter == 9)  ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##10 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##10 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##10 = true; } return; }\
-    if (!Name##11) { Name##11 = &VariableToBind; check(Name##Counter == 10) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##11 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##11 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##11 = true; } return; }\
-    if (!Name##12) { Name##12 = &VariableToBind; check(Name##Counter == 11) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##12 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##12 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##12 = true; } return; }\
-    if (!Name##13) { Name##13 = &VariableToBind; check(Name##Counter == 12) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##13 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##13 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##13 = true; } return; }\
-    if (!Name##14) { Name##14 = &VariableToBind; check(Name##Counter == 13) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##14 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##14 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##14 = true; } return; }\
-    if (!Name##15) { Name##15 = &VariableToBind; check(Name##Counter == 14) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##15 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##15 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##15 = true; } return; }\
-    if (!Name##16) { Name##16 = &VariableToBind; check(Name##Counter == 15) ++Name##Counter; if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##16 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##16 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##16 = true; } return; }\
+    if (!Name##1)  { Name##1  = &VariableToBind; check(Name##Counter == 0)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##1  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##1  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##1  = true; } return; }\
+    if (!Name##2)  { Name##2  = &VariableToBind; check(Name##Counter == 1)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##2  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##2  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##2  = true; } return; }\
+    if (!Name##3)  { Name##3  = &VariableToBind; check(Name##Counter == 2)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##3  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##3  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##3  = true; } return; }\
+    if (!Name##4)  { Name##4  = &VariableToBind; check(Name##Counter == 3)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##4  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##4  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##4  = true; } return; }\
+    if (!Name##5)  { Name##5  = &VariableToBind; check(Name##Counter == 4)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##5  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##5  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##5  = true; } return; }\
+    if (!Name##6)  { Name##6  = &VariableToBind; check(Name##Counter == 5)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##6  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##6  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##6  = true; } return; }\
+    if (!Name##7)  { Name##7  = &VariableToBind; check(Name##Counter == 6)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##7  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##7  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##7  = true; } return; }\
+    if (!Name##8)  { Name##8  = &VariableToBind; check(Name##Counter == 7)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##8  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##8  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##8  = true; } return; }\
+    if (!Name##9)  { Name##9  = &VariableToBind; check(Name##Counter == 8)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##9  = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##9  = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##9  = true; } return; }\
+    if (!Name##10) { Name##10 = &VariableToBind; check(Name##Counter == 9)  ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##10 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##10 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##10 = true; } return; }\
+    if (!Name##11) { Name##11 = &VariableToBind; check(Name##Counter == 10) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##11 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##11 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##11 = true; } return; }\
+    if (!Name##12) { Name##12 = &VariableToBind; check(Name##Counter == 11) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##12 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##12 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##12 = true; } return; }\
+    if (!Name##13) { Name##13 = &VariableToBind; check(Name##Counter == 12) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##13 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##13 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##13 = true; } return; }\
+    if (!Name##14) { Name##14 = &VariableToBind; check(Name##Counter == 13) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##14 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##14 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##14 = true; } return; }\
+    if (!Name##15) { Name##15 = &VariableToBind; check(Name##Counter == 14) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##15 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##15 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##15 = true; } return; }\
+    if (!Name##16) { Name##16 = &VariableToBind; check(Name##Counter == 15) ++Name##Counter; AddBoundSlot##Name(VariableToBind); if (bReplicateToAutonomousProxy) { ServerState_AutonomousProxy().bReplicate##Name##16 = true; } if (bReplicateToSimulatedProxy) { ServerState_SimulatedProxy().bReplicate##Name##16 = true; } if (bForceNetUpdateOnChange) { ServerState_SimulatedProxy().bForceNetUpdate##Name##16 = true; } return; }\
     check(Name##Counter == 16)\
     ensureAlwaysMsgf(false, TEXT("No more data available to bind for %s of type %s."), TEXT(#Name), TEXT(#Type));\
   }\
@@ -613,22 +754,7 @@ private:\
   void Server_SwapStateBuffer##Name()\
   {\
     check(PawnOwner->GetLocalRole() == ROLE_Authority)\
-    if (Name##1)  { const auto Swap##Name##1  = *Name##1;  *Name##1  = StateBuffer().Name##1;  StateBuffer().Name##1  = Swap##Name##1;  } else return;\
-    if (Name##2)  { const auto Swap##Name##2  = *Name##2;  *Name##2  = StateBuffer().Name##2;  StateBuffer().Name##2  = Swap##Name##2;  } else return;\
-    if (Name##3)  { const auto Swap##Name##3  = *Name##3;  *Name##3  = StateBuffer().Name##3;  StateBuffer().Name##3  = Swap##Name##3;  } else return;\
-    if (Name##4)  { const auto Swap##Name##4  = *Name##4;  *Name##4  = StateBuffer().Name##4;  StateBuffer().Name##4  = Swap##Name##4;  } else return;\
-    if (Name##5)  { const auto Swap##Name##5  = *Name##5;  *Name##5  = StateBuffer().Name##5;  StateBuffer().Name##5  = Swap##Name##5;  } else return;\
-    if (Name##6)  { const auto Swap##Name##6  = *Name##6;  *Name##6  = StateBuffer().Name##6;  StateBuffer().Name##6  = Swap##Name##6;  } else return;\
-    if (Name##7)  { const auto Swap##Name##7  = *Name##7;  *Name##7  = StateBuffer().Name##7;  StateBuffer().Name##7  = Swap##Name##7;  } else return;\
-    if (Name##8)  { const auto Swap##Name##8  = *Name##8;  *Name##8  = StateBuffer().Name##8;  StateBuffer().Name##8  = Swap##Name##8;  } else return;\
-    if (Name##9)  { const auto Swap##Name##9  = *Name##9;  *Name##9  = StateBuffer().Name##9;  StateBuffer().Name##9  = Swap##Name##9;  } else return;\
-    if (Name##10) { const auto Swap##Name##10 = *Name##10; *Name##10 = StateBuffer().Name##10; StateBuffer().Name##10 = Swap##Name##10; } else return;\
-    if (Name##11) { const auto Swap##Name##11 = *Name##11; *Name##11 = StateBuffer().Name##11; StateBuffer().Name##11 = Swap##Name##11; } else return;\
-    if (Name##12) { const auto Swap##Name##12 = *Name##12; *Name##12 = StateBuffer().Name##12; StateBuffer().Name##12 = Swap##Name##12; } else return;\
-    if (Name##13) { const auto Swap##Name##13 = *Name##13; *Name##13 = StateBuffer().Name##13; StateBuffer().Name##13 = Swap##Name##13; } else return;\
-    if (Name##14) { const auto Swap##Name##14 = *Name##14; *Name##14 = StateBuffer().Name##14; StateBuffer().Name##14 = Swap##Name##14; } else return;\
-    if (Name##15) { const auto Swap##Name##15 = *Name##15; *Name##15 = StateBuffer().Name##15; StateBuffer().Name##15 = Swap##Name##15; } else return;\
-    if (Name##16) { const auto Swap##Name##16 = *Name##16; *Name##16 = StateBuffer().Name##16; StateBuffer().Name##16 = Swap##Name##16; } else return;\
+    Name##Slots.SwapWithState(StateBuffer());\
   }\
   bool Server_ForceNetUpdateCheck##Name()\
   {\
@@ -654,28 +780,35 @@ private:\
     if (Name##16) { if (ServerState.bReplicate##Name##16 && ServerState.bForceNetUpdate##Name##16 && !bLocked##Name##16) { if (ServerState.Name##16 != LastServerState.Name##16) { bShouldForceNetUpdate = true; if (MinRepHoldTime > 0.f) { bLocked##Name##16 = true; LockSetTime##Name##16 = GetTime(); } } } } else return bShouldForceNetUpdate;\
     return bShouldForceNetUpdate;\
   }\
+  bool Server_CaptureCheck##Name() const\
+  {\
+    check(PawnOwner->GetLocalRole() == ROLE_Authority)\
+    const auto& ServerState = ServerState_SimulatedProxy();\
+    if (Name##1)  { if (ServerState.bReplicate##Name##1  && ServerState.bForceNetUpdate##Name##1  && ServerState.Name##1  != *Name##1)  return true; } else return false;\
+    if (Name##2)  { if (ServerState.bReplicate##Name##2  && ServerState.bForceNetUpdate##Name##2  && ServerState.Name##2  != *Name##2)  return true; } else return false;\
+    if (Name##3)  { if (ServerState.bReplicate##Name##3  && ServerState.bForceNetUpdate##Name##3  && ServerState.Name##3  != *Name##3)  return true; } else return false;\
+    if (Name##4)  { if (ServerState.bReplicate##Name##4  && ServerState.bForceNetUpdate##Name##4  && ServerState.Name##4  != *Name##4)  return true; } else return false;\
+    if (Name##5)  { if (ServerState.bReplicate##Name##5  && ServerState.bForceNetUpdate##Name##5  && ServerState.Name##5  != *Name##5)  return true; } else return false;\
+    if (Name##6)  { if (ServerState.bReplicate##Name##6  && ServerState.bForceNetUpdate##Name##6  && ServerState.Name##6  != *Name##6)  return true; } else return false;\
+    if (Name##7)  { if (ServerState.bReplicate##Name##7  && ServerState.bForceNetUpdate##Name##7  && ServerState.Name##7  != *Name##7)  return true; } else return false;\
+    if (Name##8)  { if (ServerState.bReplicate##Name##8  && ServerState.bForceNetUpdate##Name##8  && ServerState.Name##8  != *Name##8)  return true; } else return false;\
+    if (Name##9)  { if (ServerState.bReplicate##Name##9  && ServerState.bForceNetUpdate##Name##9  && ServerState.Name##9  != *Name##9)  return true; } else return false;\
+    if (Name##10) { if (ServerState.bReplicate##Name##10 && ServerState.bForceNetUpdate##Name##10 && ServerState.Name##10 != *Name##10) return true; } else return false;\
+    if (Name##11) { if (ServerState.bReplicate##Name##11 && ServerState.bForceNetUpdate##Name##11 && ServerState.Name##11 != *Name##11) return true; } else return false;\
+    if (Name##12) { if (ServerState.bReplicate##Name##12 && ServerState.bForceNetUpdate##Name##12 && ServerState.Name##12 != *Name##12) return true; } else return false;\
+    if (Name##13) { if (ServerState.bReplicate##Name##13 && ServerState.bForceNetUpdate##Name##13 && ServerState.Name##13 != *Name##13) return true; } else return false;\
+    if (Name##14) { if (ServerState.bReplicate##Name##14 && ServerState.bForceNetUpdate##Name##14 && ServerState.Name##14 != *Name##14) return true; } else return false;\
+    if (Name##15) { if (ServerState.bReplicate##Name##15 && ServerState.bForceNetUpdate##Name##15 && ServerState.Name##15 != *Name##15) return true; } else return false;\
+    if (Name##16) { if (ServerState.bReplicate##Name##16 && ServerState.bForceNetUpdate##Name##16 && ServerState.Name##16 != *Name##16) return true; } else return false;\
+    return false;\
+  }\
   void Server_Save##Name##ToServerState(FState& ServerState, ENetRole RecipientRole) const\
   {\
     check(PawnOwner->GetLocalRole() == ROLE_Authority)\
     check(RecipientRole == ROLE_AutonomousProxy || RecipientRole == ROLE_SimulatedProxy)\
     if (RecipientRole == ROLE_AutonomousProxy)\
     {\
-      if (Name##1)  ServerState.Name##1  = *Name##1;  else return;\
-      if (Name##2)  ServerState.Name##2  = *Name##2;  else return;\
-      if (Name##3)  ServerState.Name##3  = *Name##3;  else return;\
-      if (Name##4)  ServerState.Name##4  = *Name##4;  else return;\
-      if (Name##5)  ServerState.Name##5  = *Name##5;  else return;\
-      if (Name##6)  ServerState.Name##6  = *Name##6;  else return;\
-      if (Name##7)  ServerState.Name##7  = *Name##7;  else return;\
-      if (Name##8)  ServerState.Name##8  = *Name##8;  else return;\
-      if (Name##9)  ServerState.Name##9  = *Name##9;  else return;\
-      if (Name##10) ServerState.Name##10 = *Name##10; else return;\
-      if (Name##11) ServerState.Name##11 = *Name##11; else return;\
-      if (Name##12) ServerState.Name##12 = *Name##12; else return;\
-      if (Name##13) ServerState.Name##13 = *Name##13; else return;\
-      if (Name##14) ServerState.Name##14 = *Name##14; else return;\
-      if (Name##15) ServerState.Name##15 = *Name##15; else return;\
-      if (Name##16) ServerState.Name##16 = *Name##16; else return;\
+      Name##Slots.SaveToState(ServerState);\
       return;\
     }\
     if (RecipientRole == ROLE_SimulatedProxy)\
@@ -727,185 +860,33 @@ private:\
     check(ServerState.RecipientRole == ROLE_AutonomousProxy || ServerState.RecipientRole == ROLE_SimulatedProxy)\
     if (ServerState.bSerializeBoundData)\
     {\
-      auto& SS = ServerState;\
-      const auto& LRSS = Client_LastReceivedServerState;\
-      if (Name##1)  { if (SS.bReplicate##Name##1)  if (!SS.bReadNew##Name##1)  SS.Name##1  = LRSS.Name##1;  } else return;\
-      if (Name##2)  { if (SS.bReplicate##Name##2)  if (!SS.bReadNew##Name##2)  SS.Name##2  = LRSS.Name##2;  } else return;\
-      if (Name##3)  { if (SS.bReplicate##Name##3)  if (!SS.bReadNew##Name##3)  SS.Name##3  = LRSS.Name##3;  } else return;\
-      if (Name##4)  { if (SS.bReplicate##Name##4)  if (!SS.bReadNew##Name##4)  SS.Name##4  = LRSS.Name##4;  } else return;\
-      if (Name##5)  { if (SS.bReplicate##Name##5)  if (!SS.bReadNew##Name##5)  SS.Name##5  = LRSS.Name##5;  } else return;\
-      if (Name##6)  { if (SS.bReplicate##Name##6)  if (!SS.bReadNew##Name##6)  SS.Name##6  = LRSS.Name##6;  } else return;\
-      if (Name##7)  { if (SS.bReplicate##Name##7)  if (!SS.bReadNew##Name##7)  SS.Name##7  = LRSS.Name##7;  } else return;\
-      if (Name##8)  { if (SS.bReplicate##Name##8)  if (!SS.bReadNew##Name##8)  SS.Name##8  = LRSS.Name##8;  } else return;\
-      if (Name##9)  { if (SS.bReplicate##Name##9)  if (!SS.bReadNew##Name##9)  SS.Name##9  = LRSS.Name##9;  } else return;\
-      if (Name##10) { if (SS.bReplicate##Name##10) if (!SS.bReadNew##Name##10) SS.Name##10 = LRSS.Name##10; } else return;\
-      if (Name##11) { if (SS.bReplicate##Name##11) if (!SS.bReadNew##Name##11) SS.Name##11 = LRSS.Name##11; } else return;\
-      if (Name##12) { if (SS.bReplicate##Name##12) if (!SS.bReadNew##Name##12) SS.Name##12 = LRSS.Name##12; } else return;\
-      if (Name##13) { if (SS.bReplicate##Name##13) if (!SS.bReadNew##Name##13) SS.Name##13 = LRSS.Name##13; } else return;\
-      if (Name##14) { if (SS.bReplicate##Name##14) if (!SS.bReadNew##Name##14) SS.Name##14 = LRSS.Name##14; } else return;\
-      if (Name##15) { if (SS.bReplicate##Name##15) if (!SS.bReadNew##Name##15) SS.Name##15 = LRSS.Name##15; } else return;\
-      if (Name##16) { if (SS.bReplicate##Name##16) if (!SS.bReadNew##Name##16) SS.Name##16 = LRSS.Name##16; } else return;\
+      Name##Slots.UnpackState(ServerState, Client_LastReceivedServerState);\
     }\
   }\
   void Client_LoadForReplay##Name(const FMove& SourceMove)\
   {\
     check(PawnOwner->GetLocalRole() == ROLE_AutonomousProxy)\
-    const auto& ServerState = ServerState_AutonomousProxy();\
-    if (Name##1)  { if (ServerState.bReplicate##Name##1)  *Name##1  = ServerState.Name##1;  else *Name##1  = SourceMove.Out##Name##1;  } else return;\
-    if (Name##2)  { if (ServerState.bReplicate##Name##2)  *Name##2  = ServerState.Name##2;  else *Name##2  = SourceMove.Out##Name##2;  } else return;\
-    if (Name##3)  { if (ServerState.bReplicate##Name##3)  *Name##3  = ServerState.Name##3;  else *Name##3  = SourceMove.Out##Name##3;  } else return;\
-    if (Name##4)  { if (ServerState.bReplicate##Name##4)  *Name##4  = ServerState.Name##4;  else *Name##4  = SourceMove.Out##Name##4;  } else return;\
-    if (Name##5)  { if (ServerState.bReplicate##Name##5)  *Name##5  = ServerState.Name##5;  else *Name##5  = SourceMove.Out##Name##5;  } else return;\
-    if (Name##6)  { if (ServerState.bReplicate##Name##6)  *Name##6  = ServerState.Name##6;  else *Name##6  = SourceMove.Out##Name##6;  } else return;\
-    if (Name##7)  { if (ServerState.bReplicate##Name##7)  *Name##7  = ServerState.Name##7;  else *Name##7  = SourceMove.Out##Name##7;  } else return;\
-    if (Name##8)  { if (ServerState.bReplicate##Name##8)  *Name##8  = ServerState.Name##8;  else *Name##8  = SourceMove.Out##Name##8;  } else return;\
-    if (Name##9)  { if (ServerState.bReplicate##Name##9)  *Name##9  = ServerState.Name##9;  else *Name##9  = SourceMove.Out##Name##9;  } else return;\
-    if (Name##10) { if (ServerState.bReplicate##Name##10) *Name##10 = ServerState.Name##10; else *Name##10 = SourceMove.Out##Name##10; } else return;\
-    if (Name##11) { if (ServerState.bReplicate##Name##11) *Name##11 = ServerState.Name##11; else *Name##11 = SourceMove.Out##Name##11; } else return;\
-    if (Name##12) { if (ServerState.bReplicate##Name##12) *Name##12 = ServerState.Name##12; else *Name##12 = SourceMove.Out##Name##12; } else return;\
-    if (Name##13) { if (ServerState.bReplicate##Name##13) *Name##13 = ServerState.Name##13; else *Name##13 = SourceMove.Out##Name##13; } else return;\
-    if (Name##14) { if (ServerState.bReplicate##Name##14) *Name##14 = ServerState.Name##14; else *Name##14 = SourceMove.Out##Name##14; } else return;\
-    if (Name##15) { if (ServerState.bReplicate##Name##15) *Name##15 = ServerState.Name##15; else *Name##15 = SourceMove.Out##Name##15; } else return;\
-    if (Name##16) { if (ServerState.bReplicate##Name##16) *Name##16 = ServerState.Name##16; else *Name##16 = SourceMove.Out##Name##16; } else return;\
+    Name##Slots.LoadForReplay(ServerState_AutonomousProxy(), SourceMove);\
   }\
   void Save##Name##ToMove(FMove& Move, FMove::EStateVars VarsToSave) const\
   {\
-    if (VarsToSave == FMove::EStateVars::Input)\
-    {\
-      if (Name##1)  Move.In##Name##1  = *Name##1;  else return;\
-      if (Name##2)  Move.In##Name##2  = *Name##2;  else return;\
-      if (Name##3)  Move.In##Name##3  = *Name##3;  else return;\
-      if (Name##4)  Move.In##Name##4  = *Name##4;  else return;\
-      if (Name##5)  Move.In##Name##5  = *Name##5;  else return;\
-      if (Name##6)  Move.In##Name##6  = *Name##6;  else return;\
-      if (Name##7)  Move.In##Name##7  = *Name##7;  else return;\
-      if (Name##8)  Move.In##Name##8  = *Name##8;  else return;\
-      if (Name##9)  Move.In##Name##9  = *Name##9;  else return;\
-      if (Name##10) Move.In##Name##10 = *Name##10; else return;\
-      if (Name##11) Move.In##Name##11 = *Name##11; else return;\
-      if (Name##12) Move.In##Name##12 = *Name##12; else return;\
-      if (Name##13) Move.In##Name##13 = *Name##13; else return;\
-      if (Name##14) Move.In##Name##14 = *Name##14; else return;\
-      if (Name##15) Move.In##Name##15 = *Name##15; else return;\
-      if (Name##16) Move.In##Name##16 = *Name##16; else return;\
-    }\
-    else if (VarsToSave == FMove::EStateVars::Output)\
-    {\
-      if (Name##1)  Move.Out##Name##1  = *Name##1;  else return;\
-      if (Name##2)  Move.Out##Name##2  = *Name##2;  else return;\
-      if (Name##3)  Move.Out##Name##3  = *Name##3;  else return;\
-      if (Name##4)  Move.Out##Name##4  = *Name##4;  else return;\
-      if (Name##5)  Move.Out##Name##5  = *Name##5;  else return;\
-      if (Name##6)  Move.Out##Name##6  = *Name##6;  else return;\
-      if (Name##7)  Move.Out##Name##7  = *Name##7;  else return;\
-      if (Name##8)  Move.Out##Name##8  = *Name##8;  else return;\
-      if (Name##9)  Move.Out##Name##9  = *Name##9;  else return;\
-      if (Name##10) Move.Out##Name##10 = *Name##10; else return;\
-      if (Name##11) Move.Out##Name##11 = *Name##11; else return;\
-      if (Name##12) Move.Out##Name##12 = *Name##12; else return;\
-      if (Name##13) Move.Out##Name##13 = *Name##13; else return;\
-      if (Name##14) Move.Out##Name##14 = *Name##14; else return;\
-      if (Name##15) Move.Out##Name##15 = *Name##15; else return;\
-      if (Name##16) Move.Out##Name##16 = *Name##16; else return;\
-    }\
+    Name##Slots.SaveToMove(Move, VarsToSave == FMove::EStateVars::Output);\
   }\
   void Save##Name##ToState(FState& State) const\
   {\
-    if (Name##1)  State.Name##1  = *Name##1;  else return;\
-    if (Name##2)  State.Name##2  = *Name##2;  else return;\
-    if (Name##3)  State.Name##3  = *Name##3;  else return;\
-    if (Name##4)  State.Name##4  = *Name##4;  else return;\
-    if (Name##5)  State.Name##5  = *Name##5;  else return;\
-    if (Name##6)  State.Name##6  = *Name##6;  else return;\
-    if (Name##7)  State.Name##7  = *Name##7;  else return;\
-    if (Name##8)  State.Name##8  = *Name##8;  else return;\
-    if (Name##9)  State.Name##9  = *Name##9;  else return;\
-    if (Name##10) State.Name##10 = *Name##10; else return;\
-    if (Name##11) State.Name##11 = *Name##11; else return;\
-    if (Name##12) State.Name##12 = *Name##12; else return;\
-    if (Name##13) State.Name##13 = *Name##13; else return;\
-    if (Name##14) State.Name##14 = *Name##14; else return;\
-    if (Name##15) State.Name##15 = *Name##15; else return;\
-    if (Name##16) State.Name##16 = *Name##16; else return;\
+    Name##Slots.SaveToState(State);\
   }\
   void Load##Name##FromMove(const FMove& Move, FMove::EStateVars VarsToLoad) const\
   {\
-    if (VarsToLoad == FMove::EStateVars::Input)\
-    {\
-      if (Name##1)  *Name##1  = Move.In##Name##1;  else return;\
-      if (Name##2)  *Name##2  = Move.In##Name##2;  else return;\
-      if (Name##3)  *Name##3  = Move.In##Name##3;  else return;\
-      if (Name##4)  *Name##4  = Move.In##Name##4;  else return;\
-      if (Name##5)  *Name##5  = Move.In##Name##5;  else return;\
-      if (Name##6)  *Name##6  = Move.In##Name##6;  else return;\
-      if (Name##7)  *Name##7  = Move.In##Name##7;  else return;\
-      if (Name##8)  *Name##8  = Move.In##Name##8;  else return;\
-      if (Name##9)  *Name##9  = Move.In##Name##9;  else return;\
-      if (Name##10) *Name##10 = Move.In##Name##10; else return;\
-      if (Name##11) *Name##11 = Move.In##Name##11; else return;\
-      if (Name##12) *Name##12 = Move.In##Name##12; else return;\
-      if (Name##13) *Name##13 = Move.In##Name##13; else return;\
-      if (Name##14) *Name##14 = Move.In##Name##14; else return;\
-      if (Name##15) *Name##15 = Move.In##Name##15; else return;\
-      if (Name##16) *Name##16 = Move.In##Name##16; else return;\
-    }\
-    else if (VarsToLoad == FMove::EStateVars::Output)\
-    {\
-      if (Name##1)  *Name##1  = Move.Out##Name##1;  else return;\
-      if (Name##2)  *Name##2  = Move.Out##Name##2;  else return;\
-      if (Name##3)  *Name##3  = Move.Out##Name##3;  else return;\
-      if (Name##4)  *Name##4  = Move.Out##Name##4;  else return;\
-      if (Name##5)  *Name##5  = Move.Out##Name##5;  else return;\
-      if (Name##6)  *Name##6  = Move.Out##Name##6;  else return;\
-      if (Name##7)  *Name##7  = Move.Out##Name##7;  else return;\
-      if (Name##8)  *Name##8  = Move.Out##Name##8;  else return;\
-      if (Name##9)  *Name##9  = Move.Out##Name##9;  else return;\
-      if (Name##10) *Name##10 = Move.Out##Name##10; else return;\
-      if (Name##11) *Name##11 = Move.Out##Name##11; else return;\
-      if (Name##12) *Name##12 = Move.Out##Name##12; else return;\
-      if (Name##13) *Name##13 = Move.Out##Name##13; else return;\
-      if (Name##14) *Name##14 = Move.Out##Name##14; else return;\
-      if (Name##15) *Name##15 = Move.Out##Name##15; else return;\
-      if (Name##16) *Name##16 = Move.Out##Name##16; else return;\
-    }\
+    Name##Slots.LoadFromMove(Move, VarsToLoad == FMove::EStateVars::Output);\
   }\
   void Load##Name##FromState(const FState& State) const\
   {\
-    if (Name##1)  { *Name##1  = State.Name##1;  } else return;\
-    if (Name##2)  { *Name##2  = State.Name##2;  } else return;\
-    if (Name##3)  { *Name##3  = State.Name##3;  } else return;\
-    if (Name##4)  { *Name##4  = State.Name##4;  } else return;\
-    if (Name##5)  { *Name##5  = State.Name##5;  } else return;\
-    if (Name##6)  { *Name##6  = State.Name##6;  } else return;\
-    if (Name##7)  { *Name##7  = State.Name##7;  } else return;\
-    if (Name##8)  { *Name##8  = State.Name##8;  } else return;\
-    if (Name##9)  { *Name##9  = State.Name##9;  } else return;\
-    if (Name##10) { *Name##10 = State.Name##10; } else return;\
-    if (Name##11) { *Name##11 = State.Name##11; } else return;\
-    if (Name##12) { *Name##12 = State.Name##12; } else return;\
-    if (Name##13) { *Name##13 = State.Name##13; } else return;\
-    if (Name##14) { *Name##14 = State.Name##14; } else return;\
-    if (Name##15) { *Name##15 = State.Name##15; } else return;\
-    if (Name##16) { *Name##16 = State.Name##16; } else return;\
+    Name##Slots.LoadFromState(State);\
   }\
   void LoadReplicated##Name##FromState(const FState& State) const\
   {\
-    if (Name##1)  { if (ServerState_SimulatedProxy().bReplicate##Name##1)  *Name##1  = State.Name##1;  } else return;\
-    if (Name##2)  { if (ServerState_SimulatedProxy().bReplicate##Name##2)  *Name##2  = State.Name##2;  } else return;\
-    if (Name##3)  { if (ServerState_SimulatedProxy().bReplicate##Name##3)  *Name##3  = State.Name##3;  } else return;\
-    if (Name##4)  { if (ServerState_SimulatedProxy().bReplicate##Name##4)  *Name##4  = State.Name##4;  } else return;\
-    if (Name##5)  { if (ServerState_SimulatedProxy().bReplicate##Name##5)  *Name##5  = State.Name##5;  } else return;\
-    if (Name##6)  { if (ServerState_SimulatedProxy().bReplicate##Name##6)  *Name##6  = State.Name##6;  } else return;\
-    if (Name##7)  { if (ServerState_SimulatedProxy().bReplicate##Name##7)  *Name##7  = State.Name##7;  } else return;\
-    if (Name##8)  { if (ServerState_SimulatedProxy().bReplicate##Name##8)  *Name##8  = State.Name##8;  } else return;\
-    if (Name##9)  { if (ServerState_SimulatedProxy().bReplicate##Name##9)  *Name##9  = State.Name##9;  } else return;\
-    if (Name##10) { if (ServerState_SimulatedProxy().bReplicate##Name##10) *Name##10 = State.Name##10; } else return;\
-    if (Name##11) { if (ServerState_SimulatedProxy().bReplicate##Name##11) *Name##11 = State.Name##11; } else return;\
-    if (Name##12) { if (ServerState_SimulatedProxy().bReplicate##Name##12) *Name##12 = State.Name##12; } else return;\
-    if (Name##13) { if (ServerState_SimulatedProxy().bReplicate##Name##13) *Name##13 = State.Name##13; } else return;\
-    if (Name##14) { if (ServerState_SimulatedProxy().bReplicate##Name##14) *Name##14 = State.Name##14; } else return;\
-    if (Name##15) { if (ServerState_SimulatedProxy().bReplicate##Name##15) *Name##15 = State.Name##15; } else return;\
-    if (Name##16) { if (ServerState_SimulatedProxy().bReplicate##Name##16) *Name##16 = State.Name##16; } else return;\
+    Name##Slots.LoadReplicatedFromState(State, ServerState_SimulatedProxy());\
   }\
   void AddFromTargetState##Name(FState& InitializationState, const FState& TargetState) const\
   {\
@@ -949,6 +930,14 @@ private:\
       if (StartState.bReplicate##Name##16 && StartState.bForceNetUpdate##Name##16) { if (InitializationState.Name##16 != StartState.Name##16 && InitializationState.Name##16 == StateQueue[CurrentStartStateIndex - 1].Name##16) InitializationState.Name##16 = StartState.Name##16; }\
     }\
   }\
+  void AddBoundSlot##Name(Type& VariableToBind)\
+  {\
+    Name##Slots.Bind(VariableToBind);\
+    check(Name##Slots.Num() == Name##Counter)\
+    ServerState_AutonomousProxy().NumBound##Name = ServerState_SimulatedProxy().NumBound##Name = static_cast<uint8>(Name##Counter);\
+    ServerState_AutonomousProxy().BoundSlotInfo##Name = ServerState_SimulatedProxy().BoundSlotInfo##Name = Name##Slots.GetSlotInfoData();\
+  }\
+  TGenBoundSlots<FBoundSlotTraits_##Name> Name##Slots;\
   ADD_PREREPLICATED_TYPE_PTR(Type, Name)\
   ADD_PREREPLICATED_TYPE_LOCK(Name)\
   ADD_PREREPLICATED_TYPE_COUNTER(Name)
@@ -959,56 +948,69 @@ private:\
   {\
     check(PawnOwner->GetLocalRole() == ROLE_AutonomousProxy)\
     const auto& ServerState = ServerState_AutonomousProxy();\
-    if (Name##1)  { if (ServerState.bReplicate##Name##1  && ServerState.Name##1  != SourceMove.Out##Name##1)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "1  != SourceMove.Out" #Name "1"))  return false; } } else break;\
-    if (Name##2)  { if (ServerState.bReplicate##Name##2  && ServerState.Name##2  != SourceMove.Out##Name##2)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "2  != SourceMove.Out" #Name "2"))  return false; } } else break;\
-    if (Name##3)  { if (ServerState.bReplicate##Name##3  && ServerState.Name##3  != SourceMove.Out##Name##3)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "3  != SourceMove.Out" #Name "3"))  return false; } } else break;\
-    if (Name##4)  { if (ServerState.bReplicate##Name##4  && ServerState.Name##4  != SourceMove.Out##Name##4)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "4  != SourceMove.Out" #Name "4"))  return false; } } else break;\
-    if (Name##5)  { if (ServerState.bReplicate##Name##5  && ServerState.Name##5  != SourceMove.Out##Name##5)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "5  != SourceMove.Out" #Name "5"))  return false; } } else break;\
-    if (Name##6)  { if (ServerState.bReplicate##Name##6  && ServerState.Name##6  != SourceMove.Out##Name##6)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "6  != SourceMove.Out" #Name "6"))  return false; } } else break;\
-    if (Name##7)  { if (ServerState.bReplicate##Name##7  && ServerState.Name##7  != SourceMove.Out##Name##7)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "7  != SourceMove.Out" #Name "7"))  return false; } } else break;\
-    if (Name##8)  { if (ServerState.bReplicate##Name##8  && ServerState.Name##8  != SourceMove.Out##Name##8)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "8  != SourceMove.Out" #Name "8"))  return false; } } else break;\
-    if (Name##9)  { if (ServerState.bReplicate##Name##9  && ServerState.Name##9  != SourceMove.Out##Name##9)  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "9  != SourceMove.Out" #Name "9"))  return false; } } else break;\
-    if (Name##10) { if (ServerState.bReplicate##Name##10 && ServerState.Name##10 != SourceMove.Out##Name##10) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "10 != SourceMove.Out" #Name "10")) return false; } } else break;\
-    if (Name##11) { if (ServerState.bReplicate##Name##11 && ServerState.Name##11 != SourceMove.Out##Name##11) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "11 != SourceMove.Out" #Name "11")) return false; } } else break;\
-    if (Name##12) { if (ServerState.bReplicate##Name##12 && ServerState.Name##12 != SourceMove.Out##Name##12) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "12 != SourceMove.Out" #Name "12")) return false; } } else break;\
-    if (Name##13) { if (ServerState.bReplicate##Name##13 && ServerState.Name##13 != SourceMove.Out##Name##13) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "13 != SourceMove.Out" #Name "13")) return false; } } else break;\
-    if (Name##14) { if (ServerState.bReplicate##Name##14 && ServerState.Name##14 != SourceMove.Out##Name##14) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "14 != SourceMove.Out" #Name "14")) return false; } } else break;\
-    if (Name##15) { if (ServerState.bReplicate##Name##15 && ServerState.Name##15 != SourceMove.Out##Name##15) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "15 != SourceMove.Out" #Name "15")) return false; } } else break;\
-    if (Name##16) { if (ServerState.bReplicate##Name##16 && ServerState.Name##16 != SourceMove.Out##Name##16) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "16 != SourceMove.Out" #Name "16")) return false; } } else break;\
+    if (Name##1)  { if (ServerState.bReplicate##Name##1  && ServerState.Name##1  != Name##Slots.QuantizeValue(0, SourceMove.Out##Name##1))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "1  != SourceMove.Out" #Name "1"))  return false; } } else break;\
+    if (Name##2)  { if (ServerState.bReplicate##Name##2  && ServerState.Name##2  != Name##Slots.QuantizeValue(1, SourceMove.Out##Name##2))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "2  != SourceMove.Out" #Name "2"))  return false; } } else break;\
+    if (Name##3)  { if (ServerState.bReplicate##Name##3  && ServerState.Name##3  != Name##Slots.QuantizeValue(2, SourceMove.Out##Name##3))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "3  != SourceMove.Out" #Name "3"))  return false; } } else break;\
+    if (Name##4)  { if (ServerState.bReplicate##Name##4  && ServerState.Name##4  != Name##Slots.QuantizeValue(3, SourceMove.Out##Name##4))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "4  != SourceMove.Out" #Name "4"))  return false; } } else break;\
+    if (Name##5)  { if (ServerState.bReplicate##Name##5  && ServerState.Name##5  != Name##Slots.QuantizeValue(4, SourceMove.Out##Name##5))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "5  != SourceMove.Out" #Name "5"))  return false; } } else break;\
+    if (Name##6)  { if (ServerState.bReplicate##Name##6  && ServerState.Name##6  != Name##Slots.QuantizeValue(5, SourceMove.Out##Name##6))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "6  != SourceMove.Out" #Name "6"))  return false; } } else break;\
+    if (Name##7)  { if (ServerState.bReplicate##Name##7  && ServerState.Name##7  != Name##Slots.QuantizeValue(6, SourceMove.Out##Name##7))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "7  != SourceMove.Out" #Name "7"))  return false; } } else break;\
+    if (Name##8)  { if (ServerState.bReplicate##Name##8  && ServerState.Name##8  != Name##Slots.QuantizeValue(7, SourceMove.Out##Name##8))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "8  != SourceMove.Out" #Name "8"))  return false; } } else break;\
+    if (Name##9)  { if (ServerState.bReplicate##Name##9  && ServerState.Name##9  != Name##Slots.QuantizeValue(8, SourceMove.Out##Name##9))  { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "9  != SourceMove.Out" #Name "9"))  return false; } } else break;\
+    if (Name##10) { if (ServerState.bReplicate##Name##10 && ServerState.Name##10 != Name##Slots.QuantizeValue(9, SourceMove.Out##Name##10)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "10 != SourceMove.Out" #Name "10")) return false; } } else break;\
+    if (Name##11) { if (ServerState.bReplicate##Name##11 && ServerState.Name##11 != Name##Slots.QuantizeValue(10, SourceMove.Out##Name##11)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "11 != SourceMove.Out" #Name "11")) return false; } } else break;\
+    if (Name##12) { if (ServerState.bReplicate##Name##12 && ServerState.Name##12 != Name##Slots.QuantizeValue(11, SourceMove.Out##Name##12)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "12 != SourceMove.Out" #Name "12")) return false; } } else break;\
+    if (Name##13) { if (ServerState.bReplicate##Name##13 && ServerState.Name##13 != Name##Slots.QuantizeValue(12, SourceMove.Out##Name##13)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "13 != SourceMove.Out" #Name "13")) return false; } } else break;\
+    if (Name##14) { if (ServerState.bReplicate##Name##14 && ServerState.Name##14 != Name##Slots.QuantizeValue(13, SourceMove.Out##Name##14)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "14 != SourceMove.Out" #Name "14")) return false; } } else break;\
+    if (Name##15) { if (ServerState.bReplicate##Name##15 && ServerState.Name##15 != Name##Slots.QuantizeValue(14, SourceMove.Out##Name##15)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "15 != SourceMove.Out" #Name "15")) return false; } } else break;\
+    if (Name##16) { if (ServerState.bReplicate##Name##16 && ServerState.Name##16 != Name##Slots.QuantizeValue(15, SourceMove.Out##Name##16)) { GMC_LOG(Verbose, TEXT("Bound data deviates: ServerState_AutonomousProxy." #Name "16 != SourceMove.Out" #Name "16")) return false; } } else break;\
     return true;\
   }\
   while (false);
 
+// Generic convergence check for bound data during partial replays. The per-type comparison is done by the overloads of
+// @see UGenMovementReplicationComponent::Client_AreReplayValuesEqual.
+#define CALL_IsReplayedBoundDataConverged(Name)\
+  if (!Name##Slots.AreOutputsEqual(ReplayedMove, PredictedMove, [](const auto& A, const auto& B) { return Client_AreReplayValuesEqual(A, B); })) return false;
+
 // Generic net serialization.
 #define CALL_SerializeBoundDataGeneric(Name)\
+  TGenBoundSlots<FBoundSlotTraits_##Name>::SerializeState(\
+    *this,\
+    Ar,\
+    CurrentBaseline,\
+    Ar.IsSaving() && (!bOptimizeTraffic || CurrentBaseline->bForceFullSerializationOnNextUpdate)\
+  );
+
+// Generic per-slot bit count logging.
+#define CALL_LogBoundDataBits(Name)\
+  for (int32 Slot = 0; Slot < Name##Slots.Num(); ++Slot)\
   {\
-    const bool bArIsSaving = Ar.IsSaving();\
-    const bool bArIsLoading = Ar.IsLoading();\
-    bool bForceFullSerialization = false;\
-    if (bArIsSaving)\
-    {\
-      check(LastSerialized.Contains(CurrentTargetConnection))\
-      bForceFullSerialization = !bOptimizeTraffic || LastSerialized[CurrentTargetConnection].bForceFullSerializationOnNextUpdate;\
-    }\
-    uint8 B = 0;\
-    if (bArIsSaving) { if (bReplicate##Name##1)  { B = bForceFullSerialization ? 1 : Name##1  != LastSerialized[CurrentTargetConnection].Name##1;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##1;  LastSerialized[CurrentTargetConnection].Name##1  = Name##1;  } } } else if (bArIsLoading) { if (bReplicate##Name##1)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##1;  bReadNew##Name##1  = true; } else { bReadNew##Name##1  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##2)  { B = bForceFullSerialization ? 1 : Name##2  != LastSerialized[CurrentTargetConnection].Name##2;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##2;  LastSerialized[CurrentTargetConnection].Name##2  = Name##2;  } } } else if (bArIsLoading) { if (bReplicate##Name##2)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##2;  bReadNew##Name##2  = true; } else { bReadNew##Name##2  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##3)  { B = bForceFullSerialization ? 1 : Name##3  != LastSerialized[CurrentTargetConnection].Name##3;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##3;  LastSerialized[CurrentTargetConnection].Name##3  = Name##3;  } } } else if (bArIsLoading) { if (bReplicate##Name##3)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##3;  bReadNew##Name##3  = true; } else { bReadNew##Name##3  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##4)  { B = bForceFullSerialization ? 1 : Name##4  != LastSerialized[CurrentTargetConnection].Name##4;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##4;  LastSerialized[CurrentTargetConnection].Name##4  = Name##4;  } } } else if (bArIsLoading) { if (bReplicate##Name##4)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##4;  bReadNew##Name##4  = true; } else { bReadNew##Name##4  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##5)  { B = bForceFullSerialization ? 1 : Name##5  != LastSerialized[CurrentTargetConnection].Name##5;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##5;  LastSerialized[CurrentTargetConnection].Name##5  = Name##5;  } } } else if (bArIsLoading) { if (bReplicate##Name##5)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##5;  bReadNew##Name##5  = true; } else { bReadNew##Name##5  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##6)  { B = bForceFullSerialization ? 1 : Name##6  != LastSerialized[CurrentTargetConnection].Name##6;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##6;  LastSerialized[CurrentTargetConnection].Name##6  = Name##6;  } } } else if (bArIsLoading) { if (bReplicate##Name##6)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##6;  bReadNew##Name##6  = true; } else { bReadNew##Name##6  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##7)  { B = bForceFullSerialization ? 1 : Name##7  != LastSerialized[CurrentTargetConnection].Name##7;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##7;  LastSerialized[CurrentTargetConnection].Name##7  = Name##7;  } } } else if (bArIsLoading) { if (bReplicate##Name##7)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##7;  bReadNew##Name##7  = true; } else { bReadNew##Name##7  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##8)  { B = bForceFullSerialization ? 1 : Name##8  != LastSerialized[CurrentTargetConnection].Name##8;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##8;  LastSerialized[CurrentTargetConnection].Name##8  = Name##8;  } } } else if (bArIsLoading) { if (bReplicate##Name##8)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##8;  bReadNew##Name##8  = true; } else { bReadNew##Name##8  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##9)  { B = bForceFullSerialization ? 1 : Name##9  != LastSerialized[CurrentTargetConnection].Name##9;  Ar.SerializeBits(&B, 1); if (B) { Ar << Name##9;  LastSerialized[CurrentTargetConnection].Name##9  = Name##9;  } } } else if (bArIsLoading) { if (bReplicate##Name##9)  { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##9;  bReadNew##Name##9  = true; } else { bReadNew##Name##9  = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##10) { B = bForceFullSerialization ? 1 : Name##10 != LastSerialized[CurrentTargetConnection].Name##10; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##10; LastSerialized[CurrentTargetConnection].Name##10 = Name##10; } } } else if (bArIsLoading) { if (bReplicate##Name##10) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##10; bReadNew##Name##10 = true; } else { bReadNew##Name##10 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##11) { B = bForceFullSerialization ? 1 : Name##11 != LastSerialized[CurrentTargetConnection].Name##11; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##11; LastSerialized[CurrentTargetConnection].Name##11 = Name##11; } } } else if (bArIsLoading) { if (bReplicate##Name##11) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##11; bReadNew##Name##11 = true; } else { bReadNew##Name##11 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##12) { B = bForceFullSerialization ? 1 : Name##12 != LastSerialized[CurrentTargetConnection].Name##12; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##12; LastSerialized[CurrentTargetConnection].Name##12 = Name##12; } } } else if (bArIsLoading) { if (bReplicate##Name##12) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##12; bReadNew##Name##12 = true; } else { bReadNew##Name##12 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##13) { B = bForceFullSerialization ? 1 : Name##13 != LastSerialized[CurrentTargetConnection].Name##13; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##13; LastSerialized[CurrentTargetConnection].Name##13 = Name##13; } } } else if (bArIsLoading) { if (bReplicate##Name##13) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##13; bReadNew##Name##13 = true; } else { bReadNew##Name##13 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##14) { B = bForceFullSerialization ? 1 : Name##14 != LastSerialized[CurrentTargetConnection].Name##14; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##14; LastSerialized[CurrentTargetConnection].Name##14 = Name##14; } } } else if (bArIsLoading) { if (bReplicate##Name##14) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##14; bReadNew##Name##14 = true; } else { bReadNew##Name##14 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##15) { B = bForceFullSerialization ? 1 : Name##15 != LastSerialized[CurrentTargetConnection].Name##15; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##15; LastSerialized[CurrentTargetConnection].Name##15 = Name##15; } } } else if (bArIsLoading) { if (bReplicate##Name##15) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##15; bReadNew##Name##15 = true; } else { bReadNew##Name##15 = false; } } }\
-    if (bArIsSaving) { if (bReplicate##Name##16) { B = bForceFullSerialization ? 1 : Name##16 != LastSerialized[CurrentTargetConnection].Name##16; Ar.SerializeBits(&B, 1); if (B) { Ar << Name##16; LastSerialized[CurrentTargetConnection].Name##16 = Name##16; } } } else if (bArIsLoading) { if (bReplicate##Name##16) { Ar.SerializeBits(&B, 1); if (B) { Ar << Name##16; bReadNew##Name##16 = true; } else { bReadNew##Name##16 = false; } } }\
+    auto& Info = Name##Slots.GetSlotInfo(Slot);\
+    UE_LOG(\
+      LogGMCReplication,\
+      Display,\
+      TEXT("%s: " #Name "%d sent %llu bits (%s)."),\
+      *GetNameSafe(PawnOwner),\
+      Slot + 1,\
+      Info.NumBitsSent,\
+      Info.IsQuantized() ? *FString::Printf(TEXT("quantized to %d bits"), Info.NumBits) : TEXT("full precision")\
+    )\
+    Info.NumBitsSent = 0;\
   }
 
+// Generic check for changed bound data (used to determine whether the bound data group can be skipped).
+#define CALL_HasBoundDataChanged(Name)\
+  if (TGenBoundSlots<FBoundSlotTraits_##Name>::HasStateChanged(*this, *CurrentBaseline)) return true;
+
+// Generic reset of the read-new flags for skipped bound data.
+#define CALL_MarkBoundDataUnchanged(Name)\
+  TGenBoundSlots<FBoundSlotTraits_##Name>::MarkStateUnchanged(*this);
+
+// Generic count of the delta-serialized bound data members.
+#define CALL_CountReplicatedBoundData(Name)\
+  Count += TGenBoundSlots<FBoundSlotTraits_##Name>::CountReplicated(*this);
+
 // Variable definitions for input data. The functions for processing this data are implemented directly within the replication component as
 // all the variable names are fixed.
 // @see UGenMovementReplicationComponent::BindInputFlag
@@ -1123,8 +1125,38 @@ private:\
   void RPCName##_Implementation(const TArray<TypeName>& RemoteMoves) {\
     check(sizeof TypeName == sizeof FMove && std::is_standard_layout<TypeName>::value && std::is_standard_layout<FMove>::value)\
     const TArray<FMove>& ReceivedMoves = reinterpret_cast<const TArray<FMove>&>(RemoteMoves);\
-    Server_ProcessClientMoves(ReceivedMoves);\
+    Server_ReceiveClientMoves(ReceivedMoves);\
+  }\
+  bool RPCName##_Validate(const TArray<TypeName>& RemoteMoves) {\
+    return true;\
+  }
+
+// Same as @see IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS but additionally supports the unreliable move transport (@see
+// UGenMovementReplicationComponent::bUseUnreliableMoveTransport).
+// UnreliableRPCName: the name of your custom unreliable send-moves-to-server RPC declared within the class.
+#define IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS_UNRELIABLE(TypeName, MemberName, RPCName, UnreliableRPCName)\
+  TypeName MemberName;\
+  FMove& LocalMove() override { return MemberName; }\
+  const FMove& LocalMove() const override { return MemberName; }\
+  void Client_SendMovesToServer() override {\
+    check(sizeof TypeName == sizeof FMove && std::is_standard_layout<TypeName>::value && std::is_standard_layout<FMove>::value)\
+    const TArray<TypeName>& PendingMoves = reinterpret_cast<const TArray<TypeName>&>(Client_GetPendingMoves());\
+    if (IsUsingUnreliableMoveTransport()) UnreliableRPCName(PendingMoves);\
+    else RPCName(PendingMoves);\
+  }\
+  void RPCName##_Implementation(const TArray<TypeName>& RemoteMoves) {\
+    check(sizeof TypeName == sizeof FMove && std::is_standard_layout<TypeName>::value && std::is_standard_layout<FMove>::value)\
+    const TArray<FMove>& ReceivedMoves = reinterpret_cast<const TArray<FMove>&>(RemoteMoves);\
+    Server_ReceiveClientMoves(ReceivedMoves);\
   }\
   bool RPCName##_Validate(const TArray<TypeName>& RemoteMoves) {\
     return true;\
+  }\
+  void UnreliableRPCName##_Implementation(const TArray<TypeName>& RemoteMoves) {\
+    check(sizeof TypeName == sizeof FMove && std::is_standard_layout<TypeName>::value && std::is_standard_layout<FMove>::value)\
+    const TArray<FMove>& ReceivedMoves = reinterpret_cast<const TArray<FMove>&>(RemoteMoves);\
+    Server_ReceiveClientMoves(ReceivedMoves);\
+  }\
+  bool UnreliableRPCName##_Validate(const TArray<TypeName>& RemoteMoves) {\
+    return true;\
   }
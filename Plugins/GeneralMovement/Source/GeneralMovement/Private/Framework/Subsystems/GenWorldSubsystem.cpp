@@ -0,0 +1,1592 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+
+#include "GenWorldSubsystem.h"
+#include "GenPawn.h"
+#include "GenMovementReplicationComponent.h"
+#include "GenMovementComponent.h"
+#include "GenFloorField.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogGMCWorld)
+
+DECLARE_CYCLE_STAT(TEXT("Build Relevancy Cache"), STAT_BuildRelevancyCache, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Deferred Server Move Phase"), STAT_DeferredServerMovePhase, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Prepare Move Batches And Prefetch Queries"), STAT_PrepareMoveBatches, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Build Move Islands"), STAT_BuildMoveIslands, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Execute Move Islands"), STAT_ExecuteMoveIslands, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Execute Concurrent Move Islands"), STAT_ExecuteConcurrentMoveIslands, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Move Pawns"), STAT_DeferredMovePawns, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Move Islands"), STAT_MoveIslands, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Largest Move Island"), STAT_LargestMoveIsland, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Concurrent Move Islands"), STAT_ConcurrentMoveIslands, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Prefetched Move Query Pawns"), STAT_PrefetchedMoveQueryPawns, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relevancy Cache Hits"), STAT_RelevancyCacheHits, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relevancy Cache Misses"), STAT_RelevancyCacheMisses, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Build Serialization Caches"), STAT_BuildSerializationCaches, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Serialization Cache Pawns"), STAT_SerializationCachePawns, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Find Floor In Field"), STAT_FindFloorInField, STATGROUP_GMCWorldSubsystem)
+DECLARE_CYCLE_STAT(TEXT("Submit Async Bot Queries"), STAT_SubmitAsyncBotQueries, STATGROUP_GMCWorldSubsystem)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Bot Query Pawns"), STAT_AsyncBotQueryPawns, STATGROUP_GMCWorldSubsystem)
+
+namespace GMCCVars
+{
+  int32 UseRelevancyCache = 1;
+  float RelevancyCacheViewTolerance = 100.f;
+  int32 ParallelMoveBatchPreparation = 1;
+  int32 PrefetchMoveQueries = 1;
+  int32 ParallelMoveIslands = 1;
+  float MoveIslandMargin = 100.f;
+  int32 UseSerializationCache = 1;
+  int32 ParallelSerializationCache = 1;
+  int32 UseFloorField = 1;
+  int32 AsyncBotQueries = 1;
+
+#if ALLOW_CONSOLE && !NO_LOGGING
+
+  FAutoConsoleVariableRef CVarUseRelevancyCache(
+    TEXT("gmc.UseRelevancyCache"),
+    UseRelevancyCache,
+    TEXT("Evaluate the net relevancy of all pawns for all connections once per server frame and share the results. ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarRelevancyCacheViewTolerance(
+    TEXT("gmc.RelevancyCacheViewTolerance"),
+    RelevancyCacheViewTolerance,
+    TEXT("Max distance (cm) between a queried view location and the one the relevancy cache was built with for the cached value to be used."),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarParallelMoveBatchPreparation(
+    TEXT("gmc.ParallelMoveBatchPreparation"),
+    ParallelMoveBatchPreparation,
+    TEXT("Prepare the client move batches and prefetch the collision queries of the deferred server move phase on multiple threads. ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarPrefetchMoveQueries(
+    TEXT("gmc.PrefetchMoveQueries"),
+    PrefetchMoveQueries,
+    TEXT("Execute the floor and penetration queries of the first move of the first pawn of every move island of the deferred server move ")
+    TEXT("phase ahead of move execution. 0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarParallelMoveIslands(
+    TEXT("gmc.ParallelMoveIslands"),
+    ParallelMoveIslands,
+    TEXT("Execute the moves of move islands that consist of a single pawn with \"bAllowConcurrentMoveExecution\" enabled on multiple ")
+    TEXT("threads during the deferred server move phase. 0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarMoveIslandMargin(
+    TEXT("gmc.MoveIslandMargin"),
+    MoveIslandMargin,
+    TEXT("Additional distance (cm) by which the swept movement bounds of pawns are expanded when partitioning them into move islands."),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarUseSerializationCache(
+    TEXT("gmc.UseSerializationCache"),
+    UseSerializationCache,
+    TEXT("Serialize the simulated proxy state of each pawn once per distinct connection baseline and share the bits between connections. ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarParallelSerializationCache(
+    TEXT("gmc.ParallelSerializationCache"),
+    ParallelSerializationCache,
+    TEXT("Build the serialization caches of all pawns on multiple threads. ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarUseFloorField(
+    TEXT("gmc.UseFloorField"),
+    UseFloorField,
+    TEXT("Answer floor queries over static geometry from the baked floor field of the world if there is one (see gmc.BakeFloorField). ")
+    TEXT("0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleVariableRef CVarAsyncBotQueries(
+    TEXT("gmc.AsyncBotQueries"),
+    AsyncBotQueries,
+    TEXT("Submit the floor and penetration queries of server bots with \"bUseAsyncBotQueries\" enabled asynchronously at the end of every ")
+    TEXT("frame and use the results during the next movement update. 0: Disable, 1: Enable"),
+    ECVF_Default
+  );
+
+  FAutoConsoleCommandWithWorldAndArgs CmdBakeFloorField(
+    TEXT("gmc.BakeFloorField"),
+    TEXT("Bake the floor field for the static geometry of the current world and save it to the project content. ")
+    TEXT("Args: [CellSize=50] [Radius=radius of the first GMC pawn] [MinWalkableNormalZ=0.71]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->BakeFloorField(
+          Args.IsValidIndex(0) ? FCString::Atof(*Args[0]) : 50.f,
+          Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 0.f,
+          Args.IsValidIndex(2) ? FCString::Atof(*Args[2]) : 0.71f
+        );
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorldAndArgs CmdValidateFloorField(
+    TEXT("gmc.ValidateFloorField"),
+    TEXT("Compare the answers of the floor field of the current world with real traces. Args: [NumSamples=10000]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->ValidateFloorField(Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 10000);
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkFloorQueries(
+    TEXT("gmc.BenchmarkFloorQueries"),
+    TEXT("Measure the cost of floor queries answered by the floor field of the current world against real traces. ")
+    TEXT("Args: [NumQueries=100000]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->BenchmarkFloorQueries(Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 100000);
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkBotQueries(
+    TEXT("gmc.BenchmarkBotQueries"),
+    TEXT("Measure the game thread time of the floor and penetration queries of server bots executed synchronously against submitting ")
+    TEXT("them asynchronously. Args: [NumBots=200] [TraceLength=500]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->BenchmarkBotQueries(
+          Args.IsValidIndex(0) ? FCString::Atoi(*Args[0]) : 200,
+          Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 500.f
+        );
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorldAndArgs CmdBenchmarkMovePhase(
+    TEXT("gmc.BenchmarkMovePhase"),
+    TEXT("Measure the time of the deferred server move phase with the move islands executed serially against executing them concurrently. ")
+    TEXT("Spawns the pawns for the duration of the benchmark. Args: [NumPawns=16, 64 and 128] [NumFrames=60] [MovesPerBatch=2]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        const int32 NumFrames = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 60;
+        const int32 MovesPerBatch = Args.IsValidIndex(2) ? FCString::Atoi(*Args[2]) : 2;
+        if (Args.IsValidIndex(0))
+        {
+          Subsystem->BenchmarkMovePhase(FCString::Atoi(*Args[0]), NumFrames, MovesPerBatch);
+          return;
+        }
+        for (const int32 NumPawns : {16, 64, 128})
+        {
+          Subsystem->BenchmarkMovePhase(NumPawns, NumFrames, MovesPerBatch);
+        }
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorld CmdDumpReplicationBandwidth(
+    TEXT("gmc.DumpReplicationBandwidth"),
+    TEXT("Log the server state bandwidth of every connection since the last call and the number of pawns per replication LOD tier."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->DumpReplicationBandwidth();
+      }
+    })
+  );
+
+  FAutoConsoleCommandWithWorld CmdDumpRelevancyCache(
+    TEXT("gmc.DumpRelevancyCache"),
+    TEXT("Log the build time and hit counts of the net relevancy cache of the current world and reset the counters."),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+      if (!World) return;
+      if (const auto Subsystem = World->GetSubsystem<UGenWorldSubsystem>())
+      {
+        Subsystem->DumpRelevancyCacheStats();
+      }
+    })
+  );
+
+#endif
+}
+
+// Lower limit for the cell size of the relevancy grid so very small cull distances don't produce an excessive number of cells.
+static constexpr float MIN_RELEVANCY_CELL_SIZE = 1000.f;
+
+// Lower limit for the cell size of the move island grid so slow pawns don't produce an excessive number of cells.
+static constexpr float MIN_MOVE_ISLAND_CELL_SIZE = 500.f;
+
+// Upper limit for the number of move islands that are executed concurrently at once, every island holds a movement scope on the stack of the
+// game thread while they execute (@see ExecuteWithDeferredMovementUpdates).
+static constexpr int32 MAX_CONCURRENT_MOVE_ISLANDS = 64;
+
+static FIntVector GetGridCell(const FVector& Location, float CellSize)
+{
+  return FIntVector(
+    FMath::FloorToInt(Location.X / CellSize),
+    FMath::FloorToInt(Location.Y / CellSize),
+    FMath::FloorToInt(Location.Z / CellSize)
+  );
+}
+
+// Executes the passed function while the updated components of the passed components defer their movement updates
+// (@see FScopedMovementUpdate). Moving a pawn then only changes the transform of its updated component, everything else (attached
+// components, the physics body, overlaps and hit events) is updated on the game thread when the scopes close. The scopes can only live on
+// the stack, so they are opened recursively starting at the passed index, and close in the order of the components.
+static void ExecuteWithDeferredMovementUpdates(
+  TArrayView<UGenMovementReplicationComponent* const> Components,
+  int32 Index,
+  TFunctionRef<void()> Function
+)
+{
+  if (Index < 0)
+  {
+    Function();
+    return;
+  }
+  FScopedMovementUpdate ScopedMovementUpdate(Components[Index]->UpdatedComponent, EScopedUpdate::DeferredUpdates);
+  ExecuteWithDeferredMovementUpdates(Components, Index - 1, Function);
+}
+
+void UGenWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+  Super::Initialize(Collection);
+
+  PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UGenWorldSubsystem::OnWorldPreActorTick);
+  PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UGenWorldSubsystem::OnWorldPostActorTick);
+  LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UGenWorldSubsystem::OnLevelAddedToWorld);
+}
+
+void UGenWorldSubsystem::Deinitialize()
+{
+  FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+  FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+  FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+  FloorField.Reset();
+  QueuedMoveComponents.Empty();
+  QueuedCorrectionComponents.Empty();
+  QueuedSerializationComponents.Empty();
+  BotQueryBenchmark = FBotQueryBenchmark();
+
+  for (auto& Components : ReplicationComponents)
+  {
+    Components.Empty();
+  }
+
+  bRelevancyCacheValid = false;
+  RelevancyPawnIndices.Empty();
+  RelevancyViewerIndices.Empty();
+  RelevancyViewers.Empty();
+  RelevancyBits.Empty();
+  DistanceBasedBits.Empty();
+  RelevancyGrid.Empty();
+
+  Super::Deinitialize();
+}
+
+void UGenWorldSubsystem::RegisterReplicationComponent(UGenMovementReplicationComponent* Component, EGenReplicationRole Role)
+{
+  check(Component)
+  if (Role == EGenReplicationRole::None) return;
+  checkSlow(!ReplicationComponents[static_cast<int32>(Role)].Contains(Component))
+  ReplicationComponents[static_cast<int32>(Role)].Emplace(Component);
+}
+
+void UGenWorldSubsystem::UnregisterReplicationComponent(UGenMovementReplicationComponent* Component, EGenReplicationRole Role)
+{
+  if (Role == EGenReplicationRole::None) return;
+  // The order of the components within a partition is irrelevant.
+  ReplicationComponents[static_cast<int32>(Role)].RemoveSingleSwap(Component, false/*don't shrink*/);
+}
+
+const TArray<UGenMovementReplicationComponent*>& UGenWorldSubsystem::GetReplicationComponents(EGenReplicationRole Role) const
+{
+  check(Role != EGenReplicationRole::None)
+  return ReplicationComponents[static_cast<int32>(Role)];
+}
+
+void UGenWorldSubsystem::ForEachReplicationComponent(
+  std::initializer_list<EGenReplicationRole> Roles,
+  TFunctionRef<void(UGenMovementReplicationComponent*)> Function
+) const
+{
+  for (const auto Role : Roles)
+  {
+    for (const auto Component : GetReplicationComponents(Role))
+    {
+      Function(Component);
+    }
+  }
+}
+
+void UGenWorldSubsystem::ForEachReplicationComponent(TFunctionRef<void(UGenMovementReplicationComponent*)> Function) const
+{
+  for (const auto& Components : ReplicationComponents)
+  {
+    for (const auto Component : Components)
+    {
+      Function(Component);
+    }
+  }
+}
+
+void UGenWorldSubsystem::QueueClientMoveBatches(UGenMovementReplicationComponent* Component)
+{
+  check(Component)
+  QueuedMoveComponents.AddUnique(Component);
+}
+
+void UGenWorldSubsystem::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+  if (World != GetWorld()) return;
+  // Replicated properties and client RPCs are received when the net driver ticks at the start of the frame, so all server states and move
+  // batches of this frame are available now.
+  ResolveQueuedClientCorrections();
+  ProcessQueuedClientMoveBatches();
+}
+
+void UGenWorldSubsystem::QueueClientCorrection(UGenMovementReplicationComponent* Component)
+{
+  check(Component)
+  QueuedCorrectionComponents.AddUnique(Component);
+}
+
+void UGenWorldSubsystem::ResolveQueuedClientCorrections()
+{
+  if (QueuedCorrectionComponents.Num() == 0) return;
+
+  // Move the queue out first in case a correction causes another server state to be queued.
+  const auto Components = MoveTemp(QueuedCorrectionComponents);
+  QueuedCorrectionComponents.Reset();
+  for (const auto& Component : Components)
+  {
+    if (Component.IsValid())
+    {
+      Component->Client_ResolvePendingCorrection();
+    }
+  }
+}
+
+void UGenWorldSubsystem::ProcessQueuedClientMoveBatches()
+{
+  if (QueuedMoveComponents.Num() == 0) return;
+  SCOPE_CYCLE_COUNTER(STAT_DeferredServerMovePhase)
+
+  TArray<UGenMovementReplicationComponent*> Components;
+  Components.Reserve(QueuedMoveComponents.Num());
+  for (const auto& Component : QueuedMoveComponents)
+  {
+    if (Component.IsValid()) Components.Emplace(Component.Get());
+  }
+  QueuedMoveComponents.Reset();
+
+  // Sort the components by a key that does not depend on the order in which the RPCs arrived.
+  const auto GetOrderKey = [](const UGenMovementReplicationComponent* Component)
+  {
+    const auto PlayerState = Component->PawnOwner->GetPlayerState();
+    return TPair<int32, uint32>(PlayerState ? PlayerState->GetPlayerId() : MAX_int32, Component->GetUniqueID());
+  };
+  Components.Sort([&](const UGenMovementReplicationComponent& A, const UGenMovementReplicationComponent& B)
+  {
+    return GetOrderKey(&A) < GetOrderKey(&B);
+  });
+  const int32 NumComponents = Components.Num();
+  INC_DWORD_STAT_BY(STAT_DeferredMovePawns, NumComponents)
+
+  // Partition the pawns into islands with a union-find over the interactions between them.
+  TArray<int32> IslandParents;
+  IslandParents.SetNumUninitialized(NumComponents);
+  for (int32 Index = 0; Index < NumComponents; ++Index) IslandParents[Index] = Index;
+  const auto FindIsland = [&IslandParents](int32 Index)
+  {
+    while (IslandParents[Index] != Index)
+    {
+      IslandParents[Index] = IslandParents[IslandParents[Index]];
+      Index = IslandParents[Index];
+    }
+    return Index;
+  };
+  const auto MergeIslands = [&](int32 IndexA, int32 IndexB)
+  {
+    const int32 IslandA = FindIsland(IndexA);
+    const int32 IslandB = FindIsland(IndexB);
+    // Always keep the lower index as root so the island order only depends on the component order.
+    if (IslandA != IslandB) IslandParents[FMath::Max(IslandA, IslandB)] = FMath::Min(IslandA, IslandB);
+  };
+  {
+    SCOPE_CYCLE_COUNTER(STAT_BuildMoveIslands)
+    // Pawns that roll back other pawns for move execution restore them right afterwards, so they only interact with the pawns within their
+    // own swept bounds like any other pawn.
+    TArray<FBox> SweptBounds;
+    SweptBounds.Reserve(NumComponents);
+    float CellSize = MIN_MOVE_ISLAND_CELL_SIZE;
+    for (const auto Component : Components)
+    {
+      const FBox& Bounds = SweptBounds.Emplace_GetRef(Component->Server_GetQueuedMovesSweptBounds(GMCCVars::MoveIslandMargin));
+      CellSize = FMath::Max(CellSize, Bounds.GetSize().GetMax());
+    }
+    // The cells are at least as large as the greatest swept bounds, so every pawn is inserted into at most 2x2x2 cells and only pawns that
+    // share a cell need to be tested against each other.
+    TMap<FIntVector, TArray<int32>> IslandGrid;
+    for (int32 Index = 0; Index < NumComponents; ++Index)
+    {
+      const FIntVector MinCell = GetGridCell(SweptBounds[Index].Min, CellSize);
+      const FIntVector MaxCell = GetGridCell(SweptBounds[Index].Max, CellSize);
+      for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+      for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+      for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+      {
+        IslandGrid.FindOrAdd(FIntVector(X, Y, Z)).Emplace(Index);
+      }
+    }
+    for (const auto& Cell : IslandGrid)
+    {
+      const TArray<int32>& Indices = Cell.Value;
+      for (int32 A = 0; A < Indices.Num(); ++A)
+      {
+        for (int32 B = A + 1; B < Indices.Num(); ++B)
+        {
+          const int32 IndexA = Indices[A];
+          const int32 IndexB = Indices[B];
+          if (FindIsland(IndexA) != FindIsland(IndexB) && SweptBounds[IndexA].Intersect(SweptBounds[IndexB])) MergeIslands(IndexA, IndexB);
+        }
+      }
+    }
+  }
+
+  // Group the components by island. Islands are ordered by their first component and keep the component order internally. The root of an
+  // island is always its first component.
+  TArray<TArray<int32>> Islands;
+  TMap<int32, int32> IslandIndices;
+  for (int32 Index = 0; Index < NumComponents; ++Index)
+  {
+    const int32 Root = FindIsland(Index);
+    if (!IslandIndices.Contains(Root))
+    {
+      IslandIndices.Emplace(Root, Islands.AddDefaulted());
+    }
+    Islands[IslandIndices[Root]].Emplace(Index);
+  }
+
+#if STATS
+  INC_DWORD_STAT_BY(STAT_MoveIslands, Islands.Num())
+  int32 LargestIsland{0};
+  for (const auto& Island : Islands) LargestIsland = FMath::Max(LargestIsland, Island.Num());
+  INC_DWORD_STAT_BY(STAT_LargestMoveIsland, LargestIsland)
+#endif
+
+  // Islands of a single pawn do not interact with any other pawn, so they can execute their moves concurrently if the pawn allows it
+  // (@see UGenMovementReplicationComponent::CanExecuteMovesConcurrently). Their transforms are only committed to the physics scene at the
+  // end of the concurrent execution, so pawns of the same island would not see each other move and all other islands are executed on the
+  // game thread afterwards.
+  TArray<UGenMovementReplicationComponent*> ConcurrentComponents;
+  TArray<int32> SerialIslands;
+  for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+  {
+    const auto& Island = Islands[IslandIndex];
+    if (GMCCVars::ParallelMoveIslands && Island.Num() == 1 && Components[Island[0]]->CanExecuteMovesConcurrently())
+    {
+      ConcurrentComponents.Emplace(Components[Island[0]]);
+      continue;
+    }
+    SerialIslands.Emplace(IslandIndex);
+  }
+  NumLastConcurrentMoveIslands = ConcurrentComponents.Num();
+  NumLastMoveIslands = Islands.Num();
+  INC_DWORD_STAT_BY(STAT_ConcurrentMoveIslands, ConcurrentComponents.Num())
+
+  // The first pawn of an island executes its moves before any other pawn that could interact with it has moved, so the floor and
+  // penetration queries at the start of its first move can be executed ahead of time. Pawns that roll back other pawns query against the
+  // rolled back world instead and are excluded. Pawns that execute their moves concurrently would only query the same world a second time.
+  TArray<UGenMovementComponent*> PrefetchComponents;
+  PrefetchComponents.Init(nullptr, NumComponents);
+  if (GMCCVars::PrefetchMoveQueries)
+  {
+    for (const int32 IslandIndex : SerialIslands)
+    {
+      const int32 Index = Islands[IslandIndex][0];
+      const auto Component = Components[Index];
+      if (!Component->bRollbackServerPawns) PrefetchComponents[Index] = Cast<UGenMovementComponent>(Component);
+    }
+  }
+
+  {
+    SCOPE_CYCLE_COUNTER(STAT_PrepareMoveBatches)
+    // Preparing a batch only writes to the batch itself and the prefetched queries only read from the physics scene, which does not change
+    // until the moves are executed, so the components can be processed independently of each other.
+    ParallelFor(
+      NumComponents,
+      [&Components, &PrefetchComponents](int32 Index)
+      {
+        Components[Index]->Server_PrepareQueuedMoveBatches();
+        if (PrefetchComponents[Index]) PrefetchComponents[Index]->PrefetchMoveQueries();
+      },
+      !GMCCVars::ParallelMoveBatchPreparation/*force single thread*/
+    );
+  }
+#if STATS
+  int32 NumPrefetched{0};
+  for (const auto Component : PrefetchComponents) NumPrefetched += Component && Component->PrefetchedMoveQueries.bValid;
+  INC_DWORD_STAT_BY(STAT_PrefetchedMoveQueryPawns, NumPrefetched)
+#endif
+
+  if (ConcurrentComponents.Num() > 0)
+  {
+    SCOPE_CYCLE_COUNTER(STAT_ExecuteConcurrentMoveIslands)
+    // The floor field is loaded lazily on first use, which must not happen on a worker thread.
+    if (GMCCVars::UseFloorField) GetFloorField();
+    for (int32 ChunkStart = 0; ChunkStart < ConcurrentComponents.Num(); ChunkStart += MAX_CONCURRENT_MOVE_ISLANDS)
+    {
+      const auto Chunk = MakeArrayView(ConcurrentComponents).Slice(
+        ChunkStart,
+        FMath::Min(MAX_CONCURRENT_MOVE_ISLANDS, ConcurrentComponents.Num() - ChunkStart)
+      );
+      ExecuteWithDeferredMovementUpdates(Chunk, Chunk.Num() - 1, [&Chunk]()
+      {
+        ParallelFor(Chunk.Num(), [&Chunk](int32 Index) { Chunk[Index]->Server_ExecuteQueuedMoveBatches(true); });
+      });
+      // The movement scopes are closed at this point, so the pawns were moved in the physics scene and dispatched their overlap and hit
+      // events in island order.
+      for (const auto Component : Chunk)
+      {
+        Component->Server_ApplyDeferredGameThreadWork();
+      }
+    }
+  }
+
+  SCOPE_CYCLE_COUNTER(STAT_ExecuteMoveIslands)
+  for (const int32 IslandIndex : SerialIslands)
+  {
+    for (const int32 Index : Islands[IslandIndex])
+    {
+      Components[Index]->Server_ExecuteQueuedMoveBatches();
+      // The results are outdated as soon as the next pawn of the island moves.
+      if (PrefetchComponents[Index]) PrefetchComponents[Index]->PrefetchedMoveQueries.bValid = false;
+    }
+  }
+}
+
+bool UGenWorldSubsystem::IsNetRelevantFor(const AGenPawn* Pawn, const AController* Viewer)
+{
+  check(Pawn)
+  check(Viewer)
+
+  if (UpdateRelevancyCache())
+  {
+    const int32* PawnIndex = RelevancyPawnIndices.Find(Pawn);
+    const int32* ViewerIndex = RelevancyViewerIndices.Find(Viewer);
+    if (PawnIndex && ViewerIndex)
+    {
+      ++NumHits;
+      INC_DWORD_STAT(STAT_RelevancyCacheHits)
+      return RelevancyBits[*PawnIndex * RelevancyViewers.Num() + *ViewerIndex];
+    }
+  }
+
+  ++NumMisses;
+  INC_DWORD_STAT(STAT_RelevancyCacheMisses)
+  FRotator ViewRotation{0};
+  FVector ViewLocation{0};
+  Viewer->GetPlayerViewPoint(ViewLocation, ViewRotation);
+  return Pawn->EvaluateNetRelevancy(Viewer, Viewer->GetPawn(), ViewLocation);
+}
+
+bool UGenWorldSubsystem::GetCachedNetRelevancy(
+  const AGenPawn* Pawn,
+  const AActor* RealViewer,
+  const AActor* ViewTarget,
+  const FVector& SrcLocation,
+  bool& bOutIsNetRelevant
+)
+{
+  if (!UpdateRelevancyCache())
+  {
+    return false;
+  }
+
+  const int32* PawnIndex = RelevancyPawnIndices.Find(Pawn);
+  const int32* ViewerIndex = RelevancyViewerIndices.Find(RealViewer);
+  if (!PawnIndex || !ViewerIndex)
+  {
+    ++NumMisses;
+    INC_DWORD_STAT(STAT_RelevancyCacheMisses)
+    return false;
+  }
+
+  // The engine may query the relevancy for a different view target (e.g. a spectated actor) or with a view location that has changed since
+  // the cache was built, in which case the cached value cannot be used.
+  const FRelevancyViewer& Viewer = RelevancyViewers[*ViewerIndex];
+  if (
+    Viewer.ViewTarget.Get() != ViewTarget
+    || FVector::DistSquared(Viewer.ViewLocation, SrcLocation) > FMath::Square(GMCCVars::RelevancyCacheViewTolerance)
+  )
+  {
+    ++NumMisses;
+    INC_DWORD_STAT(STAT_RelevancyCacheMisses)
+    return false;
+  }
+
+  ++NumHits;
+  INC_DWORD_STAT(STAT_RelevancyCacheHits)
+  bOutIsNetRelevant = RelevancyBits[*PawnIndex * RelevancyViewers.Num() + *ViewerIndex];
+  return true;
+}
+
+bool UGenWorldSubsystem::GetCachedViewPoint(const AController* Viewer, FVector& OutViewLocation, FRotator& OutViewRotation)
+{
+  if (!UpdateRelevancyCache())
+  {
+    return false;
+  }
+
+  const int32* ViewerIndex = RelevancyViewerIndices.Find(Viewer);
+  if (!ViewerIndex)
+  {
+    return false;
+  }
+  OutViewLocation = RelevancyViewers[*ViewerIndex].ViewLocation;
+  OutViewRotation = RelevancyViewers[*ViewerIndex].ViewRotation;
+  return true;
+}
+
+void UGenWorldSubsystem::DumpRelevancyCacheStats()
+{
+  const int32 NumLookups = NumHits + NumMisses;
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Relevancy cache of %s: %d pawns, %d viewers, %d grid cells | last build %.3f ms, avg build %.3f ms (%d builds) | ")
+    TEXT("%d hits, %d misses (%.1f%% hit rate)"),
+    *GetNameSafe(GetWorld()),
+    RelevancyPawnIndices.Num(),
+    RelevancyViewers.Num(),
+    RelevancyGrid.Num(),
+    LastBuildTime * 1000.,
+    NumBuilds > 0 ? TotalBuildTime * 1000. / NumBuilds : 0.,
+    NumBuilds,
+    NumHits,
+    NumMisses,
+    NumLookups > 0 ? 100.f * NumHits / NumLookups : 0.f
+  )
+
+  TotalBuildTime = 0.;
+  NumBuilds = 0;
+  NumHits = 0;
+  NumMisses = 0;
+}
+
+void UGenWorldSubsystem::DumpReplicationBandwidth()
+{
+  const auto World = GetWorld();
+  check(World)
+  const float Time = World->GetRealTimeSeconds();
+  const float Duration = LastBandwidthDumpTime >= 0.f ? Time - LastBandwidthDumpTime : 0.f;
+  LastBandwidthDumpTime = Time;
+
+  struct FConnectionBandwidth
+  {
+    int64 NumBits{0};
+    int32 NumPawnsPerTier[UGenMovementReplicationComponent::MAX_REPLICATION_LOD_TIERS + 1]{};
+  };
+  TMap<const APlayerController*, FConnectionBandwidth> Connections;
+  ForEachReplicationComponent([&](UGenMovementReplicationComponent* Component)
+  {
+    for (auto& Entry : Component->Server_BaselineStore_AutonomousProxy.Connections)
+    {
+      Connections.FindOrAdd(Entry.Key).NumBits += Entry.Value.NumBitsSent;
+      Entry.Value.NumBitsSent = 0;
+    }
+    for (auto& Entry : Component->Server_BaselineStore_SimulatedProxy.Connections)
+    {
+      auto& Bandwidth = Connections.FindOrAdd(Entry.Key);
+      Bandwidth.NumBits += Entry.Value.NumBitsSent;
+      ++Bandwidth.NumPawnsPerTier[Entry.Value.ReplicationLODTier];
+      Entry.Value.NumBitsSent = 0;
+    }
+  });
+
+  UE_LOG(LogGMCWorld, Log, TEXT("Server state bandwidth of %s over %.2f s:"), *GetNameSafe(World), Duration)
+  for (const auto& Entry : Connections)
+  {
+    const auto& Bandwidth = Entry.Value;
+    UE_LOG(
+      LogGMCWorld,
+      Log,
+      TEXT("  %s: %lld bits (%.2f kbit/s) | simulated proxies per LOD tier: %d/%d/%d/%d"),
+      *GetNameSafe(Entry.Key),
+      Bandwidth.NumBits,
+      Duration > 0.f ? Bandwidth.NumBits / (1000.f * Duration) : 0.f,
+      Bandwidth.NumPawnsPerTier[0],
+      Bandwidth.NumPawnsPerTier[1],
+      Bandwidth.NumPawnsPerTier[2],
+      Bandwidth.NumPawnsPerTier[3]
+    )
+  }
+}
+
+bool UGenWorldSubsystem::UpdateRelevancyCache()
+{
+  if (!GMCCVars::UseRelevancyCache)
+  {
+    bRelevancyCacheValid = false;
+    return false;
+  }
+
+  const auto World = GetWorld();
+  if (!World || World->GetNetMode() == NM_Client)
+  {
+    // Relevancy is only evaluated for replication on the server, clients query it directly.
+    return false;
+  }
+
+  if (!bRelevancyCacheValid || RelevancyCacheFrame != GFrameCounter)
+  {
+    BuildRelevancyCache();
+    RelevancyCacheFrame = GFrameCounter;
+    bRelevancyCacheValid = true;
+  }
+  return true;
+}
+
+void UGenWorldSubsystem::BuildRelevancyCache()
+{
+  SCOPE_CYCLE_COUNTER(STAT_BuildRelevancyCache)
+  const double StartTime = FPlatformTime::Seconds();
+
+  const auto World = GetWorld();
+  check(World)
+
+  RelevancyPawnIndices.Reset();
+  RelevancyViewerIndices.Reset();
+  RelevancyViewers.Reset();
+  RelevancyGrid.Reset();
+
+  // Query the viewpoint of every connection only once.
+  for (auto Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+  {
+    const auto Controller = Iterator->Get();
+    if (!IsValid(Controller)) continue;
+    FRelevancyViewer& Viewer = RelevancyViewers.AddDefaulted_GetRef();
+    Controller->GetPlayerViewPoint(Viewer.ViewLocation, Viewer.ViewRotation);
+    Viewer.Controller = Controller;
+    Viewer.ViewTarget = Controller->GetPawn();
+    RelevancyViewerIndices.Emplace(Controller, RelevancyViewers.Num() - 1);
+  }
+
+  // Pawns without a replication component are not part of the cache, queries for them fall back to a direct evaluation.
+  TArray<const AGenPawn*> Pawns;
+  ForEachReplicationComponent([&](UGenMovementReplicationComponent* Component)
+  {
+    const AGenPawn* Pawn = Component->GetGenPawnOwner();
+    if (!IsValid(Pawn)) return;
+    RelevancyPawnIndices.Emplace(Pawn, Pawns.Num());
+    Pawns.Emplace(Pawn);
+  });
+
+  const int32 NumViewers = RelevancyViewers.Num();
+  const int32 NumPawns = Pawns.Num();
+  RelevancyBits.Init(false, NumPawns * NumViewers);
+  DistanceBasedBits.Init(false, NumPawns * NumViewers);
+
+  // Resolve all conditions that do not depend on the viewer location first, only the remaining pairs need a distance test.
+  const bool bUseDistanceBasedRelevancy = GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy;
+  bool bNeedsDistanceTest{false};
+  float MaxCullDistanceSquared{0.f};
+  for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+  {
+    const AGenPawn* Pawn = Pawns[PawnIndex];
+    for (int32 ViewerIndex = 0; ViewerIndex < NumViewers; ++ViewerIndex)
+    {
+      const FRelevancyViewer& Viewer = RelevancyViewers[ViewerIndex];
+      const int32 BitIndex = PawnIndex * NumViewers + ViewerIndex;
+      switch (Pawn->GetNetRelevancyIgnoringDistance(Viewer.Controller.Get(), Viewer.ViewTarget.Get()))
+      {
+        case EGenNetRelevancy::Relevant:
+          RelevancyBits[BitIndex] = true;
+          break;
+        case EGenNetRelevancy::DistanceBased:
+          if (bUseDistanceBasedRelevancy)
+          {
+            DistanceBasedBits[BitIndex] = true;
+            bNeedsDistanceTest = true;
+            MaxCullDistanceSquared = FMath::Max(MaxCullDistanceSquared, Pawn->NetCullDistanceSquared);
+          }
+          else
+          {
+            RelevancyBits[BitIndex] = true;
+          }
+          break;
+        case EGenNetRelevancy::NotRelevant:
+          break;
+        default: checkNoEntry();
+      }
+    }
+  }
+
+  if (bNeedsDistanceTest)
+  {
+    // The cells are at least as large as the greatest cull distance, so every pawn that is within relevancy distance of a viewer is located
+    // in the cell of the viewer or one of its direct neighbours.
+    const float CellSize = FMath::Max(FMath::Sqrt(MaxCullDistanceSquared), MIN_RELEVANCY_CELL_SIZE);
+    for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+    {
+      RelevancyGrid.FindOrAdd(GetGridCell(Pawns[PawnIndex]->GetActorLocation(), CellSize)).Emplace(PawnIndex);
+    }
+    for (int32 ViewerIndex = 0; ViewerIndex < NumViewers; ++ViewerIndex)
+    {
+      const FVector& ViewLocation = RelevancyViewers[ViewerIndex].ViewLocation;
+      const FIntVector ViewerCell = GetGridCell(ViewLocation, CellSize);
+      for (int32 X = -1; X <= 1; ++X)
+      for (int32 Y = -1; Y <= 1; ++Y)
+      for (int32 Z = -1; Z <= 1; ++Z)
+      {
+        const auto Cell = RelevancyGrid.Find(ViewerCell + FIntVector(X, Y, Z));
+        if (!Cell) continue;
+        for (const int32 PawnIndex : *Cell)
+        {
+          const int32 BitIndex = PawnIndex * NumViewers + ViewerIndex;
+          if (DistanceBasedBits[BitIndex] && Pawns[PawnIndex]->IsWithinNetRelevancyDistance(ViewLocation))
+          {
+            RelevancyBits[BitIndex] = true;
+          }
+        }
+      }
+    }
+  }
+
+  LastBuildTime = FPlatformTime::Seconds() - StartTime;
+  TotalBuildTime += LastBuildTime;
+  ++NumBuilds;
+}
+
+void UGenWorldSubsystem::QueueSerializationCache(UGenMovementReplicationComponent* Component)
+{
+  check(Component)
+  QueuedSerializationComponents.AddUnique(Component);
+}
+
+void UGenWorldSubsystem::BuildQueuedSerializationCaches()
+{
+  if (QueuedSerializationComponents.Num() == 0) return;
+
+  TArray<UGenMovementReplicationComponent*> Components;
+  Components.Reserve(QueuedSerializationComponents.Num());
+  for (const auto& Component : QueuedSerializationComponents)
+  {
+    if (Component.IsValid()) Components.Emplace(Component.Get());
+  }
+  QueuedSerializationComponents.Reset();
+
+  if (!GMCCVars::UseSerializationCache)
+  {
+    for (const auto Component : Components)
+    {
+      Component->bServer_SerializationCacheQueued = false;
+      Component->Server_SerializationCache.Reset();
+    }
+    return;
+  }
+
+  SCOPE_CYCLE_COUNTER(STAT_BuildSerializationCaches)
+  INC_DWORD_STAT_BY(STAT_SerializationCachePawns, Components.Num())
+  ParallelFor(
+    Components.Num(),
+    [&Components](int32 Index) { Components[Index]->Server_BuildSerializationCache(); },
+    !GMCCVars::ParallelSerializationCache/*force single thread*/
+  );
+}
+
+FGenFloorField* UGenWorldSubsystem::GetFloorField()
+{
+  if (!bFloorFieldLoadAttempted)
+  {
+    bFloorFieldLoadAttempted = true;
+    const auto World = GetWorld();
+    const FString FileName = GetFloorFieldFileName();
+    if (World && IFileManager::Get().FileExists(*FileName))
+    {
+      const auto LoadedField = MakeShared<FGenFloorField>();
+      const ULevel* StaleLevel{nullptr};
+      const bool bLoaded = LoadedField->Load(FileName);
+      if (bLoaded)
+      {
+        for (const ULevel* Level : World->GetLevels())
+        {
+          if (Level && !LoadedField->IsUpToDate(Level))
+          {
+            StaleLevel = Level;
+            break;
+          }
+        }
+      }
+      if (!bLoaded)
+      {
+        UE_LOG(LogGMCWorld, Warning, TEXT("Failed to load floor field %s, the file is corrupt or outdated."), *FileName)
+      }
+      else if (StaleLevel)
+      {
+        UE_LOG(
+          LogGMCWorld,
+          Warning,
+          TEXT("Discarded floor field %s, the static geometry of level %s changed since it was baked (rebake with gmc.BakeFloorField)."),
+          *FileName,
+          *StaleLevel->GetOutermost()->GetName()
+        )
+      }
+      else
+      {
+        LoadedField->ResolveComponents(World);
+        FloorField = LoadedField;
+        UE_LOG(
+          LogGMCWorld,
+          Log,
+          TEXT("Loaded floor field %s (%d columns, %d layers)."),
+          *FileName,
+          FloorField->GetNumColumns(),
+          FloorField->GetNumLayers()
+        )
+      }
+    }
+  }
+  return FloorField.IsValid() && !FloorField->IsEmpty() ? FloorField.Get() : nullptr;
+}
+
+FString UGenWorldSubsystem::GetFloorFieldFileName() const
+{
+  const auto World = GetWorld();
+  check(World)
+  const FString MapName = FPackageName::GetShortName(UWorld::RemovePIEPrefix(World->GetOutermost()->GetName()));
+  return FPaths::ProjectContentDir() / TEXT("GMC/FloorFields") / MapName + TEXT(".gmcfloor");
+}
+
+void UGenWorldSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+  if (World != GetWorld() || !FloorField.IsValid() || !Level) return;
+  if (!FloorField->IsUpToDate(Level))
+  {
+    // Floor queries fall back to the physics scene from now on, the field is not reloaded.
+    UE_LOG(
+      LogGMCWorld,
+      Warning,
+      TEXT("Discarded floor field %s, the static geometry of level %s changed since it was baked (rebake with gmc.BakeFloorField)."),
+      *GetFloorFieldFileName(),
+      *Level->GetOutermost()->GetName()
+    )
+    FloorField.Reset();
+    return;
+  }
+  FloorField->ResolveComponents(World);
+}
+
+bool UGenWorldSubsystem::FindFloorInField(
+  const FVector& SphereCenter,
+  const FVector& LineStart,
+  float Radius,
+  float TraceLength,
+  const AActor* IgnoredActor,
+  FGenFieldFloor& OutFloor
+)
+{
+  if (!GMCCVars::UseFloorField) return false;
+  const auto Field = GetFloorField();
+  if (!Field) return false;
+  SCOPE_CYCLE_COUNTER(STAT_FindFloorInField)
+
+  FGenFloorField::FFloor Floor;
+  if (!Field->FindFloor(SphereCenter, LineStart, Radius, TraceLength, Floor)) return false;
+  const auto Component = Field->GetComponent(Floor.ComponentIndex);
+  if (!Component || !Component->IsCollisionEnabled()) return false;
+
+  // Dynamic objects are not part of the field, the volume that the traces would have swept must be free of them.
+  const auto World = GetWorld();
+  check(World)
+  const float BottomZ = FMath::Min(Floor.ImpactPoint.Z, Floor.LineImpactPoint.Z);
+  const float TopZ = FMath::Max(SphereCenter.Z, LineStart.Z);
+  const FVector TestExtent(Radius, Radius, FMath::Max(0.5f * (TopZ - BottomZ), KINDA_SMALL_NUMBER));
+  const FVector TestCenter(SphereCenter.X, SphereCenter.Y, 0.5f * (TopZ + BottomZ));
+  FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCFloorFieldDynamicTest), false, IgnoredActor);
+  if (World->OverlapAnyTestByObjectType(
+    TestCenter,
+    FQuat::Identity,
+    FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllDynamicObjects),
+    FCollisionShape::MakeBox(TestExtent),
+    QueryParams
+  ))
+  {
+    return false;
+  }
+
+  OutFloor.RestLocation = Floor.RestLocation;
+  OutFloor.ImpactPoint = Floor.ImpactPoint;
+  OutFloor.ImpactNormal = Floor.ImpactNormal;
+  OutFloor.LineImpactPoint = Floor.LineImpactPoint;
+  OutFloor.Component = Component;
+  return true;
+}
+
+void UGenWorldSubsystem::BakeFloorField(float CellSize, float Radius, float MinWalkableNormalZ)
+{
+  const auto World = GetWorld();
+  check(World)
+
+  FGenFloorField::FBakeSettings Settings;
+  Settings.CellSize = CellSize;
+  Settings.Radius = Radius;
+  Settings.MinWalkableNormalZ = MinWalkableNormalZ;
+  // Use the collision of the pawns that will query the field.
+  bool bFoundPawn{false};
+  ForEachReplicationComponent([&](UGenMovementReplicationComponent* ReplicationComponent)
+  {
+    const auto MovementComponent = Cast<UGenMovementComponent>(ReplicationComponent);
+    if (bFoundPawn || !MovementComponent || !MovementComponent->UpdatedComponent) return;
+    const EGenCollisionShape Shape = MovementComponent->GetRootCollisionShape();
+    if (Shape != EGenCollisionShape::VerticalCapsule && Shape != EGenCollisionShape::Sphere) return;
+    bFoundPawn = true;
+    if (Settings.Radius <= 0.f) Settings.Radius = MovementComponent->GetRootCollisionExtent().X;
+    Settings.TraceChannel = MovementComponent->UpdatedComponent->GetCollisionObjectType();
+  });
+  if (Settings.Radius <= 0.f)
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("Cannot bake floor field: no radius passed and no GMC pawn with a round collision found."))
+    return;
+  }
+
+  const double StartTime = FPlatformTime::Seconds();
+  const auto BakedField = MakeShared<FGenFloorField>();
+  BakedField->Bake(World, Settings);
+  const double BakeTime = FPlatformTime::Seconds() - StartTime;
+  if (BakedField->IsEmpty())
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("Cannot bake floor field: no static geometry found or the world is too large for the cell size."))
+    return;
+  }
+  FloorField = BakedField;
+  bFloorFieldLoadAttempted = true;
+
+  const FString FileName = GetFloorFieldFileName();
+  const bool bSaved = FloorField->Save(FileName);
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Baked floor field in %.2f s (cell size %.1f cm, radius %.1f cm): %d columns, %d layers, %d usable. %s %s"),
+    BakeTime,
+    Settings.CellSize,
+    Settings.Radius,
+    FloorField->GetNumColumns(),
+    FloorField->GetNumLayers(),
+    FloorField->GetNumUsableLayers(),
+    bSaved ? TEXT("Saved to") : TEXT("Failed to save to"),
+    *FileName
+  )
+}
+
+// Executes the real floor traces of @see UGenMovementComponent::UpdateFloor for a sphere.
+static void TraceFloor(
+  const UWorld* World,
+  const FVector& SphereCenter,
+  float Radius,
+  float TraceLength,
+  ECollisionChannel TraceChannel,
+  FHitResult& OutShapeHit,
+  FHitResult& OutLineHit
+)
+{
+  const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GMCTraceFloor), false);
+  World->SweepSingleByChannel(
+    OutShapeHit,
+    SphereCenter,
+    SphereCenter + FVector::DownVector * TraceLength,
+    FQuat::Identity,
+    TraceChannel,
+    FCollisionShape::MakeSphere(Radius),
+    QueryParams
+  );
+  const FVector LineStart = SphereCenter + FVector::DownVector * Radius;
+  World->LineTraceSingleByChannel(OutLineHit, LineStart, LineStart + FVector::DownVector * TraceLength, TraceChannel, QueryParams);
+}
+
+void UGenWorldSubsystem::ValidateFloorField(int32 NumSamples)
+{
+  const auto World = GetWorld();
+  check(World)
+  const auto Field = GetFloorField();
+  if (!Field)
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("The world %s has no floor field."), *GetNameSafe(World))
+    return;
+  }
+
+  TArray<FVector> Samples;
+  Field->GenerateSamples(NumSamples, 0/*seed*/, Samples);
+  const float Radius = Field->GetRadius();
+  const float TraceLength = Field->GetValidHeight() + 2.f * Radius;
+  constexpr float MaxDistanceError = 0.5f;
+  constexpr float MinNormalDot = 0.999f;
+  int32 NumAnswered{0};
+  int32 NumMismatches{0};
+  float MaxShapeError{0.f};
+  float MaxLineError{0.f};
+  for (const auto& SphereCenter : Samples)
+  {
+    const FVector LineStart = SphereCenter + FVector::DownVector * Radius;
+    FGenFieldFloor FieldFloor;
+    if (!FindFloorInField(SphereCenter, LineStart, Radius, TraceLength, nullptr, FieldFloor)) continue;
+    ++NumAnswered;
+
+    FHitResult ShapeHit;
+    FHitResult LineHit;
+    TraceFloor(World, SphereCenter, Radius, TraceLength, Field->GetTraceChannel(), ShapeHit, LineHit);
+    const float ShapeError = ShapeHit.IsValidBlockingHit() ? FMath::Abs(ShapeHit.Location.Z - FieldFloor.RestLocation.Z) : BIG_NUMBER;
+    const float LineError = LineHit.IsValidBlockingHit() ? FMath::Abs(LineHit.ImpactPoint.Z - FieldFloor.LineImpactPoint.Z) : BIG_NUMBER;
+    MaxShapeError = FMath::Max(MaxShapeError, ShapeError);
+    MaxLineError = FMath::Max(MaxLineError, LineError);
+    if (
+      ShapeError > MaxDistanceError
+      || LineError > MaxDistanceError
+      || (ShapeHit.ImpactNormal | FieldFloor.ImpactNormal) < MinNormalDot
+      || ShapeHit.GetComponent() != FieldFloor.Component
+    )
+    {
+      ++NumMismatches;
+      UE_CLOG(
+        NumMismatches <= 10,
+        LogGMCWorld,
+        Warning,
+        TEXT("Floor field mismatch at %s: field rest Z %.2f on %s, trace rest Z %.2f on %s."),
+        *SphereCenter.ToString(),
+        FieldFloor.RestLocation.Z,
+        *GetNameSafe(FieldFloor.Component),
+        ShapeHit.IsValidBlockingHit() ? ShapeHit.Location.Z : 0.f,
+        *GetNameSafe(ShapeHit.GetComponent())
+      )
+    }
+  }
+
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Validated floor field of %s: %d samples, %d answered by the field, %d mismatches (max error shape %.3f cm, line %.3f cm)."),
+    *GetNameSafe(World),
+    Samples.Num(),
+    NumAnswered,
+    NumMismatches,
+    NumAnswered > 0 ? MaxShapeError : 0.f,
+    NumAnswered > 0 ? MaxLineError : 0.f
+  )
+}
+
+void UGenWorldSubsystem::BenchmarkFloorQueries(int32 NumQueries)
+{
+  const auto World = GetWorld();
+  check(World)
+  const auto Field = GetFloorField();
+  if (!Field)
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("The world %s has no floor field."), *GetNameSafe(World))
+    return;
+  }
+
+  TArray<FVector> Samples;
+  Field->GenerateSamples(NumQueries, 0/*seed*/, Samples);
+  if (Samples.Num() == 0) return;
+  const float Radius = Field->GetRadius();
+  const float TraceLength = Field->GetValidHeight() + 2.f * Radius;
+
+  int32 NumAnswered{0};
+  const double FieldStartTime = FPlatformTime::Seconds();
+  for (const auto& SphereCenter : Samples)
+  {
+    FGenFieldFloor FieldFloor;
+    NumAnswered += FindFloorInField(SphereCenter, SphereCenter + FVector::DownVector * Radius, Radius, TraceLength, nullptr, FieldFloor);
+  }
+  const double FieldTime = FPlatformTime::Seconds() - FieldStartTime;
+
+  const double TraceStartTime = FPlatformTime::Seconds();
+  for (const auto& SphereCenter : Samples)
+  {
+    FHitResult ShapeHit;
+    FHitResult LineHit;
+    TraceFloor(World, SphereCenter, Radius, TraceLength, Field->GetTraceChannel(), ShapeHit, LineHit);
+  }
+  const double TraceTime = FPlatformTime::Seconds() - TraceStartTime;
+
+  const double FieldMicroseconds = 1.e6 * FieldTime / Samples.Num();
+  const double TraceMicroseconds = 1.e6 * TraceTime / Samples.Num();
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Floor query benchmark on %s (%d queries, %.1f%% answered by the field): field %.3f us/query, traces %.3f us/query (%.2fx)."),
+    *GetNameSafe(World),
+    Samples.Num(),
+    100.f * NumAnswered / Samples.Num(),
+    FieldMicroseconds,
+    TraceMicroseconds,
+    FieldMicroseconds > 0. ? TraceMicroseconds / FieldMicroseconds : 0.
+  )
+}
+
+void UGenWorldSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+  if (World != GetWorld()) return;
+  // All pawns have moved and their states were saved, so the queries are submitted for the transforms the next movement updates will start
+  // from. The engine executes them in parallel at the end of the frame.
+  SubmitAsyncBotQueries();
+
+  if (BotQueryBenchmark.bPending && BotQueryBenchmark.SubmitFrame != GFrameCounter)
+  {
+    FinishBotQueryBenchmark();
+  }
+  if (BotQueryBenchmark.bScheduled)
+  {
+    StartBotQueryBenchmark();
+  }
+}
+
+void UGenWorldSubsystem::SubmitAsyncBotQueries()
+{
+  if (!GMCCVars::AsyncBotQueries) return;
+  const auto& Components = GetReplicationComponents(EGenReplicationRole::ServerBot);
+  if (Components.Num() == 0) return;
+  SCOPE_CYCLE_COUNTER(STAT_SubmitAsyncBotQueries)
+
+  int32 NumSubmitted{0};
+  for (const auto ReplicationComponent : Components)
+  {
+    const auto MovementComponent = Cast<UGenMovementComponent>(ReplicationComponent);
+    if (MovementComponent && MovementComponent->bUseAsyncBotQueries)
+    {
+      NumSubmitted += MovementComponent->SubmitAsyncBotQueries();
+    }
+  }
+  INC_DWORD_STAT_BY(STAT_AsyncBotQueryPawns, NumSubmitted)
+}
+
+void UGenWorldSubsystem::BenchmarkBotQueries(int32 NumBots, float TraceLength)
+{
+  if (BotQueryBenchmark.bScheduled || BotQueryBenchmark.bPending)
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("A bot query benchmark is already running."))
+    return;
+  }
+  if (NumBots <= 0 || TraceLength <= 0.f) return;
+  BotQueryBenchmark = FBotQueryBenchmark();
+  BotQueryBenchmark.NumBots = NumBots;
+  BotQueryBenchmark.TraceLength = TraceLength;
+  BotQueryBenchmark.bScheduled = true;
+}
+
+// The floor and penetration queries of a pawn at the start of its movement update (@see UGenMovementComponent::SubmitAsyncBotQueries).
+struct FBenchmarkQueries
+{
+  FVector Location{0};
+  FVector LineStart{0};
+  FQuat Rotation{FQuat::Identity};
+  FCollisionShape Shape;
+  ECollisionChannel ObjectType{ECC_Pawn};
+  FCollisionQueryParams QueryParams;
+  FCollisionResponseParams ResponseParams;
+};
+
+// Builds the queries of the passed number of simulated pawns from the collision of the registered GMC pawns at random locations around them.
+// Returns false if there is no GMC pawn with a valid root collision.
+static bool GatherBenchmarkQueries(const UGenWorldSubsystem& Subsystem, int32 NumQueries, TArray<FBenchmarkQueries>& OutQueries)
+{
+  TArray<UGenMovementComponent*> MovementComponents;
+  Subsystem.ForEachReplicationComponent([&](UGenMovementReplicationComponent* ReplicationComponent)
+  {
+    const auto MovementComponent = Cast<UGenMovementComponent>(ReplicationComponent);
+    if (MovementComponent && MovementComponent->UpdatedPrimitive && MovementComponent->HasValidRootCollision())
+    {
+      MovementComponents.Emplace(MovementComponent);
+    }
+  });
+  if (MovementComponents.Num() == 0) return false;
+
+  // Spread the queries around the pawns so they do not all query the same geometry.
+  constexpr float MaxOffset = 1000.f;
+  FRandomStream RandomStream(0);
+  OutQueries.Reset(NumQueries);
+  for (int32 Index = 0; Index < NumQueries; ++Index)
+  {
+    const auto MovementComponent = MovementComponents[Index % MovementComponents.Num()];
+    const auto UpdatedComponent = MovementComponent->UpdatedComponent;
+    const FVector Offset(RandomStream.FRandRange(-MaxOffset, MaxOffset), RandomStream.FRandRange(-MaxOffset, MaxOffset), 0.f);
+    FBenchmarkQueries& Queries = OutQueries.Emplace_GetRef();
+    Queries.Location = UpdatedComponent->GetComponentLocation() + Offset;
+    Queries.LineStart = MovementComponent->GetLowerBound() + Offset;
+    Queries.Rotation = MovementComponent->AddGenCapsuleRotation(UpdatedComponent->GetComponentQuat()).GetNormalized();
+    Queries.Shape = MovementComponent->GetFrom(MovementComponent->GetRootCollisionShape(), MovementComponent->GetRootCollisionExtent());
+    Queries.ObjectType = UpdatedComponent->GetCollisionObjectType();
+    Queries.QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(GMCBenchmarkQueries), false, MovementComponent->GetOwner());
+    MovementComponent->UpdatedPrimitive->InitSweepCollisionParams(Queries.QueryParams, Queries.ResponseParams);
+  }
+  return true;
+}
+
+// Executes the queries synchronously. The synchronous penetration resolution moves the pawn up and down, the blocking overlap test is a
+// lower bound for its cost.
+static void ExecuteBenchmarkQueries(const UWorld* World, const FBenchmarkQueries& Queries, const FVector& TraceDelta)
+{
+  FHitResult ShapeHit;
+  FHitResult LineHit;
+  World->SweepSingleByChannel(
+    ShapeHit,
+    Queries.Location,
+    Queries.Location + TraceDelta,
+    Queries.Rotation,
+    ECC_Pawn,
+    Queries.Shape,
+    Queries.QueryParams
+  );
+  World->LineTraceSingleByChannel(LineHit, Queries.LineStart, Queries.LineStart + TraceDelta, Queries.ObjectType, Queries.QueryParams);
+  World->OverlapBlockingTestByChannel(
+    Queries.Location,
+    Queries.Rotation,
+    Queries.ObjectType,
+    Queries.Shape,
+    Queries.QueryParams,
+    Queries.ResponseParams
+  );
+}
+
+void UGenWorldSubsystem::StartBotQueryBenchmark()
+{
+  const auto World = GetWorld();
+  check(World)
+  FBotQueryBenchmark& Benchmark = BotQueryBenchmark;
+  Benchmark.bScheduled = false;
+
+  TArray<FBenchmarkQueries> Bots;
+  if (!GatherBenchmarkQueries(*this, Benchmark.NumBots, Bots))
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("Cannot benchmark bot queries: no GMC pawn with a valid root collision found."))
+    return;
+  }
+  const FVector TraceDelta = FVector::DownVector * Benchmark.TraceLength;
+
+  const double SyncStartTime = FPlatformTime::Seconds();
+  for (const auto& Bot : Bots)
+  {
+    ExecuteBenchmarkQueries(World, Bot, TraceDelta);
+  }
+  Benchmark.SyncTime = FPlatformTime::Seconds() - SyncStartTime;
+
+  Benchmark.TraceHandles.Reserve(2 * Bots.Num());
+  Benchmark.OverlapHandles.Reserve(Bots.Num());
+  const double SubmitStartTime = FPlatformTime::Seconds();
+  for (const auto& Bot : Bots)
+  {
+    Benchmark.TraceHandles.Emplace(World->AsyncSweepByChannel(
+      EAsyncTraceType::Single,
+      Bot.Location,
+      Bot.Location + TraceDelta,
+      Bot.Rotation,
+      ECC_Pawn,
+      Bot.Shape,
+      Bot.QueryParams
+    ));
+    Benchmark.TraceHandles.Emplace(World->AsyncLineTraceByChannel(
+      EAsyncTraceType::Single,
+      Bot.LineStart,
+      Bot.LineStart + TraceDelta,
+      Bot.ObjectType,
+      Bot.QueryParams
+    ));
+    Benchmark.OverlapHandles.Emplace(World->AsyncOverlapByChannel(
+      Bot.Location,
+      Bot.Rotation,
+      Bot.ObjectType,
+      Bot.Shape,
+      Bot.QueryParams,
+      Bot.ResponseParams
+    ));
+  }
+  Benchmark.SubmitTime = FPlatformTime::Seconds() - SubmitStartTime;
+  Benchmark.SubmitFrame = GFrameCounter;
+  Benchmark.bPending = true;
+}
+
+void UGenWorldSubsystem::FinishBotQueryBenchmark()
+{
+  const auto World = GetWorld();
+  check(World)
+  FBotQueryBenchmark& Benchmark = BotQueryBenchmark;
+  Benchmark.bPending = false;
+
+  int32 NumResults{0};
+  FTraceDatum TraceData;
+  FOverlapDatum OverlapData;
+  const double RetrieveStartTime = FPlatformTime::Seconds();
+  for (const auto& Handle : Benchmark.TraceHandles)
+  {
+    NumResults += World->QueryTraceData(Handle, TraceData);
+  }
+  for (const auto& Handle : Benchmark.OverlapHandles)
+  {
+    NumResults += World->QueryOverlapData(Handle, OverlapData);
+  }
+  const double RetrieveTime = FPlatformTime::Seconds() - RetrieveStartTime;
+
+  const double SyncMilliseconds = 1.e3 * Benchmark.SyncTime;
+  const double AsyncMilliseconds = 1.e3 * (Benchmark.SubmitTime + RetrieveTime);
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Bot query benchmark on %s (%d bots): sync %.3f ms, async %.3f ms on the game thread (submit %.3f ms, retrieve %.3f ms, ")
+    TEXT("%d/%d results available after %llu frame(s)) (%.2fx)."),
+    *GetNameSafe(World),
+    Benchmark.NumBots,
+    SyncMilliseconds,
+    AsyncMilliseconds,
+    1.e3 * Benchmark.SubmitTime,
+    1.e3 * RetrieveTime,
+    NumResults,
+    Benchmark.TraceHandles.Num() + Benchmark.OverlapHandles.Num(),
+    GFrameCounter - Benchmark.SubmitFrame,
+    AsyncMilliseconds > 0. ? SyncMilliseconds / AsyncMilliseconds : 0.
+  )
+  Benchmark.TraceHandles.Empty();
+  Benchmark.OverlapHandles.Empty();
+}
+
+void UGenWorldSubsystem::BenchmarkMovePhase(int32 NumPawns, int32 NumFrames, int32 MovesPerBatch)
+{
+  const auto World = GetWorld();
+  check(World)
+  if (NumPawns <= 0 || NumFrames <= 0 || MovesPerBatch <= 0) return;
+  UGenMovementComponent* Template{nullptr};
+  ForEachReplicationComponent([&](UGenMovementReplicationComponent* ReplicationComponent)
+  {
+    const auto MovementComponent = Cast<UGenMovementComponent>(ReplicationComponent);
+    if (!Template && MovementComponent && MovementComponent->HasValidRootCollision()) Template = MovementComponent;
+  });
+  if (!Template)
+  {
+    UE_LOG(LogGMCWorld, Warning, TEXT("Cannot benchmark the move phase: no GMC pawn with a valid root collision found."))
+    return;
+  }
+
+  // Execute the moves that were already queued this frame so they are not part of the measurement.
+  ProcessQueuedClientMoveBatches();
+
+  // Spread the pawns on a grid around the template with enough space between them for every pawn to form its own move island, unless the
+  // geometry pushes them together.
+  constexpr float Spacing = 1000.f;
+  const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumPawns)));
+  const FVector Origin = Template->GetGenPawnOwner()->GetActorLocation();
+  const FRotator Rotation = Template->GetGenPawnOwner()->GetActorRotation();
+  FActorSpawnParameters SpawnParameters;
+  SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+  TArray<UGenMovementReplicationComponent*> Components;
+  for (int32 Index = 0; Index < NumPawns; ++Index)
+  {
+    const FVector Offset((Index % GridSize - GridSize / 2) * Spacing, (Index / GridSize - GridSize / 2) * Spacing, 0.f);
+    const auto Pawn = World->SpawnActor<AGenPawn>(Template->GetGenPawnOwner()->GetClass(), Origin + Offset, Rotation, SpawnParameters);
+    if (!Pawn) continue;
+    const auto Component = Pawn->FindComponentByClass<UGenMovementReplicationComponent>();
+    if (!Component)
+    {
+      Pawn->Destroy();
+      continue;
+    }
+    // The synthetic timestamps do not follow the server time.
+    Component->bVerifyClientTimestamps = false;
+    Components.Emplace(Component);
+  }
+
+  // Alternate between the modes every frame so both see the same distribution of pawn states.
+  const int32 PreviousParallelMoveIslands = GMCCVars::ParallelMoveIslands;
+  FRandomStream RandomStream(0);
+  float Timestamp = World->GetTimeSeconds();
+  constexpr float MoveDeltaTime = 1.f / 60.f;
+  double Times[2]{0., 0.};
+  int32 NumIslands[2]{0, 0};
+  int32 NumConcurrentIslands{0};
+  for (int32 Frame = 0; Frame < 2 * NumFrames; ++Frame)
+  {
+    const bool bParallel = Frame % 2 == 1;
+    float BatchTimestamp{0.f};
+    for (const auto Component : Components)
+    {
+      BatchTimestamp = Timestamp;
+      auto& Moves = Component->Server_QueuedMoveBatches.AddDefaulted_GetRef().Moves;
+      for (int32 MoveIndex = 0; MoveIndex < MovesPerBatch; ++MoveIndex)
+      {
+        BatchTimestamp += MoveDeltaTime;
+        FMove& Move = Moves.Emplace_GetRef(
+          BatchTimestamp,
+          MoveDeltaTime,
+          FVector(RandomStream.FRandRange(-1.f, 1.f), RandomStream.FRandRange(-1.f, 1.f), 0.f).GetClampedToMaxSize(1.f)
+        );
+        Move.bIsBatchBase = MoveIndex == 0;
+        Move.bHasNewInputVectorX = Move.bHasNewInputVectorY = Move.bHasNewInputVectorZ = true;
+        Move.bHasNewOutLocation = true;
+        Move.bHasNewOutRotationRoll = Move.bHasNewOutRotationPitch = Move.bHasNewOutRotationYaw = true;
+        Move.bHasNewOutControlRotationRoll = Move.bHasNewOutControlRotationPitch = Move.bHasNewOutControlRotationYaw = true;
+        Move.OutLocation = Component->GetGenPawnOwner()->GetActorLocation();
+        Move.OutRotation = Move.OutControlRotation = Component->GetGenPawnOwner()->GetActorRotation();
+      }
+      QueueClientMoveBatches(Component);
+    }
+    Timestamp = BatchTimestamp;
+
+    GMCCVars::ParallelMoveIslands = bParallel;
+    const double StartTime = FPlatformTime::Seconds();
+    ProcessQueuedClientMoveBatches();
+    Times[bParallel] += FPlatformTime::Seconds() - StartTime;
+    NumIslands[bParallel] += NumLastMoveIslands;
+    if (bParallel) NumConcurrentIslands += NumLastConcurrentMoveIslands;
+  }
+  GMCCVars::ParallelMoveIslands = PreviousParallelMoveIslands;
+
+  for (const auto Component : Components)
+  {
+    Component->GetGenPawnOwner()->Destroy();
+  }
+
+  const double SerialMilliseconds = 1.e3 * Times[0] / NumFrames;
+  const double ParallelMilliseconds = 1.e3 * Times[1] / NumFrames;
+  UE_LOG(
+    LogGMCWorld,
+    Log,
+    TEXT("Move phase benchmark on %s (%d pawns of class %s, %d move(s) per batch, %d worker threads): serial %.3f ms, island-parallel ")
+    TEXT("%.3f ms per frame (%.2fx), %.1f islands per frame, %.1f of them concurrent."),
+    *GetNameSafe(World),
+    Components.Num(),
+    *GetNameSafe(Template->GetGenPawnOwner()->GetClass()),
+    MovesPerBatch,
+    FTaskGraphInterface::Get().GetNumWorkerThreads(),
+    SerialMilliseconds,
+    ParallelMilliseconds,
+    ParallelMilliseconds > 0. ? SerialMilliseconds / ParallelMilliseconds : 0.,
+    static_cast<float>(NumIslands[1]) / NumFrames,
+    static_cast<float>(NumConcurrentIslands) / NumFrames
+  )
+}
@@ -12,6 +12,7 @@
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimationAsset.h"
+#include "Async/ParallelFor.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/BoxComponent.h"
 #include "Components/BrushComponent.h"
@@ -31,6 +32,7 @@
 #include "Engine/GameEngine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/NetConnection.h"
+#include "EngineUtils.h"
 #include "Engine/PackageMapClient.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Controller.h"
@@ -54,6 +56,7 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/SphylElem.h"
 #include "PrimitiveSceneProxy.h"
+#include "Subsystems/WorldSubsystem.h"
 #include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
 #include <cmath>
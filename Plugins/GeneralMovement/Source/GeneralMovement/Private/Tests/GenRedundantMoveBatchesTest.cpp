@@ -0,0 +1,243 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "GenPawn.h"
+#include "GenCapsuleComponent.h"
+#include "GenMovementComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Number of moves that are new in every batch.
+static constexpr int32 NUM_NEW_MOVES_PER_BATCH = 2;
+// Number of already sent moves that are repeated at the start of every batch (@see UGenMovementReplicationComponent::NumRedundantMoves).
+static constexpr int32 NUM_REDUNDANT_MOVES = 4;
+static constexpr int32 NUM_BATCHES = 20;
+
+// The test drives the client send path and the server receive path of the component, which are not part of its public interface. Access
+// checks do not apply to the template arguments of explicit instantiations, so the pointers to those members can be named there and are
+// returned through a friend function that is found with the tag type.
+template<typename MemberType>
+using TGenMemberPointer = MemberType UGenMovementReplicationComponent::*;
+
+template<typename Tag, typename Tag::Type MemberPointer>
+struct TGenPrivateMember
+{
+  friend typename Tag::Type GetMember(Tag) { return MemberPointer; }
+};
+
+#define GMC_TEST_PRIVATE_MEMBER(Name, MemberType) \
+  struct F##Name##Member \
+  { \
+    using Type = TGenMemberPointer<MemberType>; \
+    friend Type GetMember(F##Name##Member); \
+  }; \
+  template struct TGenPrivateMember<F##Name##Member, &UGenMovementReplicationComponent::Name>;
+
+GMC_TEST_PRIVATE_MEMBER(bUseUnreliableMoveTransport, bool)
+GMC_TEST_PRIVATE_MEMBER(NumRedundantMoves, int32)
+GMC_TEST_PRIVATE_MEMBER(bUseServerMoveDejitterBuffer, bool)
+GMC_TEST_PRIVATE_MEMBER(bDeferServerMoveProcessing, bool)
+GMC_TEST_PRIVATE_MEMBER(bVerifyClientTimestamps, bool)
+GMC_TEST_PRIVATE_MEMBER(Client_MoveQueue, TGenRingBuffer<FMove>)
+GMC_TEST_PRIVATE_MEMBER(Client_NumPendingMoves, int32)
+GMC_TEST_PRIVATE_MEMBER(Client_PendingMoves, TArray<FMove>)
+GMC_TEST_PRIVATE_MEMBER(Client_AddRedundantMoves, void())
+GMC_TEST_PRIVATE_MEMBER(Client_DetermineValuesToSend, void())
+GMC_TEST_PRIVATE_MEMBER(Server_SendMovesUnreliable, void(const TArray<FMove>&))
+
+#undef GMC_TEST_PRIVATE_MEMBER
+
+template<typename Tag>
+static auto& Member(UGenMovementReplicationComponent* Component)
+{
+  return Component->*GetMember(Tag());
+}
+
+static void ConfigureUnreliableTransport(UGenMovementReplicationComponent* Component)
+{
+  Member<FbUseUnreliableMoveTransportMember>(Component) = true;
+  Member<FNumRedundantMovesMember>(Component) = NUM_REDUNDANT_MOVES;
+  // The server executes the moves as soon as they are received.
+  Member<FbUseServerMoveDejitterBufferMember>(Component) = false;
+  Member<FbDeferServerMoveProcessingMember>(Component) = false;
+  Member<FbVerifyClientTimestampsMember>(Component) = false;
+}
+
+// Returns the sequence of moves as recorded by the client. Values are held for a few moves at random so that the batches contain values
+// that are not serialized because they did not change.
+static TArray<FMove> GenerateClientMoves(int32 NumMoves)
+{
+  FRandomStream RandomStream(0);
+  const auto KeepOrChange = [&RandomStream](float PreviousValue, float NewValue)
+  {
+    return RandomStream.FRand() < 0.4f ? PreviousValue : NewValue;
+  };
+  TArray<FMove> Moves;
+  FMove Previous;
+  for (int32 Index = 0; Index < NumMoves; ++Index)
+  {
+    FMove& Move = Moves.AddDefaulted_GetRef();
+    Move.Timestamp = 1.f + Index / 60.f;
+    Move.InputVector.X = KeepOrChange(Previous.InputVector.X, RandomStream.FRandRange(-1.f, 1.f));
+    Move.InputVector.Y = KeepOrChange(Previous.InputVector.Y, RandomStream.FRandRange(-1.f, 1.f));
+    Move.InputVector.Z = KeepOrChange(Previous.InputVector.Z, 0.f);
+    Move.OutLocation = RandomStream.FRand() < 0.4f ? Previous.OutLocation : FVector(RandomStream.VRand() * 1000.f);
+    Move.OutRotation.Roll = KeepOrChange(Previous.OutRotation.Roll, RandomStream.FRandRange(-180.f, 180.f));
+    Move.OutRotation.Pitch = KeepOrChange(Previous.OutRotation.Pitch, RandomStream.FRandRange(-90.f, 90.f));
+    Move.OutRotation.Yaw = KeepOrChange(Previous.OutRotation.Yaw, RandomStream.FRandRange(-180.f, 180.f));
+    Move.OutControlRotation.Roll = KeepOrChange(Previous.OutControlRotation.Roll, RandomStream.FRandRange(-180.f, 180.f));
+    Move.OutControlRotation.Pitch = KeepOrChange(Previous.OutControlRotation.Pitch, RandomStream.FRandRange(-90.f, 90.f));
+    Move.OutControlRotation.Yaw = KeepOrChange(Previous.OutControlRotation.Yaw, RandomStream.FRandRange(-180.f, 180.f));
+    Previous = Move;
+  }
+  return Moves;
+}
+
+// Sends the next batch like the autonomous proxy does (@see UGenMovementReplicationComponent::TickComponent): the new moves are completed
+// in the move queue, the redundant moves are added in front of them and the values to send are determined. Returns the batch serialized
+// the same way as the parameter of the unreliable RPC.
+static TArray<uint8> SendBatch(
+  UGenMovementReplicationComponent* Client,
+  const TArray<FMove>& ClientMoves,
+  int32 BatchIndex,
+  int64& OutNumBits
+)
+{
+  // The newest move of the queue is still in progress, completing it makes it pending.
+  auto& MoveQueue = Member<FClient_MoveQueueMember>(Client);
+  for (int32 Index = 1; Index <= NUM_NEW_MOVES_PER_BATCH; ++Index)
+  {
+    MoveQueue.Add(ClientMoves[BatchIndex * NUM_NEW_MOVES_PER_BATCH + Index]);
+  }
+  Member<FClient_NumPendingMovesMember>(Client) = NUM_NEW_MOVES_PER_BATCH;
+  (Client->*GetMember(FClient_AddRedundantMovesMember()))();
+  (Client->*GetMember(FClient_DetermineValuesToSendMember()))();
+
+  auto& PendingMoves = Member<FClient_PendingMovesMember>(Client);
+  FBitWriter Writer(0, true);
+  uint32 NumMoves = PendingMoves.Num();
+  Writer.SerializeIntPacked(NumMoves);
+  for (auto& Move : PendingMoves)
+  {
+    bool bSuccess{true};
+    Move.NetSerialize(Writer, nullptr, bSuccess);
+  }
+  Member<FClient_NumPendingMovesMember>(Client) = 0;
+  PendingMoves.Reset();
+
+  OutNumBits = Writer.GetNumBits();
+  return *Writer.GetBuffer();
+}
+
+static bool ReceiveBatch(const TArray<uint8>& Data, int64 NumBits, TArray<FMove>& OutMoves)
+{
+  FBitReader Reader(const_cast<uint8*>(Data.GetData()), NumBits);
+  uint32 NumMoves{0};
+  Reader.SerializeIntPacked(NumMoves);
+  OutMoves.Reset();
+  for (uint32 Index = 0; Index < NumMoves && !Reader.IsError(); ++Index)
+  {
+    bool bSuccess{true};
+    OutMoves.AddDefaulted_GetRef().NetSerialize(Reader, nullptr, bSuccess);
+    if (!bSuccess) return false;
+  }
+  return !Reader.IsError() && Reader.AtEnd();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+  FGenRedundantMoveBatchesTest,
+  "GMC.Replication.RedundantMoveBatches",
+  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter
+)
+
+bool FGenRedundantMoveBatchesTest::RunTest(const FString& Parameters)
+{
+  // The server pawn needs a world to execute moves in.
+  UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+  FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+  WorldContext.SetCurrentWorld(World);
+  World->InitializeActorsForPlay(FURL());
+  World->BeginPlay();
+
+  AGenPawn* Pawn = World->SpawnActor<AGenPawn>();
+  UGenCapsuleComponent* Capsule = NewObject<UGenCapsuleComponent>(Pawn);
+  Pawn->SetRootComponent(Capsule);
+  Capsule->RegisterComponent();
+  UGenMovementComponent* Server = NewObject<UGenMovementComponent>(Pawn);
+  ConfigureUnreliableTransport(Server);
+  Server->RegisterComponent();
+
+  // The client only maintains its move queue and serializes the moves, which does not need a world.
+  UGenMovementComponent* Client = NewObject<UGenMovementComponent>(GetTransientPackage());
+  ConfigureUnreliableTransport(Client);
+
+  const TArray<FMove> ClientMoves = GenerateClientMoves(NUM_BATCHES * NUM_NEW_MOVES_PER_BATCH + 1);
+  auto& MoveQueue = Member<FClient_MoveQueueMember>(Client);
+  MoveQueue.Reset(ClientMoves.Num());
+  MoveQueue.Add(ClientMoves[0]);
+
+  TArray<TArray<uint8>> Batches;
+  TArray<int64> BatchBits;
+  for (int32 BatchIndex = 0; BatchIndex < NUM_BATCHES; ++BatchIndex)
+  {
+    Batches.Emplace(SendBatch(Client, ClientMoves, BatchIndex, BatchBits.AddDefaulted_GetRef()));
+  }
+
+  // Every move is contained in three consecutive batches. Dropping two batches in a row or swapping two batches still delivers every move
+  // at least once in order, but most of them arrive several times.
+  TArray<int32> DeliveryOrder;
+  for (int32 BatchIndex = 0; BatchIndex < NUM_BATCHES; ++BatchIndex)
+  {
+    switch (BatchIndex % 5)
+    {
+      // Swapped with the following batch.
+      case 0: DeliveryOrder.Append({BatchIndex + 1, BatchIndex}); break;
+      case 1: break;
+      // Dropped.
+      case 2:
+      case 3: break;
+      case 4: DeliveryOrder.Emplace(BatchIndex); break;
+    }
+  }
+  TestEqual(TEXT("The last batch is delivered"), DeliveryOrder.Last(), NUM_BATCHES - 1);
+
+  TArray<FMove> ExecutedMoves;
+  Server->OnServerPreRemoteMoveExecution.AddLambda([&ExecutedMoves](const FMove& Move) { ExecutedMoves.Emplace(Move); });
+  for (const int32 BatchIndex : DeliveryOrder)
+  {
+    TArray<FMove> ReceivedMoves;
+    const bool bReceived = ReceiveBatch(Batches[BatchIndex], BatchBits[BatchIndex], ReceivedMoves);
+    if (!TestTrue(FString::Printf(TEXT("Batch %d deserializes"), BatchIndex), bReceived))
+    {
+      break;
+    }
+    (Server->*GetMember(FServer_SendMovesUnreliableMember()))(ReceivedMoves);
+  }
+
+  // The last generated move is still in progress on the client and was never sent.
+  const int32 NumSentMoves = ClientMoves.Num() - 1;
+  if (TestEqual(TEXT("Number of executed moves"), ExecutedMoves.Num(), NumSentMoves))
+  {
+    for (int32 Index = 0; Index < NumSentMoves; ++Index)
+    {
+      // Values are compared within the accuracy of their quantization level.
+      const FMove& Sent = ClientMoves[Index];
+      const FMove& Executed = ExecutedMoves[Index];
+      const FString Context = FString::Printf(TEXT("Move %d"), Index);
+      TestEqual(Context + TEXT(" timestamp"), Executed.Timestamp, Sent.Timestamp);
+      TestTrue(Context + TEXT(" input vector"), Executed.InputVector.Equals(Sent.InputVector, 1.e-3f));
+      TestTrue(Context + TEXT(" out location"), Executed.OutLocation.Equals(Sent.OutLocation, 0.01f));
+      TestTrue(Context + TEXT(" out rotation"), Executed.OutRotation.Equals(Sent.OutRotation, 0.01f));
+      TestTrue(Context + TEXT(" out control rotation"), Executed.OutControlRotation.Equals(Sent.OutControlRotation, 0.01f));
+    }
+  }
+
+  GEngine->DestroyWorldContext(World);
+  World->DestroyWorld(false);
+  return true;
+}
+
+#endif
@@ -16,6 +16,15 @@ enum class EInputMode : uint8
   MAX UMETA(Hidden)
 };
 
+// Result of evaluating the net relevancy conditions of a pawn that do not depend on the location of the viewer.
+enum class EGenNetRelevancy : uint8
+{
+  NotRelevant,
+  Relevant,
+  // The pawn is only relevant if it is within net cull distance of the viewer.
+  DistanceBased,
+};
+
 /// Pawn class intended to be used with @see UGenMovementReplicationComponent.
 UCLASS(BlueprintType, Blueprintable)
 class GMC_API AGenPawn : public APawn
@@ -25,8 +34,25 @@ class GMC_API AGenPawn : public APawn
 public:
 
   AGenPawn();
+  /// @attention Uses the relevancy cache of @see UGenWorldSubsystem on the server if possible. Derived classes that want to add custom
+  /// relevancy conditions should override @see GetNetRelevancyIgnoringDistance instead so the cached values stay consistent.
   bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
 
+  /// Evaluates the net relevancy of the pawn directly without consulting the relevancy cache.
+  ///
+  /// @param        RealViewer     The "controlling net object" associated with the client for which relevancy is being checked.
+  /// @param        ViewTarget     The actor being used as the point of view for the real viewer.
+  /// @param        SrcLocation    The viewing location.
+  /// @returns      bool           True if the pawn is net relevant for the viewer, false otherwise.
+  bool EvaluateNetRelevancy(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const;
+
+  /// Evaluates all net relevancy conditions that do not depend on the location of the viewer.
+  ///
+  /// @param        RealViewer          The "controlling net object" associated with the client for which relevancy is being checked.
+  /// @param        ViewTarget          The actor being used as the point of view for the real viewer.
+  /// @returns      EGenNetRelevancy    Whether the pawn is relevant, not relevant or relevant depending on the distance to the viewer.
+  virtual EGenNetRelevancy GetNetRelevancyIgnoringDistance(const AActor* RealViewer, const AActor* ViewTarget) const;
+
 #if WITH_EDITOR
 
   void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
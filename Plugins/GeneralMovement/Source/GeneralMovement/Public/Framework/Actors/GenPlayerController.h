@@ -101,4 +101,12 @@ protected:
   float MaxExpectedPing{0.5f};
 
 #pragma endregion
+
+private:
+
+  /// Calls the passed function for the replication components of all pawns in the world that are not locally controlled.
+  ///
+  /// @param        Function    The function to call for each component.
+  /// @returns      void
+  void ForEachRemotelyControlledReplicationComponent(TFunctionRef<void(class UGenMovementReplicationComponent*)> Function) const;
 };
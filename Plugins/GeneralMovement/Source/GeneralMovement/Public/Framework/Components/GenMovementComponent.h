@@ -267,8 +267,32 @@ protected:
   void GenSimulatedTick(float DeltaTime);
   virtual void GenSimulatedTick_Implementation(float DeltaTime) {}
 
+  /// Hooks of this class that are dispatched with @see GMC_CALL_HOOK.
+  enum EMovementHook : uint8
+  {
+    Hook_GenReplicatedTick = NumReplicationHooks,
+    Hook_GenSimulatedTick,
+    NumMovementHooks
+  };
+
+  void CacheBlueprintHooks() override;
+
+  bool CanExecuteMovesConcurrently() const override;
+
+  /// Submits the asynchronous floor and penetration queries for the current transform of the pawn (@see bUseAsyncBotQueries). Called by
+  /// the world subsystem at the end of every frame for all server bots. The results are available during the next frame.
+  ///
+  /// @returns      bool    True if the queries were submitted, false otherwise.
+  virtual bool SubmitAsyncBotQueries();
+
 public:
 
+  DECLARE_MULTICAST_DELEGATE_OneParam(FGenTickHookDelegate, float);
+
+  /// Native counterpart of @see GenReplicatedTick, broadcast right after it without going through the Blueprint VM.
+  /// @see GenReplicatedTick 的原生对应项，在其之后立即广播，不经过蓝图虚拟机。
+  FGenTickHookDelegate OnGenReplicatedTick;
+
   /// Returns the timestamp of the move currently being executed.
   ///
   /// @returns      float    The timestamp of the current move.
@@ -287,6 +311,11 @@ public:
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
   FVector GetMoveInputVector() const;
 
+  /// Returns the input flags of the move currently being executed packed into an integer (flag 1 is bit 0).
+  ///
+  /// @returns      uint16    The input flags of the current move.
+  uint16 GetMoveInputFlags() const;
+
   /// Returns the input velocity saved in the current move. This is always the local velocity and is guaranteed to be equal to the current
   /// pawn state at the beginning of a tick.
   ///
@@ -1062,7 +1091,9 @@ public:
     ECollisionChannel CollisionChannel = ECC_Pawn
   ) const;
 
-  /// Tries to get the pawn unstuck by applying a very small location delta up and down to resolve the penetration.
+  /// Tries to get the pawn unstuck by applying a very small location delta up and down to resolve the penetration. Server bots skip this if
+  /// the asynchronous overlap test submitted at the end of the last frame found nothing to resolve (@see bUseAsyncBotQueries), remote server
+  /// pawns if the overlap test prefetched during the deferred server move phase did (@see PrefetchMoveQueries).
   ///
   /// @returns      FHitResult    The hit result of the downward sweep.
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
@@ -1138,8 +1169,15 @@ public:
   UFUNCTION(BlueprintCallable, BlueprintPure, Category = "General Movement Component")
   static FVector GetPlaneNormalWithWorldZ(const FVector& Direction);
 
-  /// Does a shape trace of the current root collision downward to update the floor parameters.
-  /// 向下跟踪当前根碰撞的形状以更新地板参数。
+  /// Does a shape trace of the current root collision downward to update the floor parameters. The result is reused within the same move if
+  /// the pawn did not move (@see InvalidateFloorCache), and over static geometry it is taken from the baked floor field of the world if
+  /// there is one (@see UGenWorldSubsystem::FindFloorInField). Server bots can take it from asynchronous queries submitted at the end of the
+  /// last frame (@see bUseAsyncBotQueries), and remote server pawns from queries prefetched in parallel during the deferred server move phase
+  /// (@see UGenMovementReplicationComponent::bDeferServerMoveProcessing).
+  /// 向下跟踪当前根碰撞的形状以更新地板参数。如果 pawn 没有移动，结果会在同一次移动中被重用（@see InvalidateFloorCache），
+  /// 在静态几何体上方时，如果世界有烘焙的地板场，结果将从中获取（@see UGenWorldSubsystem::FindFloorInField）。服务器 bot
+  /// 可以从上一帧结束时提交的异步查询中获取结果（@see bUseAsyncBotQueries），远程服务器 pawn 可以从延迟服务器移动阶段中并行预取的
+  /// 查询中获取结果（@see UGenMovementReplicationComponent::bDeferServerMoveProcessing）。
   ///
   /// @param        Floor          The floor parameters to update.
   ///							   要更新的地板参数。
@@ -1150,6 +1188,27 @@ public:
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
   virtual bool UpdateFloor(UPARAM(ref) FFloorParams& Floor, float TraceLength);
 
+  /// Discards the result of the last floor query so the next call to @see UpdateFloor traces again. The cache is already cleared at the
+  /// start of every move, call this when the geometry underneath the pawn changes during a move execution without moving the floor
+  /// component itself (e.g. when spawning an actor below the pawn).
+  /// 丢弃上次地板查询的结果，以便下一次调用 @see UpdateFloor 时重新进行追踪。缓存在每次移动开始时已被清除，当地板组件本身
+  /// 未移动但 pawn 下方的几何体在移动执行期间发生变化时（例如在 pawn 下方生成一个 actor）调用此函数。
+  ///
+  /// @returns      void
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component")
+  virtual void InvalidateFloorCache();
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "General Movement Component")
+  /// If true and the pawn is controlled by AI on the server, the floor and penetration queries for the start of its next movement update
+  /// are submitted asynchronously together with those of all other bots at the end of every frame (@see UGenWorldSubsystem). The results
+  /// are used by @see UpdateFloor and @see AutoResolvePenetration if the pawn has not moved in between, otherwise the queries are executed
+  /// synchronously as usual.
+  /// @attention The results are one frame old, objects that moved underneath or into the pawn since then are only detected by the
+  /// following movement update. Floors are only taken from the results if they have static or stationary mobility.
+  /// 如果为 true 且 pawn 在服务器上由 AI 控制，则其下一次移动更新开始时的地板和穿透查询会在每帧结束时与所有其他 bot 的查询一起
+  /// 异步提交。如果 pawn 在此期间没有移动，结果将由 UpdateFloor 和 AutoResolvePenetration 使用，否则照常同步执行查询。
+  bool bUseAsyncBotQueries{false};
+
   /// Checks if a given point is closer to the collision center than the tolerance allows. Usually used to discard hits that are very close
   /// to the edge of the vertical portion of the collision shape.
   ///
@@ -1494,6 +1553,8 @@ private:
   /// The current input vector.
   /// 当前输入向量。
   FVector InputVector{0};
+  /// The input flags of the current move.
+  uint16 InputFlags{0};
   /// The input values saved in the current move.
   /// 当前移动中保存的输入值。
   FVector InVelocity{0};
@@ -1538,6 +1599,94 @@ private:
   /// Whether we are currently within a sub-stepped iteration of a move execution.
   /// 我们当前是否处于移动执行的分步迭代中。
   bool bIsSubSteppedMoveIteration{false};
+
+  /// The result of the last floor query together with everything it depends on.
+  struct FFloorQueryCache
+  {
+    FFloorParams Floor;
+    float TraceLength{0.f};
+    FVector Location{0};
+    FQuat Rotation{FQuat::Identity};
+    EGenCollisionShape CollisionShape{EGenCollisionShape::Invalid};
+    FVector CollisionExtent{0};
+    TWeakObjectPtr<UPrimitiveComponent> ShapeHitComponent;
+    TWeakObjectPtr<UPrimitiveComponent> LineHitComponent;
+    FTransform ShapeHitTransform;
+    FTransform LineHitTransform;
+    bool bValid{false};
+  };
+  FFloorQueryCache FloorQueryCache;
+
+  /// Stores the result of a floor query in @see FloorQueryCache.
+  void CacheFloor(const FFloorParams& Floor, float TraceLength);
+
+  /// Returns true if the cached floor is still valid for the current transform of the updated component and writes it to "Floor". The
+  /// pawn may only have moved straight down by less than the distance to the cached hits.
+  bool FindCachedFloor(FFloorParams& Floor, float TraceLength) const;
+
+  /// Returns true if the floor could be determined from the baked floor field of the world and writes it to "Floor"
+  /// (@see UGenWorldSubsystem::FindFloorInField). Only pawns with a sphere or upright vertical capsule collision can use the field.
+  bool FindFloorInField(FFloorParams& Floor, float TraceLength);
+
+  /// The asynchronous queries that were submitted for the transform of the pawn at the end of the last frame
+  /// (@see SubmitAsyncBotQueries).
+  struct FAsyncBotQueries
+  {
+    FTraceHandle ShapeHandle;
+    FTraceHandle LineHandle;
+    FTraceHandle OverlapHandle;
+    FVector Location{0};
+    FQuat Rotation{FQuat::Identity};
+    EGenCollisionShape CollisionShape{EGenCollisionShape::Invalid};
+    FVector CollisionExtent{0};
+    float TraceLength{0.f};
+    uint64 Frame{0};
+    bool bValid{false};
+  };
+  FAsyncBotQueries AsyncBotQueries;
+
+  /// Whether the results of the async queries are available and the pawn has not moved since they were submitted.
+  bool MatchesAsyncBotQueries() const;
+
+  /// Returns true if the floor could be determined from the results of the async queries and writes it to "Floor".
+  bool FindFloorFromAsyncBotQueries(FFloorParams& Floor, float TraceLength);
+
+  /// Returns true if the async overlap test found no blocking geometry at the current transform of the pawn.
+  bool IsClearOfPenetrationByAsyncBotQueries() const;
+
+  /// The results of the floor and penetration queries that were executed for the transform of the pawn ahead of its queued client moves
+  /// during the deferred server move phase of the current frame (@see PrefetchMoveQueries).
+  struct FPrefetchedMoveQueries
+  {
+    FHitResult ShapeHit;
+    FHitResult LineHit;
+    FVector Location{0};
+    FQuat Rotation{FQuat::Identity};
+    EGenCollisionShape CollisionShape{EGenCollisionShape::Invalid};
+    FVector CollisionExtent{0};
+    float TraceLength{0.f};
+    bool bClearOfPenetration{false};
+    bool bValid{false};
+  };
+  FPrefetchedMoveQueries PrefetchedMoveQueries;
+
+  /// Executes the floor and penetration queries for the current transform of the pawn synchronously and stores the results in
+  /// @see PrefetchedMoveQueries. Only reads from the pawn and the physics scene, so it is safe to call for different components from
+  /// different threads while nothing is moving. Called by the world subsystem for the first pawn of every move island.
+  ///
+  /// @returns      bool    True if the queries were executed, false otherwise.
+  bool PrefetchMoveQueries();
+
+  /// Whether the pawn has not moved since the prefetched queries were executed.
+  bool MatchesPrefetchedMoveQueries() const;
+
+  /// Returns true if the floor could be determined from the prefetched queries and writes it to "Floor".
+  bool FindFloorFromPrefetchedMoveQueries(FFloorParams& Floor, float TraceLength);
+
+  /// Returns true if the prefetched overlap test found no blocking geometry at the current transform of the pawn.
+  bool IsClearOfPenetrationByPrefetchedMoveQueries() const;
+
+  friend class UGenWorldSubsystem;
 };
 
 FORCEINLINE float UGenMovementComponent::GetMoveTimestamp() const
@@ -1555,6 +1704,11 @@ FORCEINLINE FVector UGenMovementComponent::GetMoveInputVector() const
   return InputVector;
 }
 
+FORCEINLINE uint16 UGenMovementComponent::GetMoveInputFlags() const
+{
+  return InputFlags;
+}
+
 FORCEINLINE FVector UGenMovementComponent::GetTransientAcceleration() const
 {
   return Acceleration;
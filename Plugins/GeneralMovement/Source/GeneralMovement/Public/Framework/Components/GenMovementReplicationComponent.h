@@ -4,11 +4,26 @@
 #include "GMC_PCH.h"
 #include "GenPawn.h"
 #include "PrereplicatedData.h"
+#include "GenRingBuffer.h"
+#include "GenBoundSlots.h"
+#include "GenWorldSubsystem.h"
 #include "GenMovementReplicationComponent.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGMCReplication, Log, All);
 
 DECLARE_STATS_GROUP(TEXT("GMCReplicationComponent_Game"), STATGROUP_GMCReplicationComp, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Blueprint Hooks"), STAT_BlueprintHooks, STATGROUP_GMCReplicationComp, GMC_API);
+
+/// Calls a Blueprint native event hook of the move pipeline. The call only goes through the Blueprint VM if the hook is overridden in
+/// Blueprint, otherwise the native implementation is called directly (@see UGenMovementReplicationComponent::CacheBlueprintHooks). Must be
+/// used from within a member function of the component, "Hook_<Name>" has to be declared for the hook.
+#define GMC_CALL_HOOK(Hook, ...)\
+  (IsBlueprintHook(Hook_##Hook)\
+    ? [&]() { SCOPE_CYCLE_COUNTER(STAT_BlueprintHooks) return Hook(__VA_ARGS__); }()\
+    : Hook##_Implementation(__VA_ARGS__))
+
+/// Caches whether a Blueprint native event hook of the passed class is overridden in Blueprint (@see GMC_CALL_HOOK).
+#define GMC_CACHE_BLUEPRINT_HOOK(Class, Hook) CacheBlueprintHook(Hook_##Hook, GET_FUNCTION_NAME_CHECKED(Class, Hook))
 
 UENUM()
 enum class ESizeQuantization : uint8
@@ -27,6 +42,39 @@ enum class EDecimalQuantization : uint8
   None,
 };
 
+USTRUCT(BlueprintType)
+/// A replication level of detail for simulated proxies (@see UGenMovementReplicationComponent::ReplicationLODTiers). The tier is chosen for
+/// every connection individually based on the distance between the pawn and the view point of the connection.
+/// 模拟代理的复制细节级别。根据 pawn 与连接视点之间的距离为每个连接单独选择层级。
+struct GMC_API FReplicationLODTier
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD", meta = (ClampMin = "0", UIMin = "0"))
+  /// The distance (cm) from the view point of a connection at which the tier starts.
+  float MinDistance{5000.f};
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD", meta = (ClampMin = "0", UIMin = "0", UIMax = "1"))
+  /// The minimum time (s) between two server states sent to a connection within this tier. 0 means every update is sent.
+  float UpdateInterval{0.1f};
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD")
+  /// How strongly the location of the pawn should be compressed within this tier.
+  EDecimalQuantization LocationQuantize{EDecimalQuantization::RoundOneDecimal};
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD")
+  /// How strongly the velocity of the pawn should be compressed within this tier.
+  EDecimalQuantization VelocityQuantize{EDecimalQuantization::RoundOneDecimal};
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD")
+  /// How strongly the rotation of the pawn should be compressed within this tier.
+  ESizeQuantization RotationQuantize{ESizeQuantization::Short};
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Replication LOD")
+  /// How strongly the control rotation of the pawn should be compressed within this tier.
+  ESizeQuantization ControlRotationQuantize{ESizeQuantization::Short};
+};
+
 USTRUCT(BlueprintType)
 struct GMC_API FMove
 {
@@ -59,27 +107,27 @@ struct GMC_API FMove
 	// 输入向量是从控制器接收到的移动方向（例如，来自 WASD 或左模拟摇杆），控制旋转是控制器视图（例如，来自鼠标或右模拟摇杆）。
 	// 旋转是actor的根组件方向。 输入标志是布尔输入，通常用于可触发的能力（例如冲刺或闪避）。
 	FVector InputVector{0};
-	bool bInputFlag1{false};
-	bool bInputFlag2{false};
-	bool bInputFlag3{false};
-	bool bInputFlag4{false};
-	bool bInputFlag5{false};
-	bool bInputFlag6{false};
-	bool bInputFlag7{false};
-	bool bInputFlag8{false};
-	bool bInputFlag9{false};
-	bool bInputFlag10{false};
-	bool bInputFlag11{false};
-	bool bInputFlag12{false};
-	bool bInputFlag13{false};
-	bool bInputFlag14{false};
-	bool bInputFlag15{false};
-	bool bInputFlag16{false};
 	FVector InVelocity{0};
 	FVector InLocation{0};
 	FRotator InRotation{0};
 	FRotator InControlRotation{0};
 	EInputMode InInputMode{0};
+	uint8 bInputFlag1 : 1;
+	uint8 bInputFlag2 : 1;
+	uint8 bInputFlag3 : 1;
+	uint8 bInputFlag4 : 1;
+	uint8 bInputFlag5 : 1;
+	uint8 bInputFlag6 : 1;
+	uint8 bInputFlag7 : 1;
+	uint8 bInputFlag8 : 1;
+	uint8 bInputFlag9 : 1;
+	uint8 bInputFlag10 : 1;
+	uint8 bInputFlag11 : 1;
+	uint8 bInputFlag12 : 1;
+	uint8 bInputFlag13 : 1;
+	uint8 bInputFlag14 : 1;
+	uint8 bInputFlag15 : 1;
+	uint8 bInputFlag16 : 1;
 
 	// Output values. These are the results of the move execution i.e. the output of the movement logic. The server calculates those values
 	// from the input as well, but may use the out location/rotation/control rotation (depending on the settings) sent by the client to
@@ -95,17 +143,21 @@ struct GMC_API FMove
 	// Used on the client to indicate that a value has changed and needs to be serialized, and on the server to indicate that a new value was
 	// received and deserialized.
 	// 用在客户端表示某个值发生了变化需要序列化，用在服务端表示接收到一个新的值并反序列化。
-	bool bHasNewInputVectorX{false};
-	bool bHasNewInputVectorY{false};
-	bool bHasNewInputVectorZ{false};
-	bool bHasNewOutVelocity{false};
-	bool bHasNewOutLocation{false};
-	bool bHasNewOutRotationRoll{false};
-	bool bHasNewOutRotationPitch{false};
-	bool bHasNewOutRotationYaw{false};
-	bool bHasNewOutControlRotationRoll{false};
-	bool bHasNewOutControlRotationPitch{false};
-	bool bHasNewOutControlRotationYaw{false};
+	uint8 bHasNewInputVectorX : 1;
+	uint8 bHasNewInputVectorY : 1;
+	uint8 bHasNewInputVectorZ : 1;
+	uint8 bHasNewOutVelocity : 1;
+	uint8 bHasNewOutLocation : 1;
+	uint8 bHasNewOutRotationRoll : 1;
+	uint8 bHasNewOutRotationPitch : 1;
+	uint8 bHasNewOutRotationYaw : 1;
+	uint8 bHasNewOutControlRotationRoll : 1;
+	uint8 bHasNewOutControlRotationPitch : 1;
+	uint8 bHasNewOutControlRotationYaw : 1;
+
+	// Whether this move starts a new batch of moves sent to the server. The first move of a batch is serialized in full, all following moves
+	// are encoded relative to the previous move of the same batch (@see FMove::NetSerialize). Set by the client before sending.
+	uint8 bIsBatchBase : 1;
 
 	// Serialization and compression options. Cannot be changed at runtime because moves are sent via RPC argument from client to server.
 	// Custom settings can be implemented for individual classes by implementing a derived struct and reconfiguring the replication options
@@ -143,20 +195,40 @@ struct GMC_API FMove
 	EDecimalQuantization OutLocationQuantize{EDecimalQuantization::RoundTwoDecimals};
 	ESizeQuantization OutRotationQuantize{ESizeQuantization::Short};
 	ESizeQuantization OutControlRotationQuantize{ESizeQuantization::Short};
-	bool bSerializeInputVectorX{true};
-	bool bSerializeInputVectorY{true};
-	bool bSerializeInputVectorZ{true};
-	bool bSerializeOutVelocity{false}; // Not used, keep disabled.
-	bool bSerializeOutLocation{true};
-	bool bSerializeOutRotationRoll{true};
-	bool bSerializeOutRotationPitch{true};
-	bool bSerializeOutRotationYaw{true};
-	bool bSerializeOutControlRotationRoll{true};
-	bool bSerializeOutControlRotationPitch{true};
-	bool bSerializeOutControlRotationYaw{true};
-	int32 NumSerializedInputFlags{16};
-
-	FMove() = default;
+	uint8 bSerializeInputVectorX : 1;
+	uint8 bSerializeInputVectorY : 1;
+	uint8 bSerializeInputVectorZ : 1;
+	uint8 bSerializeOutVelocity : 1; // Not used, keep disabled.
+	uint8 bSerializeOutLocation : 1;
+	uint8 bSerializeOutRotationRoll : 1;
+	uint8 bSerializeOutRotationPitch : 1;
+	uint8 bSerializeOutRotationYaw : 1;
+	uint8 bSerializeOutControlRotationRoll : 1;
+	uint8 bSerializeOutControlRotationPitch : 1;
+	uint8 bSerializeOutControlRotationYaw : 1;
+	uint8 NumSerializedInputFlags{16};
+	// When enabled, the out location, rotation and control rotation are not sent to the server. Instead, the move carries a hash of these
+	// values (@see OutStateHash) quantized with the levels configured above, which the server compares against the hash of its own result.
+	// A mismatch marks the move as invalid and the server sends a full correction. The bSerializeOut* flags still determine which components
+	// are part of the hash.
+	// @attention Cannot be used together with the options to use the client location, rotation or control rotation on the server.
+	// @attention The hash only matches if both results round to exactly the same value, there is no tolerance. A component that lies close to
+	// a boundary of the quantization grid can round differently on the client and the server even when the results differ by much less than
+	// the grid spacing, which causes a correction the explicit out values would not have caused. Coarser quantization levels make this less
+	// likely (mismatches are counted by the "Out State Hash Mismatches" stat).
+	// 启用后，输出位置、旋转和控制旋转不会发送到服务器。相反，移动携带这些值的哈希值（@see OutStateHash），这些值使用上面配置的级别进行量化，
+	// 服务器将其与自己结果的哈希值进行比较。不匹配会将移动标记为无效，服务器会发送完整的校正。bSerializeOut* 标志仍然决定哪些分量是哈希的一部分。
+	// 注意：哈希没有容差，只有当两个结果舍入到完全相同的值时才匹配。靠近量化网格边界的分量即使在客户端和服务器之间的差异远小于网格间距，也可能舍入到
+	// 不同的值，从而导致显式发送输出值时不会发生的校正。较粗的量化级别可以减少这种情况。
+	uint8 bSerializeOutStateHash : 1;
+
+	// Hash of the quantized out state of the move (@see bSerializeOutStateHash, @see ComputeOutStateHash).
+	uint32 OutStateHash{0};
+
+	// @attention The flags above are packed into bitfields to keep the move compact (moves are copied into the move queue, into every batch
+	// sent to the server and for every move execution). Bitfields cannot have default member initializers, their defaults are set here.
+	// 上面的标志被打包到位域中以保持移动紧凑。位域不能有默认成员初始化器，它们的默认值在这里设置。
+	FMove() { InitializeFlags(); }
 	FMove(
 	float Timestamp,
 	float DeltaTime = 0.f,
@@ -185,13 +257,19 @@ struct GMC_API FMove
 	);
 
 	bool IsValid() const { return Timestamp >= 0.f; }
+	void InitializeFlags();
+	// Returns the input flags packed into the lower bits of an integer (flag 1 is bit 0).
+	uint16 GetInputFlags() const;
 	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+	bool SerializeTimestamp(FArchive& Ar);
 	bool SerializeInputVector(FArchive& Ar);
 	void SerializeInputFlags(FArchive& Ar);
 	bool SerializeOutVelocity(FArchive& Ar);
 	bool SerializeOutLocation(FArchive& Ar);
 	void SerializeOutRotation(FArchive& Ar);
 	void SerializeOutControlRotation(FArchive& Ar);
+	void SerializeOutStateHash(FArchive& Ar);
+	uint32 ComputeOutStateHash(const FVector& Location, const FRotator& Rotation, const FRotator& ControlRotation) const;
 	void QuantizeInputVector();
 	void QuantizeOutVelocity();
 	void QuantizeOutLocation();
@@ -214,7 +292,6 @@ struct GMC_API FStateReduced
 {
   GENERATED_BODY()
 
-  bool bReplicatedToSimulatedProxy{false};
   bool bWasNetRelevantLastFrame{false};
   bool bForceFullSerializationOnNextUpdate{false};
 
@@ -230,6 +307,85 @@ struct GMC_API FStateReduced
   DEFINE_PREREPLICATED_DATA_FSTATEREDUCED()
 };
 
+/// Entry of @see FConnectionBaseline::ReplicatedStates.
+struct FReplicatedStateRecord
+{
+  /// Timestamp of the state queue entry that was replicated.
+  float Timestamp{-1.f};
+};
+
+USTRUCT()
+struct GMC_API FConnectionBaseline
+{
+  GENERATED_BODY()
+
+  UPROPERTY()
+  // The data that was last serialized for this connection.
+  FStateReduced LastSerialized;
+
+  // Timestamps of the state queue entries that were replicated to this connection as a simulated proxy (ascending). Only used on the server
+  // for rollback.
+  TGenRingBuffer<FReplicatedStateRecord> ReplicatedStates;
+
+  // Connections of the same pawn with the same group have received exactly the same sequence of serialized states, meaning their last
+  // serialized data is identical and they will be sent the same bits for the next state as well (@see FSerializationCacheEntry). Group 0
+  // designates a connection that has not been serialized to yet.
+  uint32 SerializationGroup{0};
+
+  // The replication LOD tier of the connection for the current frame (0 is the full detail level) and whether the connection is not due for
+  // an update this frame (@see UGenMovementReplicationComponent::Server_UpdateReplicationLOD). Only used for simulated proxies.
+  uint8 ReplicationLODTier{0};
+  bool bSkipReplicationLODUpdate{false};
+
+  // Timestamp of the last server state that was sent to this connection as a simulated proxy.
+  float LastReplicationLODTimestamp{-1.f};
+
+  // Number of bits of server state data that were serialized for this connection since the last bandwidth dump
+  // (@see UGenWorldSubsystem::DumpReplicationBandwidth).
+  int64 NumBitsSent{0};
+};
+
+/// Entry of @see UGenMovementReplicationComponent::Server_SerializationCache. Holds the serialized simulated proxy server state for all
+/// connections of one serialization group.
+struct FSerializationCacheEntry
+{
+  /// The serialization group of the connections the entry applies to.
+  uint32 SourceGroup{0};
+
+  /// Whether the entry applies to connections that are due for a full serialization.
+  bool bForceFullSerialization{false};
+
+  /// The replication LOD tier of the connections the entry applies to.
+  uint8 ReplicationLODTier{0};
+
+  /// The serialization group of the connections after the cached bits were sent to them.
+  uint32 ResultGroup{0};
+
+  /// The serialized state.
+  TArray<uint8> Bits;
+  int64 NumBits{0};
+
+  /// The estimated (not measured) size of the state without the dirty mask (@see FState::SerializeStateData).
+  int64 EstimatedBitsWithoutDirtyMask{0};
+
+  /// The last serialized data of the connections after the cached bits were sent to them.
+  FStateReduced Result;
+};
+
+USTRUCT()
+struct GMC_API FSerializationBaselineStore
+{
+  GENERATED_BODY()
+
+  UPROPERTY(NotReplicated/*Stop UHT from complaining about TMaps not being supported for replication.*/)
+  // Used on the server to determine if a value has changed since the last replication update. Values are only replicated fully if they have
+  // changed since the last serialization to save bandwidth. If a value has not changed only one bit is sent to indicate to the client that
+  // the value from the last update should be used again. We map server-client connections (represented through player controllers on the
+  // server) to state data for each pawn. For autonomous proxies there's only one connection to replicate to, but one server pawn can
+  // potentially replicate to multiple simulated proxies so we need to manage the last serialized data for each connection individually.
+  TMap<APlayerController*, FConnectionBaseline> Connections;
+};
+
 USTRUCT(BlueprintType)
 struct GMC_API FState
 {
@@ -333,6 +489,15 @@ struct GMC_API FState
 	ESizeQuantization RotationQuantize{ESizeQuantization::Short};
 	ESizeQuantization ControlRotationQuantize{ESizeQuantization::Short};
 
+	// The quantization levels of the replication LOD tiers where index 0 holds the full detail levels from above. Only set for the simulated
+	// proxy server state if the replication component has LOD tiers configured, in which case the tier is serialized with every state and the
+	// quantization levels above are switched to the ones of the tier during (de)serialization (@see SerializeReplicationLODTier).
+	// 复制 LOD 层级的量化级别，索引 0 为上面的完整细节级别。仅当复制组件配置了 LOD 层级时才为模拟代理服务器状态设置。
+	const TArray<FReplicationLODTier>* ReplicationLODLevels{nullptr};
+
+	// The replication LOD tier the state is currently (de)serialized with.
+	uint8 CurrentReplicationLODTier{0};
+
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadWrite, DisplayName = "Replicate Timestamp", Category = "Replication", meta =
 		(Tooltip = "Whether the timestamp of the server state should be replicated.\n是否应复制服务器状态的时间戳."))
 	bool bSerializeTimestamp{true};
@@ -393,13 +558,13 @@ struct GMC_API FState
   // Designates the current target client connection during net serialization.
   APlayerController* CurrentTargetConnection{nullptr};
 
-  UPROPERTY(NotReplicated/*Stop UHT from complaining about TMaps not being supported for replication.*/)
-  // Used on the server to determine if a value has changed since the last replication update. Values are only replicated fully if they have
-  // changed since the last serialization to save bandwidth. If a value has not changed only one bit is sent to indicate to the client that
-  // the value from the last update should be used again. We map server-client connections (represented through player controllers on the
-  // server) to state data for each pawn. For autonomous proxies there's only one connection to replicate to, but one server pawn can
-  // potentially replicate to multiple simulated proxies so we need to manage the last serialized data for each connection individually.
-  TMap<APlayerController*, FStateReduced> LastSerialized;
+  // Handle to the per-connection serialization baselines of the owning replication component (@see FSerializationBaselineStore). The
+  // baselines are kept outside of the state so that copying a state (e.g. into the state queue) does not copy them as well. Assigned
+  // together with the owner for the server states of the replication component.
+  FSerializationBaselineStore* BaselineStore{nullptr};
+
+  // The baseline of the current target connection, resolved from the store at the start of net serialization.
+  FStateReduced* CurrentBaseline{nullptr};
 
   // Used on the client to discern if a new value was received.
   bool bReadNewVelocity{false};
@@ -412,10 +577,25 @@ struct GMC_API FState
   bool bReadNewControlRotationYaw{false};
   bool bReadNewInputMode{false};
 
+  // Groups of delta-serialized values for the dirty mask that precedes the state data (@see SerializeDirtyMask). A group that is clean for
+  // the current target connection is skipped entirely, including the change flags of its members.
+  enum EDirtyGroup : uint8
+  {
+    DirtyVelocity        = 0x01,
+    DirtyInputMode       = 0x02,
+    DirtyBoundData       = 0x04,
+    DirtyLocation        = 0x08,
+    DirtyRotation        = 0x10,
+    DirtyControlRotation = 0x20,
+  };
+
   FState() = default;
 
   bool IsValid() const { return Timestamp >= 0.f; }
   bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+  int64 SerializeStateData(FArchive& Ar, bool& bOutSuccess);
+  bool SerializeReplicationLODTier(FArchive& Ar);
+  void ApplyReplicationLODLevels(uint8 Tier);
   bool SerializeLocation(FArchive& Ar);
   bool SerializeVelocity(FArchive& Ar);
   void SerializeRotation(FArchive& Ar);
@@ -424,6 +604,13 @@ struct GMC_API FState
   void SerializeBoundData(FArchive& Ar);
   void SerializeMoveValidation(FArchive& Ar);
   void SerializeInputMode(FArchive& Ar);
+  void SerializeRawBoundData(FArchive& Ar);
+  uint8 SerializeDirtyMask(FArchive& Ar);
+  uint8 GetEnabledDirtyGroups() const;
+  uint8 GetChangedDirtyGroups(uint8 EnabledGroups) const;
+  void MarkGroupsUnchanged(uint8 CleanGroups);
+  int32 CountReplicatedBoundData() const;
+  bool HasBoundDataChanged() const;
   void QuantizeVelocity();
   void QuantizeLocation();
   void QuantizeRotation();
@@ -433,7 +620,6 @@ struct GMC_API FState
   // Specialized net serialization functions for bound data.
   void SerializeBoolTypes(FArchive& Ar);
   void SerializeHalfByteTypes(FArchive& Ar);
-  void SerializeVectorTypes(FArchive& Ar);
   void SerializeNormalTypes(FArchive& Ar);
   void SerializeRotatorTypes(FArchive& Ar);
 };
@@ -446,6 +632,9 @@ template <>struct TStructOpsTypeTraits<FState> : public TStructOpsTypeTraitsBase
   };
 };
 
+// Compile-time slot tables mapping the bound data members of FMove, FState and FStateReduced (@see TGenBoundSlots).
+DEFINE_PREREPLICATED_DATA_SLOT_TRAITS()
+
 UENUM(BlueprintType)
 enum class EImmediateContext : uint8
 {
@@ -458,6 +647,7 @@ enum class EImmediateContext : uint8
   LocalClientPawnExecutingReplicatedMove UMETA(DisplayName = "LocalClientPawnExecutingReplicatedMove"),
   LocalClientPawnExecutingDiscardedMove UMETA(DisplayName = "LocalClientPawnExecutingDiscardedMove"),
   LocalClientPawnReplayingMove UMETA(DisplayName = "LocalClientPawnReplayingMove"),
+  LocalClientPawnSkippingReplay UMETA(DisplayName = "LocalClientPawnSkippingReplay"),
   MAX UMETA(Hidden),
 };
 
@@ -500,11 +690,14 @@ enum class ENetworkPreset : uint8
 /// Synchronises location, actor rotation, control rotation and velocity across server and clients for any owning actor. Subclasses can
 /// implement replicated movement logic by binding new variables to special data members, which integrates them automatically into the
 /// client-replay and the interpolation algorithm.
+DECLARE_MULTICAST_DELEGATE_OneParam(FGenMoveHookDelegate, const FMove&);
+
 UCLASS(ABSTRACT, ClassGroup = "Movement", BlueprintType, NotBlueprintable)
 class GMC_API UGenMovementReplicationComponent : public UPawnMovementComponent
 {
   GENERATED_BODY()
   friend class AGenPlayerController;
+  friend class UGenWorldSubsystem;
 
 public:
 
@@ -547,6 +740,8 @@ public:
   static constexpr float MIN_DELTA_TIME = 1e-6f;
   /// The maximum value for a component of the directional input vector.
   static constexpr int32 MAX_INPUT = 1;
+  /// The maximum number of replication LOD tiers (@see ReplicationLODTiers). The tier index is serialized with 2 bits.
+  static constexpr int32 MAX_REPLICATION_LOD_TIERS = 3;
 
 #pragma region Utility
 
@@ -894,6 +1089,8 @@ protected:
 
   /// Overridable function that gets called every time a move is about to be executed during a client replay. Can be used if additional
   /// logic is required to put the client world into a state that is in sync with the world at the time the move was originally executed.
+  /// @attention When moves are merged for the replay (@see bMergeIdenticalReplayMoves) this is called once per merged run with the
+  /// combined move instead of once per move.
   ///
   /// @param        ReplayMove    The move about to be replayed.
   /// @returns      void
@@ -902,6 +1099,8 @@ protected:
   virtual void Client_PreReplayMoveExecution_Implementation(const FMove& ReplayMove) {}
 
   /// Overridable function that gets called after a move was executed during a client replay.
+  /// @attention When moves are merged for the replay (@see bMergeIdenticalReplayMoves) this is called once per merged run with the
+  /// combined move instead of once per move.
   ///
   /// @param        ReplayMove    The move that was just replayed.
   /// @returns      void
@@ -1035,8 +1234,77 @@ protected:
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
   bool IsExecutingRemoteMoves() const;
 
+  /// Returns the GMC subsystem of the world the component was begun play in.
+  ///
+  /// @returns      UGenWorldSubsystem*    The world subsystem, nullptr if the component has not begun play yet.
+  UGenWorldSubsystem* GetWorldSubsystem() const { return WorldSubsystem; }
+
+  /// The Blueprint native event hooks of the move pipeline that are dispatched with @see GMC_CALL_HOOK. Const hooks whose native
+  /// implementation is not const cannot be dispatched directly and are only cached (@see HasBlueprintHooks). Subclasses continue the
+  /// numbering with their own hooks starting at the last value of their parent class.
+  enum EReplicationHook : uint8
+  {
+    Hook_Server_PreRemoteMoveExecution,
+    Hook_Server_PostRemoteMoveExecution,
+    Hook_Client_PreReplayMoveExecution,
+    Hook_Client_PostReplayMoveExecution,
+    Hook_Client_ShouldEnqueueMove_Custom,
+    Hook_OnImmediateStateLoaded,
+    Hook_OnSimulatedStateLoaded,
+    Hook_InterpolateCustom1,
+    Hook_InterpolateCustom2,
+    Hook_InterpolateCustom3,
+    Hook_InterpolateCustom4,
+    Hook_Server_PreRemoteMovesProcessing,
+    Hook_Server_OnRemoteMovesProcessed,
+    Hook_Server_OnResolveClientDiscrepancy,
+    NumReplicationHooks
+  };
+
+  /// Determines which hooks of the move pipeline are overridden in Blueprint. Called on begin play, subclasses that declare additional hooks
+  /// must call the parent implementation and cache their own hooks with @see GMC_CACHE_BLUEPRINT_HOOK.
+  ///
+  /// @returns      void
+  virtual void CacheBlueprintHooks();
+
+  /// Caches whether a hook is overridden in Blueprint.
+  ///
+  /// @param        Hook            The index of the hook.
+  /// @param        FunctionName    The name of the Blueprint native event.
+  /// @returns      void
+  void CacheBlueprintHook(int32 Hook, FName FunctionName);
+
+  /// Whether a hook has to be called through the Blueprint VM. True for all hooks until they were cached on begin play.
+  ///
+  /// @param        Hook    The index of the hook.
+  /// @returns      bool    True if the hook is overridden in Blueprint (or was not cached yet), false otherwise.
+  bool IsBlueprintHook(int32 Hook) const { return (BlueprintHooks >> Hook) & 1; }
+
+  /// Whether any of the cached hooks is overridden in Blueprint. Only meaningful after the hooks were cached on begin play.
+  ///
+  /// @returns      bool    True if at least one cached hook is overridden in Blueprint, false otherwise.
+  bool HasBlueprintHooks() const { return (BlueprintHooks & CachedBlueprintHooks) != 0; }
+
+private:
+
+  /// Bitmask of the hooks that are overridden in Blueprint (@see CacheBlueprintHooks).
+  uint64 BlueprintHooks{~0ull};
+
+  /// Bitmask of the hooks that were cached (@see CacheBlueprintHook).
+  uint64 CachedBlueprintHooks{0};
+
 public:
 
+  /// Native counterparts of the remote move and replay move hooks. They are broadcast right after the respective Blueprint native event
+  /// without going through the Blueprint VM, so C++ code that only needs to observe the move pipeline can bind to them instead of
+  /// overriding the event in a subclass. Like the events, the replay move delegates are broadcast once per merged run when replay moves are
+  /// merged (@see bMergeIdenticalReplayMoves).
+  /// 远程移动和重放移动钩子的原生对应项。它们在相应的蓝图原生事件之后立即广播，不经过蓝图虚拟机。
+  FGenMoveHookDelegate OnServerPreRemoteMoveExecution;
+  FGenMoveHookDelegate OnServerPostRemoteMoveExecution;
+  FGenMoveHookDelegate OnClientPreReplayMoveExecution;
+  FGenMoveHookDelegate OnClientPostReplayMoveExecution;
+
   /// Get a reference to the owning pawn.
   ///
   /// @returns      AGenPawn*    Reference to the owning pawn.
@@ -1051,6 +1319,13 @@ public:
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
   bool IsExtrapolating() const;
 
+  /// Returns the time span of client moves that are currently held in the dejitter buffer on the server (@see
+  /// bUseServerMoveDejitterBuffer).
+  ///
+  /// @returns      float    The buffered time span in seconds, 0 if the buffer is empty or not used.
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component")
+  float GetDejitterBufferOccupancy() const;
+
   /// Gets the current server world time. When called on a client, this is the synced time with the network delay already accounted for.
   ///
   /// @returns      float    The time in seconds since the server world was brought up for play.
@@ -1132,6 +1407,11 @@ public:
   UFUNCTION(BlueprintCallable, Category = "General Movement Component")
   bool IsServerBot() const;
 
+  /// Get the role partition of the world subsystem registry that matches the current net role and controller of the pawn.
+  ///
+  /// @returns      EGenReplicationRole    The current replication role of the pawn.
+  EGenReplicationRole GetReplicationRole() const;
+
   /// Check if we are on a network server (i.e. not a client and not running in standalone).
   ///
   /// @returns      bool    True if we are a server in a networked context, false otherwise.
@@ -1253,6 +1533,19 @@ private:
   /// The component's owning pawn.
   AGenPawn* GenPawnOwner{nullptr};
 
+  UPROPERTY(Transient, DuplicateTransient)
+  /// The GMC subsystem of the world the component was begun play in.
+  UGenWorldSubsystem* WorldSubsystem{nullptr};
+
+  /// The role the component is currently registered with in the world subsystem registry.
+  EGenReplicationRole RegisteredRole{EGenReplicationRole::None};
+
+  /// Moves the component to the registry partition that matches its current replication role. Called every tick so the registry reflects
+  /// role changes (possession, role replication) without relying on a specific engine callback.
+  ///
+  /// @returns      void
+  void UpdateWorldRegistration();
+
 #pragma region Move Execution
 
   /// Updates the local move every tick with the current input data.
@@ -1288,6 +1581,12 @@ protected:
   /// than the max allowed timestep remaining, all the remaining time will be used in the last iteration.
   int32 MaxIterations{10};
 
+  /// Whether the last executed move left the pawn state unchanged (e.g. because the pawn was sleeping). When true, the server only updates
+  /// the timestamp and the bound data of the saved server state instead of reading the pawn state again.
+  ///
+  /// @returns      bool    True if the pawn state is identical to the one before the last move, false otherwise.
+  virtual bool IsPawnStateUnchanged() const { return false; }
+
 #pragma endregion
 
 #pragma region Movement Replication
@@ -1427,6 +1726,39 @@ private:
   /// The last client move that was unpacked on the server.
   FMove Server_LastUnpackedClientMove;
 
+  // A batch of client moves that is waiting for the deferred server move phase (@see bDeferServerMoveProcessing).
+  struct FQueuedMoveBatch
+  {
+    // The moves of the batch as received from the client (after redundant moves were resolved and discarded).
+    TArray<FMove> Moves;
+    // The result of the timestamp verification, determined during the preparation of the batch.
+    bool bTimestampsValid{true};
+  };
+
+  /// The client move batches received since the last deferred server move phase, in order of arrival.
+  TArray<FQueuedMoveBatch> Server_QueuedMoveBatches;
+
+  /// The client move batches waiting in the dejitter buffer (@see bUseServerMoveDejitterBuffer), in order of arrival.
+  TArray<FQueuedMoveBatch> Server_DejitterBuffer;
+
+  /// The client timestamp up to which buffered moves are released. Advances with the server delta time every frame.
+  float Server_DejitterPlayoutTime{-1.f};
+
+  /// The current target depth of the dejitter buffer in seconds.
+  float Server_DejitterTargetDepth{0.f};
+
+  /// Exponential moving average of the squared deviation between the arrival interval and the timestamp interval of move batches.
+  float Server_DejitterJitterVariance{0.f};
+
+  /// Whether the dejitter buffer ran dry, in which case the next received moves are buffered up to the target depth again.
+  bool Server_bDejitterBufferStarved{false};
+
+  /// The server time at which the last move batch arrived.
+  float Server_DejitterLastArrivalTime{-1.f};
+
+  /// The timestamp of the newest move of the last batch that arrived.
+  float Server_DejitterLastArrivalTimestamp{-1.f};
+
   /// Whether the last client move that was processed on the server was valid or not.
   bool Server_bLastClientMoveWasValid{false};
 
@@ -1445,6 +1777,16 @@ private:
   /// Whether we are currently executing client moves on the server. Can be queried with @see IsExecutingRemoteMoves by subclasses.
   bool Server_bIsExecutingRemoteMoves{false};
 
+  /// Whether the moves are currently executed concurrently with the moves of other pawns, in which case work that must happen on the game
+  /// thread is deferred until @see Server_ApplyDeferredGameThreadWork is called.
+  bool Server_bDeferGameThreadWork{false};
+
+  /// Whether a net update of the pawn was requested while game thread work was deferred.
+  bool Server_bDeferredForceNetUpdate{false};
+
+  /// Whether the client exceeded the max strike count while game thread work was deferred (@see Server_HandleConspicuousClient).
+  bool Server_bDeferredConspicuousClient{false};
+
   /// Server RPC called by the autonomous proxy to send the pending client moves to the server.
   ///
   /// @param        RemoteMoves    The array with the autonomous proxy moves to send to the server.
@@ -1454,6 +1796,16 @@ private:
   void Server_SendMoves_Implementation(const TArray<FMove>& RemoteMoves);
   bool Server_SendMoves_Validate(const TArray<FMove>& RemoteMoves);
 
+  /// Unreliable server RPC called by the autonomous proxy instead of @see Server_SendMoves when @see bUseUnreliableMoveTransport is enabled.
+  /// The batch contains redundant copies of the last unacknowledged moves in front of the pending moves.
+  ///
+  /// @param        RemoteMoves    The array with the autonomous proxy moves to send to the server.
+  /// @returns      void
+  UFUNCTION(Server, Unreliable, WithValidation)
+  void Server_SendMovesUnreliable(const TArray<FMove>& RemoteMoves);
+  void Server_SendMovesUnreliable_Implementation(const TArray<FMove>& RemoteMoves);
+  bool Server_SendMovesUnreliable_Validate(const TArray<FMove>& RemoteMoves);
+
   /// Resets strikes the client has accumulated due to invalid timestamps. This is a timed function (@see Server_ResetClientStrikesHandle)
   /// and called every @see StrikeResetInterval seconds when timestamp verification is enabled.
   ///
@@ -1499,6 +1851,14 @@ private:
     float MoveTimestamp
   );
 
+  /// Alternative to @see Server_ResolveClientDiscrepancy for client moves that carry a hash of their out state instead of the actual values
+  /// (@see FMove::bSerializeOutStateHash). The move is valid if the hash of the current (quantized) pawn state matches the received hash.
+  /// Since the client values are not known, the server keeps its own result either way.
+  ///
+  /// @param        ClientMove    The unpacked client move that was executed.
+  /// @returns      bool          True if the hashes match (client move was valid), false otherwise.
+  bool Server_ResolveClientDiscrepancyFromHash(const FMove& ClientMove);
+
   /// Quantize the state of a remotely controlled server pawn from the values saved in the passed state. This means that the values inside
   /// the state will be quantized and that the pawn will be set to that quantized state.
   /// @attention The quantization level is determined by the settings of the passed state.
@@ -1529,6 +1889,31 @@ private:
   /// @returns      bool             True if a net update should be forced because some important value has changed, false otherwise.
   virtual bool Server_ShouldForceNetUpdate_Custom(ENetRole RecipientRole) const { return false; }
 
+  /// Decides whether a locally controlled server pawn should capture its server state this frame (@see ServerStateCaptureRate). Must be
+  /// called every frame after the local move was executed.
+  ///
+  /// @returns      bool    True if the server state should be saved, false if it can be skipped this frame.
+  bool Server_ShouldCaptureServerState();
+
+  /// Custom checks to capture the server state of a locally controlled server pawn immediately instead of waiting for the next capture
+  /// interval, e.g. when a discrete value changed that simulated proxies should not miss. Called every frame after the local move was
+  /// executed, so implementations can remember the values they compare against.
+  ///
+  /// @returns      bool    True if the server state should be captured this frame, false otherwise.
+  virtual bool Server_ShouldCaptureServerState_Custom() { return false; }
+
+  /// The timestamp of the last captured server state of a locally controlled server pawn.
+  float Server_LastStateCaptureTimestamp{-1.f};
+
+  /// The input flags of the last executed local move of a locally controlled server pawn.
+  uint16 Server_LastCaptureCheckInputFlags{0};
+
+  /// The location of a locally controlled server pawn at the end of the last frame.
+  FVector Server_LastCaptureCheckLocation{0};
+
+  /// Whether a capture was skipped since the server state was last saved, i.e. the saved state may be older than the previous move.
+  bool Server_bSkippedStateCapture{false};
+
   /// Save the current server state for replication to the clients.
   ///
   /// @param        RecipientRole    The net role of the recipient of the server state (ROLE_AutonomousProxy or ROLE_SimulatedProxy).
@@ -1595,6 +1980,77 @@ private:
   /// @returns      void
   void Server_SetForceFullSerializationFlagPeriodic();
 
+  /// Fills in the values of a move from a redundant batch that were not serialized because they did not change compared to the previous move
+  /// of the same batch. Afterwards, all values of the move are marked as newly received.
+  ///
+  /// @param        Move            The received move to complete.
+  /// @param        PreviousMove    The (already completed) move that precedes the passed move within the same batch.
+  /// @returns      void
+  static void Server_ResolveRedundantMoveValues(FMove& Move, const FMove& PreviousMove);
+
+  /// Executes a batch of client moves on the server.
+  ///
+  /// @param        RemoteMoves         The array with the autonomous proxy moves received from the client.
+  /// @param        bTimestampsValid    The result of the timestamp verification of the batch (@see Server_VerifyTimestamps).
+  /// @returns      void
+  void Server_ExecuteClientMoves(const TArray<FMove>& RemoteMoves, bool bTimestampsValid);
+
+  /// Either processes the received moves directly or queues them for the deferred server move phase (@see bDeferServerMoveProcessing).
+  ///
+  /// @param        RemoteMoves    The received client moves that have not been processed yet.
+  /// @returns      void
+  void Server_ProcessOrQueueClientMoves(const TArray<FMove>& RemoteMoves);
+
+  /// Returns the timestamp of the newest client move that was received, including moves that are still queued for processing.
+  ///
+  /// @returns      float    The timestamp of the newest received client move.
+  float Server_GetNewestReceivedMoveTimestamp() const;
+
+  /// Prepares the queued move batches for execution by verifying their timestamps. Only reads data outside of the queued batches, so it is
+  /// safe to call for different components from different threads.
+  ///
+  /// @returns      void
+  void Server_PrepareQueuedMoveBatches();
+
+  /// Returns a conservative estimate of the space the pawn can move through while executing all queued moves, i.e. the bounds of the root
+  /// component expanded by the distance that can be covered within the accumulated move delta time.
+  ///
+  /// @param        Margin    Additional distance by which the bounds are expanded.
+  /// @returns      FBox      The swept movement bounds of the queued moves.
+  FBox Server_GetQueuedMovesSweptBounds(float Margin) const;
+
+  /// Executes all queued move batches in order of arrival and empties the queue.
+  ///
+  /// @param        bDeferGameThreadWork    Whether the moves are executed concurrently with the moves of other pawns. Only allowed if @see
+  ///                                       CanExecuteMovesConcurrently returned true, @see Server_ApplyDeferredGameThreadWork must be called
+  ///                                       on the game thread afterwards.
+  /// @returns      void
+  void Server_ExecuteQueuedMoveBatches(bool bDeferGameThreadWork = false);
+
+  /// Applies the work that was deferred while the queued moves were executed concurrently (net updates and the conspicuous client event).
+  /// Must be called on the game thread.
+  ///
+  /// @returns      void
+  void Server_ApplyDeferredGameThreadWork();
+
+  /// Forces a net update of the pawn, or defers it while the moves are executed concurrently.
+  ///
+  /// @returns      void
+  void Server_ForceNetUpdate();
+
+  /// Adds a batch of received client moves to the dejitter buffer and updates the jitter estimate of the connection.
+  ///
+  /// @param        RemoteMoves    The received client moves that have not been processed yet.
+  /// @returns      void
+  void Server_AddToDejitterBuffer(const TArray<FMove>& RemoteMoves);
+
+  /// Advances the playout time of the dejitter buffer and executes all buffered moves that are due. Handles buffer under- and overruns and
+  /// adjusts the playout speed slightly to keep the buffer at its target depth.
+  ///
+  /// @param        DeltaTime    The current server delta time.
+  /// @returns      void
+  void Server_TickDejitterBuffer(float DeltaTime);
+
 protected:
 
   /// Generic function for processing the received client moves on the server.
@@ -1605,15 +2061,46 @@ protected:
   /// @returns      void
   void Server_ProcessClientMoves(const TArray<FMove>& RemoteMoves);
 
+  /// Entry point for all client moves received via RPC. Forwards the moves to @see Server_ProcessClientMoves (or queues them for the
+  /// deferred server move phase, @see bDeferServerMoveProcessing), after discarding moves that were already received if the client sends
+  /// redundant batches (@see bUseUnreliableMoveTransport).
+  /// @attention This function is intentionally not private to be able to implement custom serialization settings for client moves, but it
+  /// should otherwise not be used by child classes.
+  ///
+  /// @param        RemoteMoves    The array with the autonomous proxy moves received from the client.
+  /// @returns      void
+  void Server_ReceiveClientMoves(const TArray<FMove>& RemoteMoves);
+
   /// Verifies the timestamps of the moves received from the client. Can be overridden to implement additional or different checks. A failed
   /// verification will increase the client strike count and may block client moves from being executed, but unlike the validation function
   /// (@see Server_ValidateRemoteMoves) it will never cause the client to disconnect.
+  /// @attention When @see bDeferServerMoveProcessing is enabled this may be called from worker threads, so overrides must only read data.
   ///
   /// @param        RemoteMoves    The array with the moves received from the client.
   /// @returns      bool           True if all the timestamps were valid, false otherwise.
   virtual bool Server_VerifyTimestamps(const TArray<FMove>& RemoteMoves) const;
 
-  /// Updates the map of currently connected players and their last serialized data (@see FState::LastSerialized). The list is actively
+  /// Whether the queued client moves of this pawn can be executed off the game thread, concurrently with the moves of pawns in other move
+  /// islands (@see bAllowConcurrentMoveExecution). Checked on the game thread at the start of every deferred server move phase. Can be
+  /// overridden to add project specific conditions, the default implementation should always be included.
+  ///
+  /// @returns      bool    True if the moves can be executed concurrently, false otherwise.
+  virtual bool CanExecuteMovesConcurrently() const;
+
+  /// Chooses the replication LOD tier of every simulated proxy connection for the current frame and determines whether the connection is due
+  /// for an update (@see ReplicationLODTiers).
+  ///
+  /// @returns      void
+  void Server_UpdateReplicationLOD();
+
+  /// Returns the replication LOD tier for a view point.
+  ///
+  /// @param        ViewLocation    The location of the view point.
+  /// @param        ViewRotation    The rotation of the view point.
+  /// @returns      uint8           The tier, 0 is full detail.
+  virtual uint8 Server_GetReplicationLODTier(const FVector& ViewLocation, const FRotator& ViewRotation) const;
+
+  /// Updates the map of currently connected players and their last serialized data (@see FSerializationBaselineStore). The list is actively
   /// maintained and verified with every replication update which is a bit inefficient but we want to minimize dependencies. Can be
   /// overridden to implement a more optimized version (e.g. using the game mode class).
   ///
@@ -1622,19 +2109,66 @@ protected:
 
 public:
 
-  /// Called from @see FState::NetSerialize when the current server state is replicated to a simulated proxy in order to set the appropriate
-  /// flag in the latest state queue entry.
+  /// Called from @see FState::NetSerialize when the current server state is replicated to a simulated proxy in order to record that the
+  /// latest state queue entry was replicated to the target connection.
   ///
   /// @param        TargetConnection    The connection that the server state will be replicated to.
   /// @returns      void
   void Server_SetReplicationFlag(APlayerController* TargetConnection);
 
+  /// Called from @see FState::NetSerialize to look up the cached serialization of the simulated proxy server state for a connection. Builds
+  /// the queued caches of all pawns first if that has not happened yet this frame (@see UGenWorldSubsystem::BuildQueuedSerializationCaches).
+  ///
+  /// @param        Baseline                           The baseline of the connection the state is serialized for.
+  /// @returns      const FSerializationCacheEntry*    The cached serialization, nullptr if there is none for the current state.
+  const FSerializationCacheEntry* Server_FindCachedSerialization(const FConnectionBaseline& Baseline);
+
+  /// Returns a new serialization group for a connection that was serialized to individually (@see FConnectionBaseline::SerializationGroup).
+  ///
+  /// @returns      uint32    The new group.
+  uint32 Server_NewSerializationGroup() { return ++Server_LastSerializationGroup; }
+
+protected:
+
+  /// Whether the simulated proxy server state can be serialized once for multiple connections. Not possible if object references are
+  /// replicated since they are exported through the package map of each connection individually.
+  ///
+  /// @returns      bool    True if the serialization of the simulated proxy server state can be cached, false otherwise.
+  virtual bool Server_CanCacheSerialization() const;
+
 private:
 
-  /// Autonomous proxy move queue. Moves created by the autonomous proxy are appended to the queue (lower index means older move).
-  TArray<FMove> Client_MoveQueue;
+  /// Serializes the simulated proxy server state once for every distinct serialization group of the connections (@see
+  /// FSerializationCacheEntry). Only touches the server state, the baselines and the cache of this component, so it is safe to call for
+  /// different components from different threads.
+  ///
+  /// @returns      void
+  void Server_BuildSerializationCache();
+
+  /// The serializations of the simulated proxy server state for the current frame.
+  TArray<FSerializationCacheEntry> Server_SerializationCache;
+
+  /// The frame counter value and the state timestamp the cache was built for.
+  uint64 Server_SerializationCacheFrame{0};
+  float Server_SerializationCacheTimestamp{-1.f};
+
+  /// Whether the component is queued for the next cache build of the world subsystem.
+  bool bServer_SerializationCacheQueued{false};
+
+  /// The last serialization group that was handed out.
+  uint32 Server_LastSerializationGroup{0};
+
+private:
+
+  /// Autonomous proxy move queue. Moves created by the autonomous proxy are appended to the queue (lower index means older move). The
+  /// capacity is fixed to @see MoveQueueMaxSize when play begins, acknowledged moves are removed by advancing the head of the buffer.
+  TGenRingBuffer<FMove> Client_MoveQueue;
+
+  /// The number of completed moves at the end of the move queue (not counting the newest move which may still be combined) that are waiting
+  /// to be sent to the server with the next RPC call.
+  int32 Client_NumPendingMoves{0};
 
-  /// Contains all completed moves that are waiting to be send to the server with the next RPC call.
+  /// The batch of moves that is sent to the server with the current RPC call. Only filled right before sending, the allocation is reused.
   TArray<FMove> Client_PendingMoves;
 
   /// The previously received server state (one update earlier than the current one). Buffered for comparison with the values of the newly
@@ -1654,6 +2188,15 @@ private:
   /// queried with @see IsReplaying by subclasses.
   bool Client_bIsReplaying{false};
 
+  /// Whether a received server state is waiting to be resolved by the world subsystem (@see bCoalesceClientCorrections).
+  bool Client_bHasPendingCorrection{false};
+
+  /// Whether the pending server state requires a replay.
+  bool Client_bPendingCorrectionRequiresReplay{false};
+
+  /// The source move of the pending server state.
+  FMove Client_PendingCorrectionSourceMove;
+
   /// The last values that were marked to be serialized on the client and sent to the server. We refer to these when the next batch is to be
   /// sent to determine whether values have changed and need to be serialized again.
   float Client_LastSentInputVectorX{0.f};
@@ -1695,11 +2238,71 @@ private:
   /// @returns      bool          True if the client should replay, false if not.
   bool Client_ShouldReplay(const FMove& SourceMove) const;
 
-  /// Executes a client replay. Sets the client pawn to the server state and replays all moves in the move queue.
+  /// Corrects the client state by adopting the current autonomous proxy server state and replaying the move queue.
+  ///
+  /// @param        SourceMove    The source move with the same timestamp as the current server state.
+  /// @returns      void
+  void Client_CorrectFromServerState(const FMove& SourceMove);
+
+  /// Resolves the server state that was received last during this frame if corrections are coalesced (@see bCoalesceClientCorrections).
+  /// Called by the world subsystem after the net driver has dispatched all received packets, and by the autonomous proxy tick as a fallback.
+  ///
+  /// @returns      void
+  void Client_ResolvePendingCorrection();
+
+  /// Executes a client replay. Sets the client pawn to the server state and replays all moves in the move queue. If partial replays are
+  /// enabled the replay stops as soon as the replayed state has reconverged with the original prediction (@see bAllowPartialReplay).
   ///
   /// @returns      void
   void Client_ReplayMoves();
 
+  /// Finds the run of consecutive moves starting at the passed index that can be replayed with a single move execution
+  /// (@see bMergeIdenticalReplayMoves). The moves of a run have identical input and their combined delta time does not exceed
+  /// @see MaxTimeStep, so the run is integrated in a single iteration just like a combined move of the same length would be.
+  ///
+  /// @param        FirstIndex    The index of the first move of the run in the move queue.
+  /// @param        MaxIndex      The index of the last move that may be part of a run.
+  /// @returns      int32         The index of the last move of the run (equal to the first index if the move cannot be merged).
+  int32 Client_FindMergeableReplayRun(int32 FirstIndex, int32 MaxIndex) const;
+
+  /// Returns the index of the newest move in the move queue whose outputs may be interpolated by a merged replay. The outputs of a move are
+  /// sent to the server and validated there, so only moves that were already sent and will not be sent again as redundant moves can be
+  /// merged.
+  ///
+  /// @returns      int32    The index of the newest mergeable move, INDEX_NONE if there is none.
+  int32 Client_GetLastMergeableReplayIndex() const;
+
+  /// Checks whether two moves have the same input (input vector, input flags, input mode and control rotation).
+  ///
+  /// @param        FirstMove    The first move of the run.
+  /// @param        NextMove     The move to check.
+  /// @returns      bool         True if the moves have identical input, false otherwise.
+  bool Client_HaveIdenticalReplayInput(const FMove& FirstMove, const FMove& NextMove) const;
+
+  /// Replays a run of moves with a single move execution and reconstructs the output of each move of the run by interpolating between the
+  /// start and end state of the run. Bound data and the input mode are not interpolated, all moves of the run get the values from the end
+  /// of the run.
+  ///
+  /// @param        FirstIndex    The index of the first move of the run in the move queue.
+  /// @param        LastIndex     The index of the last move of the run in the move queue.
+  /// @returns      void
+  void Client_ReplayMergedMoves(int32 FirstIndex, int32 LastIndex);
+
+  /// Checks whether the output of a replayed move matches the output that was originally predicted for the same move. Uses the same
+  /// tolerances that are used to validate the client state against the server state.
+  ///
+  /// @param        ReplayedMove     The move after it was replayed.
+  /// @param        PredictedMove    A copy of the move from before it was replayed.
+  /// @returns      bool             True if the replayed output matches the predicted output, false otherwise.
+  bool Client_HasReplayConverged(const FMove& ReplayedMove, const FMove& PredictedMove) const;
+
+  /// Sets the client pawn to the originally predicted output of the passed move. Used to skip the remaining moves of a replay that has
+  /// reconverged.
+  ///
+  /// @param        Move    The move to load the output data from (usually the newest move in the queue).
+  /// @returns      void
+  void Client_LoadPredictedStateFromMove(const FMove& Move);
+
   /// Set the client state to the replicated server values for replay. If the source move was valid, only the velocity and bound data will
   /// be set from the server state, because the other properties were determined to be correct on the server and not replicated (so we can
   /// take those values from the source move). If the source move was not valid (i.e. the server state contains all of the replicated data),
@@ -1808,16 +2411,37 @@ private:
   /// @returns      void
   void Client_QuantizePawnStateFrom(FMove& Move);
 
+  /// Quantizes the output of a move the same way as @see Client_QuantizePawnStateFrom but without setting the pawn state.
+  ///
+  /// @param        Move    The move whose output should be quantized.
+  /// @returns      void
+  void Client_QuantizeMoveOutput(FMove& Move) const;
+
   /// Evaluates which values have changed compared to the last sent move and therefore need to be serialized again. We send one additional
   /// bit that indicates whether a value has changed or not. That way a lot of bandwidth is saved for values that don't change very often.
   ///
   /// @returns      void
   void Client_DetermineValuesToSend();
 
+  /// Copies the pending moves from the move queue into the batch that is sent to the server (@see Client_PendingMoves).
+  ///
+  /// @param        NumRedundantMovesToAdd    How many of the already sent but unacknowledged moves that precede the pending moves in the queue
+  ///                                         should be added to the front of the batch.
+  /// @returns      void
+  void Client_CollectPendingMoves(int32 NumRedundantMovesToAdd);
+
+  /// Prepares the pending moves for the unreliable move transport (@see bUseUnreliableMoveTransport). Copies of the last unacknowledged moves
+  /// that were already sent are inserted before the pending moves, and the last sent values are invalidated so the first move of the batch
+  /// is fully serialized. This makes each batch self-contained so it can be unpacked by the server even if the previous one was lost.
+  ///
+  /// @returns      void
+  void Client_AddRedundantMoves();
+
 protected:
 
   /// Called when a server state update is received for the autonomous proxy. Unpacks the replicated data, evaluates the client state, and
-  /// corrects it by executing a replay when necessary.
+  /// corrects it by executing a replay when necessary. The correction is deferred to the end of the net tick if corrections are coalesced
+  /// (@see bCoalesceClientCorrections).
   ///
   /// @returns      void
   UFUNCTION()
@@ -1874,11 +2498,16 @@ protected:
   /// @returns      void
   virtual void Client_ManagePrerequisiteTicks();
 
-  /// Returns the array with the client moves that are currently waiting to be sent to the server.
+  /// Returns the array with the client moves that are currently being sent to the server. Only valid during @see Client_SendMovesToServer.
   ///
   /// @returns      const TArray<FMove>&    Reference-to-const to the array with the pending client moves.
   const TArray<FMove>& Client_GetPendingMoves() const;
 
+  /// Whether client moves are sent with the unreliable RPC (@see bUseUnreliableMoveTransport).
+  ///
+  /// @returns      bool    True if the unreliable move transport is enabled, false otherwise.
+  bool IsUsingUnreliableMoveTransport() const;
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
     (EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
   /// Give authoritative power to the client regarding his location. If enabled, the server will set the actor location directly from the
@@ -1966,6 +2595,84 @@ protected:
   /// 但是，如果客户端上没有更改重要值（将合并移动），通常会更长时间节省带宽。 在这种情况下，下限由最大客户端增量时间确定。
   int32 ClientSendRate{100};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking")
+  /// Send client moves to the server with an unreliable RPC instead of a reliable one. When a packet with a reliable RPC gets lost, all moves
+  /// sent afterwards are held back until the lost one was resent, which starves the server and causes bursts of moves to be processed at
+  /// once. With the unreliable transport every batch also contains the last unacknowledged moves (@see NumRedundantMoves), so a lost batch
+  /// is usually recovered with the next one. Moves that the server has already processed are discarded by timestamp. Packet loss can be
+  /// emulated for testing with the "Net PktLoss=<percent>" console command.
+  /// @attention Classes with custom move serialization settings must use @see IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS_UNRELIABLE, otherwise
+  /// the redundant batches are still sent reliably.
+  /// 使用不可靠的 RPC 而不是可靠的 RPC 将客户端移动发送到服务器。 当包含可靠 RPC 的数据包丢失时，之后发送的所有移动都会被阻塞，直到丢失的数据包被重新发送，
+  /// 这会使服务器缺少数据并导致一次处理大量移动。 使用不可靠传输时，每批还包含最近未确认的移动（@see NumRedundantMoves），因此丢失的批次通常会在下一批中恢复。
+  /// 服务器会根据时间戳丢弃已经处理过的移动。 可以使用 "Net PktLoss=<percent>" 控制台命令模拟丢包进行测试。
+  bool bUseUnreliableMoveTransport{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
+    (EditCondition = "bUseUnreliableMoveTransport", ClampMin = "0", UIMin = "0", UIMax = "16"))
+  /// How many of the most recent unacknowledged moves are sent again with every batch when using the unreliable move transport. Higher
+  /// values tolerate longer streaks of lost packets at the cost of bandwidth. The first move of a batch is always fully serialized, all
+  /// following moves only contain the values that changed compared to the previous move of the same batch.
+  /// 使用不可靠的移动传输时，每批重新发送多少个最近未确认的移动。 较高的值可以容忍更长的连续丢包，但会消耗更多带宽。
+  /// 每批的第一个移动总是完全序列化，之后的所有移动只包含与同一批中前一个移动相比发生变化的值。
+  int32 NumRedundantMoves{4};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking")
+  /// Defer the processing of client moves on the server from the RPC handler to a single phase at the start of the next server frame (@see
+  /// UGenWorldSubsystem). The pawns are partitioned into islands whose swept movement bounds do not interact, then all move batches received
+  /// during a frame are prepared (timestamp verification) in parallel. Islands consisting of a single pawn that allows it execute their
+  /// moves concurrently (@see bAllowConcurrentMoveExecution), all other islands are executed on the game thread afterwards, prefetching the
+  /// floor and penetration queries of their first pawn. Results are committed on the game thread in an order that does not depend on
+  /// packet arrival. The console variables "gmc.ParallelMoveBatchPreparation", "gmc.ParallelMoveIslands" and "gmc.PrefetchMoveQueries"
+  /// toggle the parallel work for profiling, the console command "gmc.BenchmarkMovePhase" compares the frame time of the whole phase
+  /// executed serially and island-parallel.
+  /// @attention Overrides of @see Server_VerifyTimestamps, UGenMovementComponent::GetRootCollisionShape and
+  /// UGenMovementComponent::GetRootCollisionExtent must be thread-safe when this is enabled.
+  /// 将服务器上客户端移动的处理从 RPC 处理程序推迟到下一个服务器帧开始时的单个阶段。 pawn 被划分为扫掠移动范围互不影响的岛，然后并行预处理
+  /// 一帧内收到的所有移动批次（时间戳验证）。 仅包含一个允许并发执行的 pawn 的岛会并发执行其移动，其他岛随后在游戏线程上执行。
+  /// 结果按照与数据包到达顺序无关的顺序在游戏线程上提交。
+  bool bDeferServerMoveProcessing{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta = (EditCondition = "bDeferServerMoveProcessing"))
+  /// Allow the deferred server move phase to execute the moves of this pawn on a worker thread while it does not interact with any other
+  /// pawn. The transform of the pawn is committed on the game thread afterwards: attached components, physics, overlap and hit events are
+  /// only updated once the phase has executed all concurrent moves, and net updates and @see Server_HandleConspicuousClient are deferred as
+  /// well. Pawns that roll back other pawns, smoothed listen server pawns, pawns with move pipeline hooks overridden in Blueprint and pawns
+  /// that play montages are always executed on the game thread (@see CanExecuteMovesConcurrently).
+  /// @attention Everything the movement logic of the pawn calls (native hooks, delegates bound to the move hooks, overrides of movement
+  /// functions) must be thread-safe and must only modify the pawn itself.
+  /// 允许延迟的服务器移动阶段在此 pawn 不与任何其他 pawn 交互时在工作线程上执行其移动。 pawn 的变换随后在游戏线程上提交：附加组件、物理、
+  /// 重叠和命中事件仅在该阶段执行完所有并发移动后才会更新，网络更新和 @see Server_HandleConspicuousClient 也会被推迟。
+  /// 回滚其他 pawn 的 pawn、平滑的监听服务器 pawn、在蓝图中覆盖了移动管线钩子的 pawn 以及正在播放蒙太奇的 pawn 始终在游戏线程上执行。
+  bool bAllowConcurrentMoveExecution{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking")
+  /// Buffer client moves on the server and execute them at a steady cadence that follows the client timestamps, instead of executing them
+  /// as soon as they are received. This decouples the server load and the state updates sent to other clients from network jitter at the
+  /// cost of additional latency (the depth of the buffer). Takes precedence over @see bDeferServerMoveProcessing.
+  /// 在服务器上缓冲客户端移动，并以跟随客户端时间戳的稳定节奏执行它们，而不是在收到时立即执行。
+  /// 这使服务器负载和发送给其他客户端的状态更新与网络抖动解耦，代价是额外的延迟（缓冲区的深度）。 优先于 @see bDeferServerMoveProcessing。
+  bool bUseServerMoveDejitterBuffer{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
+    (EditCondition = "bUseServerMoveDejitterBuffer", ClampMin = "0", UIMin = "0", UIMax = "0.2"))
+  /// The target time span in seconds of client moves held in the dejitter buffer. When adaptive depth is enabled this is the minimum depth.
+  /// 抖动缓冲区中保存的客户端移动的目标时间跨度（秒）。 启用自适应深度时，这是最小深度。
+  float DejitterBufferTargetDepth{0.03f};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
+    (EditCondition = "bUseServerMoveDejitterBuffer"))
+  /// Adapt the depth of the dejitter buffer to the measured variance of the packet inter-arrival times of the connection.
+  /// 根据测得的连接数据包到达间隔时间的方差调整抖动缓冲区的深度。
+  bool bAdaptDejitterBufferDepth{true};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
+    (EditCondition = "bUseServerMoveDejitterBuffer", ClampMin = "0", UIMin = "0.05", UIMax = "0.5"))
+  /// The maximum depth of the dejitter buffer in seconds. If more moves are buffered, the buffer overruns and the excess moves are executed
+  /// immediately.
+  /// 抖动缓冲区的最大深度（秒）。 如果缓冲了更多的移动，缓冲区就会溢出，多余的移动会被立即执行。
+  float DejitterBufferMaxDepth{0.2f};
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
     (EditCondition = "NetworkPreset == ENetworkPreset::Custom", ClampMin = "2", UIMin = "32", UIMax = "256"))
   /// How many past moves the autonomous proxy is allowed to store at most. The appropriate value depends mostly on the network latency (a
@@ -1973,6 +2680,14 @@ protected:
   /// 自治代理最多允许存储多少过去的移动。 适当的值主要取决于网络延迟（更高的 ping 需要更大的移动队列），但也需要考虑网络更新频率和客户端帧率。
   int32 MoveQueueMaxSize{64};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking")
+  /// When several server state updates are received during the same client frame, acknowledge the moves of every update but correct the
+  /// client state at most once against the newest update (@see UGenWorldSubsystem). Without this, every update that requires a replay
+  /// triggers its own replay of the move queue and only the result of the last one survives.
+  /// 当在同一客户端帧内收到多个服务器状态更新时，确认每个更新的移动，但最多只针对最新的更新修正一次客户端状态。
+  /// 否则，每个需要重放的更新都会触发一次移动队列的重放，而只有最后一次的结果会被保留。
+  bool bCoalesceClientCorrections{true};
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", meta =
     (EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
   /// Only replay when moving. This can make corrections less noticeable for the client.
@@ -2024,6 +2739,18 @@ protected:
   /// 如果禁用此功能（即最小保持时间设置为 0），并且 bool 会在下一次移动时立即再次变为 false，则值“true”可能不会复制到其他客户端。
   float MinRepHoldTime{0.02f};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
+    (ClampMin = "0", UIMin = "0", UIMax = "120"))
+  /// Only relevant for locally controlled server pawns (listen server) and server bots. How often per second the server state of the pawn is
+  /// saved, quantized and added to the state queue. The movement is still executed every frame. Clients cannot receive more states than
+  /// the net update frequency of the pawn allows, so there is usually no benefit in capturing states at a higher rate. A state is captured
+  /// immediately regardless of the rate when the pawn was teleported, an input flag or a bound variable with "Update On Change" enabled
+  /// changed, or a custom condition applies (@see Server_ShouldCaptureServerState_Custom). Since server rollback only uses states that were
+  /// actually replicated, the state queue always contains the states required for rollback. 0 captures a state every frame.
+  /// 仅与本地控制的服务器 pawn（监听服务器）和服务器机器人相关。每秒保存、量化 pawn 的服务器状态并将其添加到状态队列的次数。移动仍然每帧执行。
+  /// 当 pawn 被传送、输入标志或启用了“Update On Change”的绑定变量发生变化或满足自定义条件时，无论频率如何都会立即捕获状态。0 表示每帧都捕获状态。
+  float ServerStateCaptureRate{0.f};
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
     (EditCondition = "NetworkPreset == ENetworkPreset::Custom", ClampMin = "0", UIMin = "0", UIMax = "20"))
   /// If greater than 0 the server will fully serialize all data anew every "FullSerializationInterval" seconds. This is intended as a sort
@@ -2043,6 +2770,39 @@ protected:
   /// 此选项通常应禁用，除非出于测试目的。
   bool bAlwaysReplay{false};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
+    (EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
+  /// When enabled, a client replay compares the output of every replayed move with the output that was originally predicted for it, and
+  /// stops replaying once they match within the max allowed errors for a few consecutive moves. The remaining moves keep their original
+  /// predictions and the pawn is set to the predicted output of the newest move. This saves a lot of performance at high ping when
+  /// corrections are small. Only the replicated pawn state and bound data are compared, so this should not be enabled if moves change other
+  /// gameplay-relevant state that is not bound for replication.
+  /// 启用后，客户端重放会将每个重放移动的输出与最初预测的输出进行比较，一旦它们在连续几次移动中都处于最大允许误差范围内，就会停止重放。
+  /// 剩余的移动保留其原始预测，并且 Pawn 被设置为最新移动的预测输出。当修正较小时，这可以在高延迟下节省大量性能。
+  /// 仅比较复制的 Pawn 状态和绑定数据，因此如果移动会更改未绑定复制的其他游戏相关状态，则不应启用此选项。
+  bool bAllowPartialReplay{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
+    (EditCondition = "NetworkPreset == ENetworkPreset::Custom && bAllowPartialReplay", ClampMin = "1", UIMin = "1", UIMax = "8"))
+  /// How many consecutive replayed moves must match their original prediction before a partial replay is allowed to stop. Higher values
+  /// make it less likely that the replay stops on a trajectory that only crosses the original one.
+  /// 部分重放允许停止之前，必须有多少个连续的重放移动与其原始预测相匹配。较高的值可以降低重放在仅与原始轨迹交叉的轨迹上停止的可能性。
+  int32 PartialReplayConvergedMoves{2};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
+    (EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
+  /// When enabled, consecutive moves with identical input are executed as one combined move during a client replay (as long as their
+  /// combined delta time does not exceed the max time step), and the outputs of the individual moves are interpolated. Only enable this if
+  /// your movement is time-step invariant, i.e. if executing two moves in a row gives the same result as executing one move with the
+  /// combined delta time, since the server still executes every move on its own. Only moves that were already sent to the server are
+  /// merged, moves that are still pending always keep their own outputs. Never used when client pawns are rolled back for replays.
+  /// @attention The replay move hooks (@see Client_PreReplayMoveExecution, @see Client_PostReplayMoveExecution) and their native delegates
+  /// are called once per merged run instead of once per move.
+  /// 启用后，在客户端重放期间，具有相同输入的连续移动将作为一个组合移动执行（只要它们的组合增量时间不超过最大时间步长），并对各个移动的输出进行插值。
+  /// 由于服务器仍然单独执行每个移动，只有当您的移动是时间步长不变的（即连续执行两次移动与以组合增量时间执行一次移动的结果相同）时才应启用此选项。
+  /// 只合并已经发送到服务器的移动。回滚客户端 Pawn 进行重放时从不使用。重放移动钩子对每个合并的移动序列只调用一次。
+  bool bMergeIdenticalReplayMoves{false};
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking", AdvancedDisplay, meta =
     (EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
   /// Only relevant for listen servers. Whether pawns on a listen server that are remotely controlled by a client should be smoothed. This
@@ -2116,6 +2876,28 @@ protected:
   /// 服务器是否应该验证从客户端接收到的移动数据的时间戳。 这以牺牲一些处理能力为代价提高了安全性。
   bool bVerifyClientTimestamps{false};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking|Replication LOD")
+  /// Replication levels of detail for simulated proxies, ordered by ascending distance (at most 3 tiers). For every connection the server
+  /// picks the last tier whose min distance is reached and sends the server state at the update interval and with the quantization levels
+  /// of that tier. Pawns that are closer than the first tier are replicated at full detail. Leave empty to disable replication LOD.
+  /// @attention The client adds the time by which received states are spaced further apart than regular updates to the simulation delay of
+  /// a pawn, so pawns in a tier are displayed further in the past. Server pawn rollback does not account for this, tiers should only be used where hit registration does
+  /// not depend on precise positions (e.g. far away or off-screen pawns).
+  /// 模拟代理的复制细节级别，按距离升序排列（最多 3 个层级）。服务器为每个连接选择达到最小距离的最后一个层级，
+  /// 并以该层级的更新间隔和量化级别发送服务器状态。比第一个层级更近的 pawn 以完整细节复制。留空以禁用复制 LOD。
+  TArray<FReplicationLODTier> ReplicationLODTiers;
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking|Replication LOD", meta = (ClampMin = "1", UIMin = "1", UIMax = "4"))
+  /// The distance of a pawn that is outside of the view cone of a connection is multiplied with this factor when choosing its replication
+  /// LOD tier, so off-screen pawns drop to a lower tier earlier.
+  /// 在选择复制 LOD 层级时，位于连接视锥之外的 pawn 的距离乘以此系数，因此屏幕外的 pawn 更早降到较低的层级。
+  float ReplicationLODOffScreenDistanceScale{2.f};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking|Replication LOD", meta = (ClampMin = "0", ClampMax = "180", UIMin = "30", UIMax = "120"))
+  /// Half angle (deg) of the view cone that is used to determine whether a pawn is on-screen for a connection.
+  /// 用于确定 pawn 对于连接是否在屏幕上的视锥半角（度）。
+  float ReplicationLODViewHalfAngle{60.f};
+
   UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Networking|Verification", meta =
     (ClampMin = "0", UIMin = "0.04", UIMax = "0.12", EditCondition = "NetworkPreset == ENetworkPreset::Custom"))
   /// The maximum amount in seconds a client timestamp is allowed to differ from the server calculated one to still be considered valid.
@@ -2154,13 +2936,21 @@ private:
   InterpolationFunctionPtr InterpolationFunction{nullptr};
 
   /// Stores the server states for local movement simulation of remotely controlled pawns. New states are appended at the end of the queue,
-  /// i.e. the smaller the index the older the state is.
-  TArray<FState> StateQueue;
+  /// i.e. the smaller the index the older the state is. Implemented as a ring buffer so evicting the oldest state doesn't shift the entire
+  /// queue.
+  TGenRingBuffer<FState> StateQueue;
 
   /// Checked against to see if the current interpolation time is valid. It might not be after the world time was synchronised on a client
   /// or immediately after the world was brought up.
   float LastValidInterpolationTime{0.f};
 
+  /// Additional simulation delay for pawns that are replicated with a replication LOD tier, so there is a target state to interpolate to
+  /// even though the server states are spaced further apart (@see ReplicationLODTiers).
+  float ReplicationLODDelay{0.f};
+
+  /// The quantization levels of the replication LOD tiers referenced by the simulated proxy server state (@see FState::ReplicationLODLevels).
+  TArray<FReplicationLODTier> ReplicationLODLevels;
+
   /// Holds the state that was used as the start state during the last interpolation.
   FState InterpolationStartState;
 
@@ -2215,6 +3005,12 @@ private:
   /// @returns      void
   void RemoveSimulatedRootComponent();
 
+  /// Updates the additional simulation delay of a simulated proxy that is replicated with a replication LOD tier (@see
+  /// ReplicationLODDelay).
+  ///
+  /// @returns      void
+  void UpdateReplicationLODDelay();
+
   /// Determines the appropriate data for interpolation (or extrapolation) from the state queue based on the passed interpolation time.
   ///
   /// @param        Time                     The current interpolation time.
@@ -2429,13 +3225,15 @@ private:
   ///
   /// @param        Time                     The timestamp to search for.
   /// @param        StateQueueToSearch       The queue to search.
+  /// @param        BaselineStoreToSearch    The simulated proxy baselines belonging to the searched queue (only used on the server).
   /// @param        OutStartState            The found start state.
   /// @param        OutTargetState           The found target state.
   /// @param        OutInterpolationRatio    The ratio to be used for interpolation. Will be -1 if no states were found to interpolate.
   /// @returns      bool                     False if no start and/or target state could be found in the passed queue, true otherwise.
   bool ComputeRollbackInput(
     float Time,
-    const TArray<FState>& StateQueueToSearch,
+    const TGenRingBuffer<FState>& StateQueueToSearch,
+    const FSerializationBaselineStore& BaselineStoreToSearch,
     FState& OutStartState,
     FState& OutTargetState,
     float& OutInterpolationRatio
@@ -2577,6 +3375,7 @@ protected:
   virtual void Server_SaveBoundInputFlagsToServerState(FState& ServerState, const FMove& SourceMove) const;
   virtual void Server_ResetLockedBoundInputFlags();
   virtual bool Client_EnqueueMoveCheckBoundInputFlags(const FMove& CurrentMove) const;
+  virtual bool Client_ReplayMergeCheckBoundInputFlags(const FMove& FirstMove, const FMove& NextMove) const;
   virtual void SaveBoundInputFlagsToMove(FMove& Move) const;
   virtual void SaveBoundInputFlagsToState(FState& State) const;
   virtual void LoadBoundInputFlagsFromMove(const FMove& Move) const;
@@ -2937,6 +3736,102 @@ public:
     BindAnimMontageReferenceWithAccessor(VariableToBind, OutAccessor, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
   }
 
+  /// Binding functions with a declared value range. These work the same as the regular binding functions but the variable is replicated
+  /// with a fixed number of bits derived from the range and precision, which is much cheaper for values with a small known range (e.g. a
+  /// stamina value from 0 to 100). Values outside of the range are clamped when they are sent, and the client compares its predictions with
+  /// the same precision so quantization alone never causes a correction.
+  /// 具有声明值范围的绑定函数。它们与常规绑定函数相同，但变量使用根据范围和精度得出的固定位数进行复制，
+  /// 这对于范围较小且已知的值（例如 0 到 100 的耐力值）要便宜得多。超出范围的值在发送时会被截断，客户端以相同的精度比较其预测，
+  /// 因此量化本身永远不会导致校正。
+  ///
+  /// @param        VariableToBind                 The variable to bind to the pre-replicated data type.
+  ///                                              要绑定到预复制数据类型的变量。
+  /// @param        Min                            The lower bound of the value range (per component for vectors).
+  ///                                              值范围的下限（对于向量为每个分量）。
+  /// @param        Max                            The upper bound of the value range (per component for vectors).
+  ///                                              值范围的上限（对于向量为每个分量）。
+  /// @param        Precision                      The largest acceptable difference between the sent and the received value. At most
+  ///                                              24 bit are used per value.
+  ///                                              发送值和接收值之间可接受的最大差值。每个值最多使用 24 bit。
+  /// @param        bReplicateToAutonomousProxy    @see K2_BindBool
+  /// @param        bReplicateToSimulatedProxy     @see K2_BindBool
+  /// @param        bForceNetUpdateOnChange        @see K2_BindBool
+  /// @returns      void
+  void BindQuantizedInt(
+    int32& VariableToBind,
+    int32 Min,
+    int32 Max,
+    bool bReplicateToAutonomousProxy,
+    bool bReplicateToSimulatedProxy,
+    bool bForceNetUpdateOnChange
+  );
+  void BindQuantizedFloat(
+    float& VariableToBind,
+    float Min,
+    float Max,
+    float Precision,
+    bool bReplicateToAutonomousProxy,
+    bool bReplicateToSimulatedProxy,
+    bool bForceNetUpdateOnChange
+  );
+  void BindQuantizedVector(
+    FVector& VariableToBind,
+    float Min,
+    float Max,
+    float Precision,
+    bool bReplicateToAutonomousProxy,
+    bool bReplicateToSimulatedProxy,
+    bool bForceNetUpdateOnChange
+  );
+
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component", meta = (DisplayName = "BindQuantizedInt",
+    ToolTip = "Bind a 4 byte integer with a known value range. Only uses as many bits as the range requires. 绑定一个具有已知值范围的 4 字节整数。仅使用范围所需的位数。"))
+  void K2_BindQuantizedInt(
+    UPARAM(ref) int32& VariableToBind,
+    int32 Min = 0,
+    int32 Max = 100,
+    UPARAM(DisplayName = "Replay") bool bReplicateToAutonomousProxy = true,
+    UPARAM(DisplayName = "Replicate") bool bReplicateToSimulatedProxy = false,
+    UPARAM(DisplayName = "Update On Change") bool bForceNetUpdateOnChange = false
+  )
+  {
+    BindQuantizedInt(VariableToBind, Min, Max, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  }
+
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component", meta = (DisplayName = "BindQuantizedFloat",
+    ToolTip = "Bind a 4 byte float with a known value range. Replicated with a fixed number of bits derived from the range and precision. 绑定一个具有已知值范围的 4 字节浮点数。使用根据范围和精度得出的固定位数进行复制。"))
+  void K2_BindQuantizedFloat(
+    UPARAM(ref) float& VariableToBind,
+    float Min = 0.f,
+    float Max = 100.f,
+    float Precision = 0.01f,
+    UPARAM(DisplayName = "Replay") bool bReplicateToAutonomousProxy = true,
+    UPARAM(DisplayName = "Replicate") bool bReplicateToSimulatedProxy = false,
+    UPARAM(DisplayName = "Update On Change") bool bForceNetUpdateOnChange = false
+  )
+  {
+    BindQuantizedFloat(VariableToBind, Min, Max, Precision, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  }
+
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component", meta = (DisplayName = "BindQuantizedVector",
+    ToolTip = "Bind an FVector with a known value range per component. Replicated with a fixed number of bits per component derived from the range and precision. 绑定一个每个分量具有已知值范围的 FVector。每个分量使用根据范围和精度得出的固定位数进行复制。"))
+  void K2_BindQuantizedVector(
+    UPARAM(ref) FVector& VariableToBind,
+    float Min = -1000.f,
+    float Max = 1000.f,
+    float Precision = 0.1f,
+    UPARAM(DisplayName = "Replay") bool bReplicateToAutonomousProxy = true,
+    UPARAM(DisplayName = "Replicate") bool bReplicateToSimulatedProxy = false,
+    UPARAM(DisplayName = "Update On Change") bool bForceNetUpdateOnChange = false
+  )
+  {
+    BindQuantizedVector(VariableToBind, Min, Max, Precision, bReplicateToAutonomousProxy, bReplicateToSimulatedProxy, bForceNetUpdateOnChange);
+  }
+
+  /// Logs the number of bits each bound variable of the generically serialized types has used on the wire since the last call and resets
+  /// the counters (@see gmc.DumpBoundDataBits). Only the server counts sent bits.
+  void LogBoundDataBits();
+
   /// Blueprint-getters for pre-replicated data saved in a state. The type-specific functions return the pre-replicated variable with name
   /// "Variable" of the passed state.
   /// @attention Changing the order in which your data is bound also changes which variables refer to the bound data e.g. the first bound
@@ -3018,14 +3913,17 @@ protected:
 
   virtual void Server_SwapStateBufferBoundData();
   virtual bool Server_ForceNetUpdateCheckBoundData();
+  virtual bool Server_CaptureCheckBoundData() const;
   virtual void Server_SaveBoundDataToServerState(FState& ServerState, ENetRole RecipientRole) const;
   virtual void Server_ResetLockedBoundData();
   virtual bool Client_IsBoundDataValid(const FMove& SourceMove) const;
+  virtual bool Client_IsReplayedBoundDataConverged(const FMove& ReplayedMove, const FMove& PredictedMove) const;
   virtual void Client_UnpackBoundData(FState& ServerState) const;
   virtual void Client_LoadBoundDataForReplay(const FMove& SourceMove);
   virtual void SaveBoundDataToMove(FMove& Move, FMove::EStateVars VarsToSave) const;
   virtual void SaveBoundDataToState(FState& State) const;
   virtual void LoadInBoundDataFromMove(const FMove& Move) const;
+  virtual void LoadOutBoundDataFromMove(const FMove& Move) const;
   virtual void LoadBoundDataFromState(const FState& State) const;
   virtual void LoadReplicatedBoundDataFromState(const FState& State) const;
   virtual void AddTargetStateBoundDataToInitState(FState& InitializationState, const FState& TargetState) const;
@@ -3038,6 +3936,14 @@ protected:
   bool Client_IsValidNormal(const FMove& SourceMove) const;
   bool Client_IsValidRotator(const FMove& SourceMove) const;
 
+  /// Comparison functions for bound data during partial replays. Floating point types use the strictest tolerance of the validation
+  /// functions for their type (vectors and normals share the same overload).
+  template<typename T>
+  static bool Client_AreReplayValuesEqual(const T& A, const T& B) { return A == B; }
+  static bool Client_AreReplayValuesEqual(float A, float B) { return FMath::IsNearlyEqual(A, B, 0.000001f); }
+  static bool Client_AreReplayValuesEqual(const FVector& A, const FVector& B) { return A.Equals(B, 0.0001f); }
+  static bool Client_AreReplayValuesEqual(const FRotator& A, const FRotator& B) { return A.Equals(B, 0.01f); }
+
 #pragma endregion
 
 #pragma region Default Replication Interface
@@ -3056,12 +3962,22 @@ protected:
 
   FState ServerState_AutonomousProxy_Buffered_Default;
   FState ServerState_SimulatedProxy_Buffered_Default;
+
+  UPROPERTY(Transient)
+  /// Per-connection serialization baselines of the autonomous and simulated proxy server states (referenced by @see FState::BaselineStore).
+  FSerializationBaselineStore Server_BaselineStore_AutonomousProxy;
+  UPROPERTY(Transient)
+  FSerializationBaselineStore Server_BaselineStore_SimulatedProxy;
   FState StateBuffer_Default;
   FMove LocalMove_Default;
 
 private:
 
-  virtual void Client_SendMovesToServer() { Server_SendMoves(Client_PendingMoves); }
+  virtual void Client_SendMovesToServer()
+  {
+    if (bUseUnreliableMoveTransport) Server_SendMovesUnreliable(Client_PendingMoves);
+    else Server_SendMoves(Client_PendingMoves);
+  }
   virtual FMove& LocalMove() { return LocalMove_Default; }
   virtual const FMove& LocalMove() const { return LocalMove_Default; }
   virtual FState& ServerState_AutonomousProxy() { return ServerState_AutonomousProxy_Default; }
@@ -3148,7 +4064,7 @@ private:
   {
     check(sizeof FMove_Custom == sizeof FMove)
     const TArray<FMove>& ReceivedMoves = reinterpret_cast<const TArray<FMove>&>(RemoteMoves);
-    Server_ProcessClientMoves(ReceivedMoves);
+    Server_ReceiveClientMoves(ReceivedMoves);
   }
   bool Server_SendMoves_Custom_Validate(const TArray<FMove_Custom>& RemoteMoves)
   {
@@ -3164,6 +4080,19 @@ private:
   /*Server_SendMoves_Custom_Validate*/
   IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS(FMove_Custom, LocalMove_Custom, Server_SendMoves_Custom)
 
+  /// To support the unreliable move transport (@see bUseUnreliableMoveTransport) declare an additional unreliable RPC and use the unreliable
+  /// version of the macro instead.
+private:
+  UFUNCTION(Server, Reliable, WithValidation)
+  void Server_SendMoves_Custom(const TArray<FMove_Custom>& RemoteMoves);
+  /*Server_SendMoves_Custom_Implementation*/
+  /*Server_SendMoves_Custom_Validate*/
+  UFUNCTION(Server, Unreliable, WithValidation)
+  void Server_SendMovesUnreliable_Custom(const TArray<FMove_Custom>& RemoteMoves);
+  /*Server_SendMovesUnreliable_Custom_Implementation*/
+  /*Server_SendMovesUnreliable_Custom_Validate*/
+  IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS_UNRELIABLE(FMove_Custom, LocalMove_Custom, Server_SendMoves_Custom, Server_SendMovesUnreliable_Custom)
+
 #endif
 
 #pragma endregion
@@ -3285,3 +4214,8 @@ FORCEINLINE const TArray<FMove>& UGenMovementReplicationComponent::Client_GetPen
 {
   return Client_PendingMoves;
 }
+
+FORCEINLINE bool UGenMovementReplicationComponent::IsUsingUnreliableMoveTransport() const
+{
+  return bUseUnreliableMoveTransport;
+}
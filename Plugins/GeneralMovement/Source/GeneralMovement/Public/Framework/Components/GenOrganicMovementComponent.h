@@ -172,11 +172,23 @@ private:
   /// @see Client_ShouldEnqueueMove_Custom
   bool Client_bDoNotCombineNextMove{false};
 
+  /// Movement mode, collision shape and montage changes are captured immediately for locally controlled server pawns.
+  bool Server_ShouldCaptureServerState_Custom() override;
+
+  /// The values of the last capture check (@see Server_ShouldCaptureServerState_Custom).
+  uint8 Server_LastCaptureCheckMovementMode{0};
+  uint8 Server_LastCaptureCheckRootCollisionShape{0};
+  TWeakObjectPtr<const UAnimMontage> Server_LastCaptureCheckMontage;
+
   UFUNCTION(Server, Reliable, WithValidation)
   void Server_SendMoves_OrganicMovement(const TArray<FMove_OrganicMovement>& RemoteMoves);
   /*Server_SendMoves_OrganicMovement_Implementation*/
   /*Server_SendMoves_OrganicMovement_Validate*/
-  IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS(FMove_OrganicMovement, LocalMove_OrganicMovement, Server_SendMoves_OrganicMovement)
+  UFUNCTION(Server, Unreliable, WithValidation)
+  void Server_SendMovesUnreliable_OrganicMovement(const TArray<FMove_OrganicMovement>& RemoteMoves);
+  /*Server_SendMovesUnreliable_OrganicMovement_Implementation*/
+  /*Server_SendMovesUnreliable_OrganicMovement_Validate*/
+  IMPLEMENT_CUSTOM_SERIALIZATION_SETTINGS_UNRELIABLE(FMove_OrganicMovement, LocalMove_OrganicMovement, Server_SendMoves_OrganicMovement, Server_SendMovesUnreliable_OrganicMovement)
 
 #pragma endregion
 
@@ -331,6 +343,36 @@ protected:
   void MovementUpdate(float DeltaSeconds);
   virtual void MovementUpdate_Implementation(float DeltaSeconds) {}
 
+  /// Hooks of this class that are dispatched with @see GMC_CALL_HOOK.
+  enum EOrganicMovementHook : uint8
+  {
+    Hook_PreProcessInputVector = NumMovementHooks,
+    Hook_PreMovementUpdate,
+    Hook_PostMovementUpdate,
+    Hook_PrePhysicsUpdate,
+    Hook_PostPhysicsUpdate,
+    Hook_MovementUpdate,
+    Hook_PhysicsCustom,
+    Hook_CalculateVelocityCustom,
+    Hook_PostProcessPawnVelocity,
+    Hook_PostProcessBaseVelocity,
+    Hook_PostProcessVelocityToImpart,
+    Hook_UpdateMovementModeDynamic,
+    Hook_UpdateMovementModeStatic,
+    Hook_OnMovementModeUpdated,
+    Hook_OnStuckInGeometry,
+    Hook_OnLanded,
+    Hook_OnMovementModeChanged,
+    Hook_PostProcessAnimRootMotionVelocity,
+    Hook_GetInputAccelerationCustom,
+    Hook_GetBrakingDecelerationCustom,
+    Hook_GetOverMaxSpeedDecelerationCustom,
+    NumOrganicMovementHooks
+  };
+  static_assert(NumOrganicMovementHooks <= 64, "The Blueprint hooks are cached in a 64 bit mask.");
+
+  void CacheBlueprintHooks() override;
+
   /// Handles the physics for grounded movement.
   ///
   /// @param        DeltaSeconds    The delta time to use.
@@ -1036,6 +1078,107 @@ protected:
 
 #pragma endregion
 
+#pragma region Idle Sleep
+
+public:
+
+  /// Returns whether the pawn is currently sleeping (@see bAllowIdleSleep).
+  ///
+  /// @returns      bool    True if the pawn is sleeping, false otherwise.
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component")
+  bool IsIdleSleeping() const;
+
+  /// Wakes the pawn up if it is sleeping and restarts the count of ticks at rest. Only required for changes that are not detected
+  /// automatically, e.g. a modified movement property that should take effect while the pawn is standing still.
+  ///
+  /// @returns      void
+  UFUNCTION(BlueprintCallable, Category = "General Movement Component")
+  void WakeFromIdleSleep();
+
+protected:
+
+  /// Whether the pawn may go to sleep or keep sleeping in its current situation. Checked before and after every movement update while idle
+  /// sleep is enabled. Can be overridden to add project specific conditions, the default implementation should always be included.
+  ///
+  /// @returns      bool    True if the pawn is allowed to sleep, false otherwise.
+  virtual bool CanIdleSleep() const;
+
+  bool CanExecuteMovesConcurrently() const override;
+
+  /// The state of a sleeping pawn is unchanged after every move that it slept through.
+  bool IsPawnStateUnchanged() const override;
+
+  /// A sleeping pawn skips the queries of its movement update so there is nothing to submit.
+  bool SubmitAsyncBotQueries() override;
+
+  /// Delegate called when the root collision begins to overlap another component. Wakes the pawn up.
+  /// @see UPrimitiveComponent::OnComponentBeginOverlap
+  UFUNCTION()
+  virtual void WakeOnOverlap(
+    UPrimitiveComponent* OverlappedComponent,
+    AActor* OtherActor,
+    UPrimitiveComponent* OtherComponent,
+    int32 OtherBodyIndex,
+    bool bFromSweep,
+    const FHitResult& SweepResult
+  );
+
+private:
+
+  /// Everything that has to remain the same for the pawn to be considered at rest.
+  struct FIdleSleepSnapshot
+  {
+    FVector Location{0};
+    FQuat Rotation{FQuat::Identity};
+    FRotator ControlRotation{0};
+    FVector RootCollisionExtent{0};
+    uint8 RootCollisionShape{0};
+    uint8 MovementMode{0};
+    TWeakObjectPtr<UPrimitiveComponent> MovementBase;
+    FTransform MovementBaseTransform{FTransform::Identity};
+  };
+
+  /// The pawn state at the end of the last movement update.
+  FIdleSleepSnapshot IdleSleepSnapshot;
+
+  /// The number of consecutive ticks the pawn has been at rest.
+  int32 IdleTicksAtRest{0};
+
+  bool bIsIdleSleeping{false};
+
+  /// Set by @see WakeFromIdleSleep and overlaps, consumed at the beginning of the next tick.
+  bool bIdleSleepWakeRequested{false};
+
+  /// Whether nothing has changed the pawn between the end of the last tick and the beginning of the current one.
+  bool bIdleSleepUndisturbed{false};
+
+  /// Whether the pawn slept through all iterations of the current move.
+  bool bIdleSleptThroughMove{false};
+
+  /// Moving average of the cost of an awake movement update in ms. Used to estimate the time saved by sleeping (stats only).
+  float AverageAwakeUpdateTime{0.f};
+
+  /// The frame in which the pawn was last counted as sleeping (stats only).
+  uint64 IdleSleepStatFrame{0};
+
+  /// Whether idle sleep is enabled for the pawn (@see bAllowIdleSleep and gmc.IdleSleep).
+  bool IsIdleSleepEnabled() const;
+
+  /// Decides whether the pawn sleeps this tick. Wakes the pawn up if it was disturbed.
+  ///
+  /// @returns      bool    True if the pawn sleeps and the movement update must be skipped, false otherwise.
+  bool TickIdleSleep();
+
+  /// Counts the ticks at rest after a movement update and puts the pawn to sleep once enough have passed.
+  ///
+  /// @returns      void
+  void UpdateIdleSleepAfterMovement();
+
+  void TakeIdleSleepSnapshot(FIdleSleepSnapshot& OutSnapshot) const;
+  bool MatchesIdleSleepSnapshot(const FIdleSleepSnapshot& Snapshot) const;
+
+#pragma endregion
+
 #pragma region Simulated Pawns
 
 private:
@@ -1348,6 +1491,20 @@ public:
   /// blending out.
   bool bApplyRootMotionDuringBlendOut{true};
 
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Movement|Operation")
+  /// If true, the pawn goes to sleep after it has been at rest on the ground without any input for @see IdleSleepTicks consecutive ticks. A
+  /// sleeping pawn skips the entire movement update (including all movement events) until it is woken up by input, a change of velocity
+  /// (e.g. from a force or an impulse), a moving base, an overlap or a change of its location, rotation, collision or movement mode. Only
+  /// enable this if the movement logic of the pawn does not need to run while it is standing still.
+  /// @attention Overlaps only wake the pawn if this was already enabled when the updated component was set.
+  /// 如果为 true，Pawn 在地面上无输入静止 IdleSleepTicks 个连续 tick 后进入休眠，休眠期间跳过整个移动更新，直到被唤醒。
+  bool bAllowIdleSleep{false};
+
+  UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Movement|Operation", meta =
+    (ClampMin = "1", UIMin = "1", EditCondition = "bAllowIdleSleep"))
+  /// The number of consecutive ticks the pawn must be at rest before it goes to sleep (@see bAllowIdleSleep).
+  int32 IdleSleepTicks{10};
+
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Physics", meta = (ClampMin = "0", UIMin = "0"))
   /// Scale the effects of gravity acting on this pawn by this factor. Upward gravity is not supported.
   float GravityScale{1.f};
@@ -1553,6 +1710,11 @@ FORCEINLINE void UGenOrganicMovementComponent::SetAnimRootMotionTranslationScale
   AnimRootMotionTranslationScale = Scale;
 }
 
+FORCEINLINE bool UGenOrganicMovementComponent::IsIdleSleeping() const
+{
+  return bIsIdleSleeping;
+}
+
 FORCEINLINE EGenMovementMode UGenOrganicMovementComponent::GetPreviousMovementModeSimulated() const
 {
   return PreviousMovementModeSimulated;
@@ -0,0 +1,480 @@
+// Copyright 2022 Dominik Scherer. All Rights Reserved.
+#pragma once
+
+#include "GMC_PCH.h"
+#include "GenWorldSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogGMCWorld, Log, All);
+DECLARE_STATS_GROUP(TEXT("GMCWorldSubsystem_Game"), STATGROUP_GMCWorldSubsystem, STATCAT_Advanced);
+
+class AGenPawn;
+class UGenMovementReplicationComponent;
+class FGenFloorField;
+
+// Role partitions of the replication component registry of @see UGenWorldSubsystem.
+enum class EGenReplicationRole : uint8
+{
+  // Locally controlled pawn on a client.
+  AutonomousProxy,
+  // Remotely controlled pawn on a client.
+  SimulatedProxy,
+  // Pawn controlled by a remote client on the server.
+  ServerRemote,
+  // Pawn controlled by a local player on the server (listen server or standalone).
+  ServerLocal,
+  // Pawn controlled by AI on the server.
+  ServerBot,
+  // Pawn without a controller on the server.
+  ServerUnpossessed,
+  // Not registered.
+  None,
+};
+
+// A floor that was found in the baked floor field of @see UGenWorldSubsystem.
+struct FGenFieldFloor
+{
+  // The location of the center of the query sphere when it comes to rest on the floor.
+  FVector RestLocation{0};
+  // The point at which the sphere touches the floor.
+  FVector ImpactPoint{0};
+  // The normal of the floor.
+  FVector ImpactNormal{0};
+  // The impact point of the line trace.
+  FVector LineImpactPoint{0};
+  // The floor component.
+  UPrimitiveComponent* Component{nullptr};
+};
+
+/// World-level data shared by all GMC pawns of a world:
+/// - A registry of all replication components that have begun play, partitioned by their current role. Hot paths that need to visit other
+///   pawns iterate the registry instead of the actor list of the world.
+/// - The deferred server move phase which executes the client moves of all pawns that enabled
+///   @see UGenMovementReplicationComponent::bDeferServerMoveProcessing once per frame.
+/// - The client correction pass which resolves the server states received by autonomous proxies once per frame
+///   (@see UGenMovementReplicationComponent::bCoalesceClientCorrections).
+/// - The net relevancy cache which is built once per server frame and consumed by @see AGenPawn::IsNetRelevantFor and the replication
+///   component (net relevancy tracking and rollback), so that the relevancy of a pawn for a connection only needs to be evaluated once per
+///   frame no matter how many call sites ask for it.
+/// - The server state serialization cache which serializes the simulated proxy state of each pawn once per distinct connection baseline in
+///   parallel before the net driver replicates the pawns (@see UGenMovementReplicationComponent::Server_FindCachedSerialization).
+/// - The baked floor field which answers floor queries over static geometry without querying the physics scene
+///   (@see UGenMovementComponent::UpdateFloor).
+/// - The async bot query batch which submits the floor and penetration queries of all server bots that enabled
+///   @see UGenMovementComponent::bUseAsyncBotQueries at the end of every frame, so they are executed by the engine off the game thread and
+///   the results can be used at the start of the next movement update.
+UCLASS()
+class GMC_API UGenWorldSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+
+  void Initialize(FSubsystemCollectionBase& Collection) override;
+  void Deinitialize() override;
+
+#pragma region Replication Component Registry
+
+  /// Adds a replication component to the registry partition of the passed role.
+  ///
+  /// @param        Component    The component to register.
+  /// @param        Role         The current role of the component. Nothing is registered for @see EGenReplicationRole::None.
+  /// @returns      void
+  void RegisterReplicationComponent(UGenMovementReplicationComponent* Component, EGenReplicationRole Role);
+
+  /// Removes a replication component from the registry partition of the passed role.
+  ///
+  /// @param        Component    The component to unregister.
+  /// @param        Role         The role the component was registered with.
+  /// @returns      void
+  void UnregisterReplicationComponent(UGenMovementReplicationComponent* Component, EGenReplicationRole Role);
+
+  /// Returns all registered replication components with the passed role.
+  ///
+  /// @param        Role                                                The role partition to get. Must not be "None".
+  /// @returns      const TArray<UGenMovementReplicationComponent*>&    The registered components with the passed role (unordered).
+  const TArray<UGenMovementReplicationComponent*>& GetReplicationComponents(EGenReplicationRole Role) const;
+
+  /// Calls the passed function for every registered replication component with one of the passed roles.
+  ///
+  /// @param        Roles       The role partitions to visit.
+  /// @param        Function    The function to call for each component.
+  /// @returns      void
+  void ForEachReplicationComponent(
+    std::initializer_list<EGenReplicationRole> Roles,
+    TFunctionRef<void(UGenMovementReplicationComponent*)> Function
+  ) const;
+
+  /// Calls the passed function for every registered replication component regardless of its role.
+  ///
+  /// @param        Function    The function to call for each component.
+  /// @returns      void
+  void ForEachReplicationComponent(TFunctionRef<void(UGenMovementReplicationComponent*)> Function) const;
+
+private:
+
+  /// The registered replication components, indexed by @see EGenReplicationRole.
+  TArray<UGenMovementReplicationComponent*> ReplicationComponents[static_cast<int32>(EGenReplicationRole::None)];
+
+#pragma endregion
+
+public:
+
+#pragma region Deferred Server Move Phase
+
+  /// Schedules the queued client move batches of a component for execution during the next deferred server move phase.
+  ///
+  /// @param        Component    The component that received client moves.
+  /// @returns      void
+  void QueueClientMoveBatches(UGenMovementReplicationComponent* Component);
+
+  /// Measures the time the whole deferred server move phase takes on the game thread when all move islands are executed one after another
+  /// against executing the islands that allow it concurrently (@see gmc.ParallelMoveIslands). Spawns the passed number of pawns of the class
+  /// of the first registered GMC pawn spread out around it, queues synthetic client move batches with random input for them and executes the
+  /// phase for the passed number of frames in each mode (alternating between the modes). The pawns are destroyed afterwards and the results
+  /// are written to the log.
+  /// @attention The spawned pawns execute the moves like any other remote pawn, including replays and corrections for the synthetic client
+  /// locations, so the results are meant to compare the two modes rather than to predict the cost of real clients.
+  ///
+  /// @param        NumPawns         The number of pawns to spawn.
+  /// @param        NumFrames        The number of frames to execute the phase for in each mode.
+  /// @param        MovesPerBatch    The number of moves in the batch of each pawn per frame.
+  /// @returns      void
+  void BenchmarkMovePhase(int32 NumPawns, int32 NumFrames, int32 MovesPerBatch);
+
+private:
+
+  /// The components with queued client move batches.
+  TArray<TWeakObjectPtr<UGenMovementReplicationComponent>> QueuedMoveComponents;
+
+  /// The number of move islands of the last deferred server move phase.
+  int32 NumLastMoveIslands{0};
+
+  /// The number of move islands of the last deferred server move phase that were executed concurrently.
+  int32 NumLastConcurrentMoveIslands{0};
+
+  /// Handle for the world pre actor tick delegate that starts the client correction pass and the deferred server move phase.
+  FDelegateHandle PreActorTickHandle;
+
+  /// Starts the client correction pass and the deferred server move phase for this subsystem's world.
+  ///
+  /// @param        World           The world that is about to tick its actors.
+  /// @param        TickType        The tick type.
+  /// @param        DeltaSeconds    The current delta time.
+  /// @returns      void
+  void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+  /// Executes the client move batches of all components that were queued since the last phase. The pawns are partitioned into islands whose
+  /// swept movement bounds do not interact (using a uniform grid over the bounds). Islands of a single pawn that allows it
+  /// (@see UGenMovementReplicationComponent::CanExecuteMovesConcurrently) execute their moves in parallel while their movement updates are
+  /// deferred, the transforms, physics bodies, overlaps, hit events and net updates of those pawns are committed on the game thread in
+  /// island order afterwards. For all other islands the batches are prepared and the floor and penetration queries of the first move of the
+  /// first pawn of every island are executed in parallel, since nothing can have changed the world around those pawns before they move.
+  /// Then these islands are executed one after another on the game thread in a deterministic order and the prefetched results are consumed.
+  /// @note Islands of multiple pawns stay on the game thread since the pawns of an island must see each other move, which requires their
+  /// transforms to be committed to the physics scene after every move.
+  ///
+  /// @returns      void
+  void ProcessQueuedClientMoveBatches();
+
+#pragma endregion
+
+public:
+
+#pragma region Coalesced Client Corrections
+
+  /// Schedules the pending server state of an autonomous proxy to be resolved after all packets of the current frame were received.
+  ///
+  /// @param        Component    The component that received a server state.
+  /// @returns      void
+  void QueueClientCorrection(UGenMovementReplicationComponent* Component);
+
+private:
+
+  /// The components with a pending server state.
+  TArray<TWeakObjectPtr<UGenMovementReplicationComponent>> QueuedCorrectionComponents;
+
+  /// Resolves the pending server states of all queued components. Each component corrects its state at most once, no matter how many server
+  /// states it received during the frame.
+  ///
+  /// @returns      void
+  void ResolveQueuedClientCorrections();
+
+#pragma endregion
+
+public:
+
+#pragma region Net Relevancy Cache
+
+  /// Returns whether a pawn is net relevant for a viewer. Uses the relevancy cache of the current frame if possible (building it first if
+  /// necessary) and falls back to a direct evaluation with the viewpoint of the viewer otherwise.
+  ///
+  /// @param        Pawn      The pawn to test.
+  /// @param        Viewer    The controller for which relevancy is being checked. The view target is assumed to be its pawn.
+  /// @returns      bool      True if the pawn is net relevant for the viewer, false otherwise.
+  bool IsNetRelevantFor(const AGenPawn* Pawn, const AController* Viewer);
+
+  /// Looks up the cached relevancy of a pawn for a viewer. The lookup only succeeds if the cache for the current frame contains both the
+  /// pawn and the viewer and the passed view target and source location match the ones the cache was built with.
+  ///
+  /// @param        Pawn                 The pawn to test.
+  /// @param        RealViewer           The "controlling net object" associated with the client for which relevancy is being checked.
+  /// @param        ViewTarget           The actor being used as the point of view for the real viewer.
+  /// @param        SrcLocation          The viewing location.
+  /// @param        bOutIsNetRelevant    The cached relevancy value. Only valid if the function returned true.
+  /// @returns      bool                 True if the cached value could be used, false otherwise.
+  bool GetCachedNetRelevancy(
+    const AGenPawn* Pawn,
+    const AActor* RealViewer,
+    const AActor* ViewTarget,
+    const FVector& SrcLocation,
+    bool& bOutIsNetRelevant
+  );
+
+  /// Returns the view point of a viewer from the relevancy cache of the current frame (building it first if necessary).
+  ///
+  /// @param        Viewer             The controller to get the view point for.
+  /// @param        OutViewLocation    The cached view location. Only valid if the function returned true.
+  /// @param        OutViewRotation    The cached view rotation. Only valid if the function returned true.
+  /// @returns      bool               True if the cache contains the viewer, false otherwise.
+  bool GetCachedViewPoint(const AController* Viewer, FVector& OutViewLocation, FRotator& OutViewRotation);
+
+  /// Writes the build time and hit counts of the relevancy cache to the log and resets the hit counters.
+  ///
+  /// @returns      void
+  void DumpRelevancyCacheStats();
+
+  /// Writes the server state bandwidth of every connection since the last dump and the number of simulated proxies per replication LOD tier
+  /// to the log (@see UGenMovementReplicationComponent::ReplicationLODTiers) and resets the bit counters.
+  ///
+  /// @returns      void
+  void DumpReplicationBandwidth();
+
+private:
+
+  struct FRelevancyViewer
+  {
+    TWeakObjectPtr<const AController> Controller;
+    TWeakObjectPtr<const AActor> ViewTarget;
+    FVector ViewLocation{0};
+    FRotator ViewRotation{0};
+  };
+
+  /// The frame counter value at which the cache was last built.
+  uint64 RelevancyCacheFrame{0};
+
+  /// Whether the cache contains valid data for @see RelevancyCacheFrame.
+  bool bRelevancyCacheValid{false};
+
+  /// The pawns contained in the cache, mapped to their row index.
+  TMap<const AGenPawn*, int32> RelevancyPawnIndices;
+
+  /// The viewers contained in the cache, mapped to their column index.
+  TMap<const AActor*, int32> RelevancyViewerIndices;
+
+  /// The viewers contained in the cache in column order.
+  TArray<FRelevancyViewer> RelevancyViewers;
+
+  /// The pawn x viewer relevancy bitset, the bit for a pair is at index PawnIndex * NumViewers + ViewerIndex.
+  TBitArray<> RelevancyBits;
+
+  /// The pairs for which the relevancy depends on the distance between pawn and viewer (same layout as @see RelevancyBits).
+  TBitArray<> DistanceBasedBits;
+
+  /// Uniform spatial grid over the pawn locations, maps cell coordinates to the row indices of the contained pawns.
+  TMap<FIntVector, TArray<int32>> RelevancyGrid;
+
+  /// Duration of the last cache build in seconds.
+  double LastBuildTime{0.};
+
+  /// Accumulated duration of all builds since the last stats dump in seconds.
+  double TotalBuildTime{0.};
+
+  /// Number of builds since the last stats dump.
+  int32 NumBuilds{0};
+
+  /// Number of lookups that could be served from the cache since the last stats dump.
+  int32 NumHits{0};
+
+  /// Number of lookups that had to fall back to a direct evaluation since the last stats dump.
+  int32 NumMisses{0};
+
+  /// The real time in seconds of the last bandwidth dump, negative if there was none yet.
+  float LastBandwidthDumpTime{-1.f};
+
+  /// Builds the relevancy cache if it has not been built during the current frame yet. Only builds the cache on the server.
+  ///
+  /// @returns      bool    True if the cache is valid for the current frame, false otherwise.
+  bool UpdateRelevancyCache();
+
+  /// Evaluates the relevancy of all pawns for all player connections of the world and stores the results in the cache.
+  ///
+  /// @returns      void
+  void BuildRelevancyCache();
+
+#pragma endregion
+
+public:
+
+#pragma region Server State Serialization Cache
+
+  /// Schedules the serialization cache of a component to be built before the first server state is net serialized this frame.
+  ///
+  /// @param        Component    The component that is about to be replicated.
+  /// @returns      void
+  void QueueSerializationCache(UGenMovementReplicationComponent* Component);
+
+  /// Builds the serialization caches of all queued components. The components are processed in parallel since a cache build only writes
+  /// to the data of its own component.
+  ///
+  /// @returns      void
+  void BuildQueuedSerializationCaches();
+
+private:
+
+  /// The components whose serialization cache has not been built yet.
+  TArray<TWeakObjectPtr<UGenMovementReplicationComponent>> QueuedSerializationComponents;
+
+#pragma endregion
+
+public:
+
+#pragma region Baked Floor Field
+
+  /// Answers a downward floor query (a sphere sweep and a line trace) from the baked floor field of the world. The field is loaded on first
+  /// use from the file written by @see BakeFloorField. Only walkable, planar surfaces of static geometry are answered and only if there are
+  /// no dynamic objects between the sphere and the floor. The field is discarded if the static geometry of a loaded level changed since the
+  /// bake.
+  /// @attention Moving geometry must not use the "WorldStatic" object type, otherwise it is not detected by the dynamic object test.
+  ///
+  /// @param        SphereCenter    The center of the sphere to sweep down.
+  /// @param        LineStart       The start of the line trace, must have the same XY-coordinates as the sphere.
+  /// @param        Radius          The radius of the sphere. Must match the radius the field was baked for.
+  /// @param        TraceLength     The length of both traces.
+  /// @param        IgnoredActor    Actor to ignore for the dynamic object test (usually the querying pawn).
+  /// @param        OutFloor        The floor below the sphere. Only valid if the function returned true.
+  /// @returns      bool            True if the query could be answered from the field, false if the physics scene must be queried instead.
+  bool FindFloorInField(
+    const FVector& SphereCenter,
+    const FVector& LineStart,
+    float Radius,
+    float TraceLength,
+    const AActor* IgnoredActor,
+    FGenFieldFloor& OutFloor
+  );
+
+  /// Bakes the floor field for the static geometry of the world and writes it to the floor field directory of the project content
+  /// ("GMC/FloorFields/<MapName>.gmcfloor"). The directory must be added to the directories to stage as UFS in the packaging settings.
+  ///
+  /// @param        CellSize              The edge length of a grid cell in cm.
+  /// @param        Radius                The radius of the pawns that will use the field. If <= 0, the radius of the first registered pawn
+  ///                                     with a sphere or vertical capsule collision is used.
+  /// @param        MinWalkableNormalZ    The min Z-component of the normal of a walkable surface.
+  /// @returns      void
+  void BakeFloorField(float CellSize, float Radius, float MinWalkableNormalZ);
+
+  /// Compares the answers of the floor field with real traces at random locations above the field and writes the results to the log.
+  ///
+  /// @param        NumSamples    The number of locations to test.
+  /// @returns      void
+  void ValidateFloorField(int32 NumSamples);
+
+  /// Measures the cost of floor queries answered by the floor field against the cost of the equivalent traces at random locations above
+  /// the field and writes the results to the log.
+  ///
+  /// @param        NumQueries    The number of queries to measure.
+  /// @returns      void
+  void BenchmarkFloorQueries(int32 NumQueries);
+
+private:
+
+  /// The floor field of the world, loaded on first use.
+  TSharedPtr<FGenFloorField> FloorField;
+
+  /// Whether loading the floor field was already attempted.
+  bool bFloorFieldLoadAttempted{false};
+
+  /// Handle for the delegate that resolves the floor components of streamed in levels.
+  FDelegateHandle LevelAddedToWorldHandle;
+
+  /// Returns the floor field of the world, loading it first if that was not attempted yet.
+  ///
+  /// @returns      FGenFloorField*    The floor field or nullptr if the world has none.
+  FGenFloorField* GetFloorField();
+
+  /// Returns the file name of the floor field of the world.
+  ///
+  /// @returns      FString    The absolute path of the floor field file.
+  FString GetFloorFieldFileName() const;
+
+  /// Resolves the floor components of the floor field that were not loaded yet. Discards the field if it is stale for the added level.
+  ///
+  /// @param        Level    The level that was added.
+  /// @param        World    The world the level was added to.
+  /// @returns      void
+  void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+#pragma endregion
+
+public:
+
+#pragma region Async Bot Queries
+
+  /// Measures the game thread time of the floor and penetration queries of the passed number of bots when they are executed synchronously
+  /// against submitting them asynchronously and retrieving the results during the next frame. The queries use the collision of the
+  /// registered GMC pawns at random locations around them. The benchmark starts at the end of the next frame and writes its results to the
+  /// log one frame later.
+  ///
+  /// @param        NumBots        The number of bots to simulate the queries for.
+  /// @param        TraceLength    The length of the floor traces.
+  /// @returns      void
+  void BenchmarkBotQueries(int32 NumBots, float TraceLength);
+
+private:
+
+  struct FBotQueryBenchmark
+  {
+    TArray<FTraceHandle> TraceHandles;
+    TArray<FTraceHandle> OverlapHandles;
+    int32 NumBots{0};
+    float TraceLength{0.f};
+    double SyncTime{0.};
+    double SubmitTime{0.};
+    uint64 SubmitFrame{0};
+    /// Whether the benchmark waits for the end of the frame to start.
+    bool bScheduled{false};
+    /// Whether the benchmark waits for the results of its async queries.
+    bool bPending{false};
+  };
+
+  /// The current benchmark of @see BenchmarkBotQueries.
+  FBotQueryBenchmark BotQueryBenchmark;
+
+  /// Handle for the world post actor tick delegate that submits the async bot queries.
+  FDelegateHandle PostActorTickHandle;
+
+  /// Submits the async bot queries after all pawns of this subsystem's world have moved.
+  ///
+  /// @param        World           The world that ticked its actors.
+  /// @param        TickType        The tick type.
+  /// @param        DeltaSeconds    The current delta time.
+  /// @returns      void
+  void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+  /// Submits the floor and penetration queries of all server bots that enabled @see UGenMovementComponent::bUseAsyncBotQueries.
+  ///
+  /// @returns      void
+  void SubmitAsyncBotQueries();
+
+  /// Executes the synchronous queries of the scheduled benchmark and submits the asynchronous ones. Async queries must be submitted while
+  /// the world is ticking for their results to be available during the next frame.
+  ///
+  /// @returns      void
+  void StartBotQueryBenchmark();
+
+  /// Retrieves the results of the pending benchmark and writes them to the log.
+  ///
+  /// @returns      void
+  void FinishBotQueryBenchmark();
+
+#pragma endregion
+};